@@ -2,6 +2,7 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 #include "autograd/binding.hpp"
+#include "graph_lib/op_registry.hpp"
 #include "passes/fuse_ops.hpp"
 
 #include <vector>
@@ -10,6 +11,13 @@ std::tuple<Shape, std::vector<DimBroadcast>> get_op_shape(OpType type, std::vect
 {
     int tile_height = tt::graphlib::get_row_size_from_tile_size(tile_dim);
     int tile_width = tt::graphlib::get_col_size_from_tile_size(tile_dim);
+    if (auto native = tt::graphlib::get_builtin_op_shape(type, operands, is_buda, tile_height, tile_width))
+    {
+        auto &[dims, broadcasts] = *native;
+        Shape s = is_buda ? Shape::create_buda(dims, tile_height, tile_width) : Shape::create(dims);
+        return std::make_tuple(s, broadcasts);
+    }
+
     auto eval_module = is_buda ? py::module_::import("pybuda.op.eval.buda") : py::module_::import("pybuda.op.eval.pybuda");
     py::function pybuda_shape = is_buda ? eval_module.attr("get_f_pybuda_shape")(type, tile_height, tile_width)
                                         : eval_module.attr("get_f_pybuda_shape")(type);
@@ -1,12 +1,20 @@
 // SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
 //
 // SPDX-License-Identifier: Apache-2.0
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <future>
+#include <thread>
 #include <unordered_map>
 #include "yaml-cpp/yaml.h"
 
 #include "backend_api/backend_api.hpp"
+#include "backend_api/command_loop.hpp"
 #include "backend_api/device_config.hpp"
 #include "utils/assert.hpp"
+#include "utils/shm_ring_buffer.hpp"
 
 #include "netlist/tt_backend.hpp"
 #include "netlist/tt_backend_api.hpp"
@@ -230,6 +238,168 @@ void python_handle_refchange(const void *handle_ptr, bool allocate)
         handle.dec_ref();
 }
 
+// Below this much data per thread, spinning up another thread costs more than the conversion it takes over
+static constexpr std::size_t kMinHostConversionBytesPerThread = 4 * 1024 * 1024;
+
+static std::size_t tensor_desc_size_bytes(tt::tt_PytorchTensorDesc const &desc)
+{
+    std::size_t size = desc.itemsize;
+    for (std::uint32_t dim : desc.shape) size *= dim;
+    return size;
+}
+
+// Number of threads to use for host-side conversion of a batch of tensors: one per
+// kMinHostConversionBytesPerThread of data, capped by the number of tensors and cores.
+// A positive `requested` overrides the heuristic (still capped by the number of tensors).
+static std::size_t host_conversion_threads(std::size_t total_bytes, std::size_t num_tensors, int requested)
+{
+    if (num_tensors == 0)
+        return 1;
+    std::size_t threads = static_cast<std::size_t>(requested);
+    if (requested <= 0)
+    {
+        std::size_t cores = std::max(1u, std::thread::hardware_concurrency());
+        threads = std::clamp<std::size_t>(total_bytes / kMinHostConversionBytesPerThread, 1, cores);
+    }
+    return std::min(threads, num_tensors);
+}
+
+// Run fn(i) for every i in [0, count) on num_threads threads (the caller being one of them). Work is handed
+// out one index at a time, since tensor sizes in a batch are usually very uneven.
+template <typename F>
+static void parallel_for(std::size_t count, std::size_t num_threads, F fn)
+{
+    std::atomic<std::size_t> next{0};
+    auto work = [&]()
+    {
+        for (std::size_t i = next++; i < count; i = next++) fn(i);
+    };
+
+    std::vector<std::future<void>> workers;
+    for (std::size_t t = 1; t < num_threads; t++) workers.push_back(std::async(std::launch::async, work));
+    work();
+    for (auto &worker : workers) worker.get();  // rethrows the first failure
+}
+
+static std::vector<tt::tt_TilizedTensorDesc> tilize_tensors(
+    std::vector<tt::tt_dram_io_desc> const &queues, std::vector<tt::tt_PytorchTensorDesc> &tensors, int num_threads)
+{
+    TT_ASSERT(queues.size() == tensors.size(), "Number of queues and tensors to tilize must match");
+    std::size_t total_bytes = 0;
+    for (auto const &tensor : tensors) total_bytes += tensor_desc_size_bytes(tensor);
+
+    std::vector<tt::tt_TilizedTensorDesc> tilized(tensors.size());
+    parallel_for(
+        tensors.size(),
+        host_conversion_threads(total_bytes, tensors.size(), num_threads),
+        [&](std::size_t i) { tilized[i] = tt::backend::tilize_tensor(queues[i], tensors[i]); });
+    return tilized;
+}
+
+static void binarize_tensors(
+    std::vector<tt::tt_TilizedTensorDesc> &tensors, std::vector<std::string> const &paths, int num_threads)
+{
+    TT_ASSERT(tensors.size() == paths.size(), "Number of tensors and files to binarize must match");
+    std::size_t total_bytes = 0;
+    for (auto const &tensor : tensors) total_bytes += std::size_t(tensor.num_buffers) * tensor.buf_size_bytes;
+
+    parallel_for(
+        tensors.size(),
+        host_conversion_threads(total_bytes, tensors.size(), num_threads),
+        [&](std::size_t i) { tt::backend::binarize_tensor<tt::tt_TilizedTensorDesc>(tensors[i], paths[i]); });
+}
+
+// Outputs of a native command loop. They are copied out of the output queues, so that the queues can be popped
+// without waiting for python to pick them up.
+struct CommandLoopOutputs
+{
+    std::vector<std::vector<std::byte>> buffers;
+    std::vector<std::vector<std::vector<tt::tt_PytorchTensorDesc>>> tensors;  // [group][iteration][queue]
+};
+
+// Run a whole loop schedule on the backend. inputs are indexed by [group][iteration][queue], and have to be
+// converted for the input queues already, the same way push_input expects them.
+static std::shared_ptr<CommandLoopOutputs> run_command_loop(
+    std::shared_ptr<tt_backend> backend,
+    LoopSchedule const &schedule,
+    std::vector<std::vector<tt::tt_dram_io_desc>> const &input_queues,
+    std::vector<std::vector<std::vector<tt::tt_PytorchTensorDesc>>> const &inputs,
+    std::vector<std::vector<tt::tt_dram_io_desc>> const &output_queues,
+    int timeout_secs)
+{
+    TT_ASSERT(input_queues.size() == inputs.size(), "Input queue groups and input tensor groups must match");
+    for (std::size_t group = 0; group < inputs.size(); group++)
+    {
+        TT_ASSERT(
+            inputs[group].size() >= std::size_t(schedule.loop_count),
+            "Not enough inputs for the loop count in group " + std::to_string(group));
+        for (auto const &tensors : inputs[group])
+            TT_ASSERT(tensors.size() == input_queues[group].size(), "Incorrect number of tensors provided on input");
+    }
+
+    auto outputs = std::make_shared<CommandLoopOutputs>();
+    outputs->tensors.resize(output_queues.size());
+    for (auto &group : outputs->tensors) group.resize(schedule.loop_count);
+
+    // A group spans several queues, progress within the group is kept across timeouts so nothing is pushed or
+    // popped twice. Each of these is only touched by its own loop thread.
+    std::size_t next_input_queue = 0;
+    std::size_t next_output_queue = 0;
+
+    CommandLoopHooks hooks;
+    hooks.push = [&](int group, int iteration)
+    {
+        auto const &queues = input_queues.at(group);
+        for (; next_input_queue < queues.size(); next_input_queue++)
+        {
+            auto status = tt::backend::push_input(
+                queues[next_input_queue], inputs[group][iteration][next_input_queue], false, timeout_secs, -1);
+            if (status == tt::DEVICE_STATUS_CODE::TimeoutError)
+                return false;
+            TT_ASSERT(
+                status == tt::DEVICE_STATUS_CODE::Success,
+                "Error while pushing to " + queues[next_input_queue].queue_name);
+        }
+        next_input_queue = 0;
+        return true;
+    };
+    hooks.run = [&](LoopStep const &step)
+    {
+        TT_ASSERT(
+            backend->run_program(step.program, step.params) == tt::DEVICE_STATUS_CODE::Success,
+            "Failed while running " + step.program);
+    };
+    hooks.pop = [&](int group, int iteration)
+    {
+        auto const &queues = output_queues.at(group);
+        auto &tensors = outputs->tensors[group][iteration];
+        for (; next_output_queue < queues.size(); next_output_queue++)
+        {
+            tt::tt_dram_io_desc const &queue = queues[next_output_queue];
+            tt::tt_PytorchTensorDesc desc;
+            auto status = tt::backend::get_output(queue, desc, false, timeout_secs, -1);
+            if (status == tt::DEVICE_STATUS_CODE::TimeoutError)
+                return false;
+            TT_ASSERT(status == tt::DEVICE_STATUS_CODE::Success, "Error while reading " + queue.queue_name);
+
+            std::size_t size = std::size_t(desc.shape[0]) * desc.strides[0];
+            std::vector<std::byte> &buffer = outputs->buffers.emplace_back(size);
+            std::memcpy(buffer.data(), desc.ptr, size);
+            tensors.emplace_back(buffer.data(), desc.itemsize, desc.format, desc.shape, desc.strides, desc.dim);
+
+            TT_ASSERT(
+                tt::backend::pop_output(queue, false, timeout_secs) == tt::DEVICE_STATUS_CODE::Success,
+                "Error while popping " + queue.queue_name);
+        }
+        next_output_queue = 0;
+        return true;
+    };
+
+    CommandLoop loop(schedule, std::move(hooks));
+    loop.run();
+    return outputs;
+}
+
 void BackendModule(py::module &m_backend) {
 
 
@@ -495,6 +665,23 @@ void BackendModule(py::module &m_backend) {
 
             return tt_PytorchTensorDesc(buffer, itemsize, format, shape, strides, dim);
         }))
+        .def_static(
+            "from_buffer",
+            [](py::buffer buffer,
+               std::uint32_t itemsize,
+               tt::DataFormat format,
+               std::uint32_t dim,
+               std::array<std::uint32_t, 4> shape,
+               std::array<std::uint32_t, 4> strides)
+            {
+                // Descriptor points into the buffer (i.e. a memory-mapped file), which is kept alive along with it
+                py::buffer_info info = buffer.request();
+                TT_ASSERT(
+                    static_cast<std::size_t>(info.size * info.itemsize) >= std::size_t(shape[0]) * strides[0],
+                    "Buffer too small for tensor descriptor");
+                return tt_PytorchTensorDesc(info.ptr, itemsize, format, shape, strides, dim);
+            },
+            py::keep_alive<0, 1>())
         .def_readwrite("itemsize", &tt_PytorchTensorDesc::itemsize)
         .def_readwrite("format", &tt_PytorchTensorDesc::format)
         .def_readwrite("shape", &tt_PytorchTensorDesc::shape)
@@ -548,6 +735,18 @@ void BackendModule(py::module &m_backend) {
 
     py::class_<tt::tt_TilizedTensorDesc>(m_backend, "TilizedTensorDesc")
         .def(py::init<>())
+        .def_static(
+            "from_buffer",
+            [](py::buffer buffer, std::uint32_t num_buffers, std::uint32_t buf_size_bytes, tt::DataFormat format)
+            {
+                // Descriptor points into the buffer (i.e. a memory-mapped file), which is kept alive along with it
+                py::buffer_info info = buffer.request();
+                TT_ASSERT(
+                    static_cast<std::size_t>(info.size * info.itemsize) >= std::size_t(num_buffers) * buf_size_bytes,
+                    "Buffer too small for tilized tensor descriptor");
+                return tt::tt_TilizedTensorDesc(info.ptr, num_buffers, buf_size_bytes, format);
+            },
+            py::keep_alive<0, 1>())
         .def_readwrite("num_buffers", &tt::tt_TilizedTensorDesc::num_buffers)
         .def_readwrite("buf_size_bytes", &tt::tt_TilizedTensorDesc::buf_size_bytes)
         .def_readwrite("format", &tt::tt_TilizedTensorDesc::format)
@@ -673,6 +872,60 @@ void BackendModule(py::module &m_backend) {
     m_backend.def("free_tensor", &tt::backend::free_tensor<tt::tt_PytorchTensorDesc>);
     m_backend.def("free_tensor", &tt::backend::free_tensor<tt::tt_TilizedTensorDesc>);
     m_backend.def("tilize_tensor", &tt::backend::tilize_tensor);
+    m_backend.def(
+        "tilize_tensors",
+        &tilize_tensors,
+        py::arg("queues"),
+        py::arg("tensors"),
+        py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>());
+    m_backend.def(
+        "binarize_tensors",
+        &binarize_tensors,
+        py::arg("tensors"),
+        py::arg("paths"),
+        py::arg("num_threads") = 0,
+        py::call_guard<py::gil_scoped_release>());
+    m_backend.def("host_conversion_threads", &host_conversion_threads);
+
+    py::class_<LoopStep>(m_backend, "LoopStep")
+        .def_static("push_inputs", &LoopStep::push_inputs, py::arg("group"))
+        .def_static(
+            "run_program",
+            &LoopStep::run_program,
+            py::arg("program"),
+            py::arg("params") = std::map<std::string, std::string>{})
+        .def_static("pop_outputs", &LoopStep::pop_outputs, py::arg("group"))
+        .def_readonly("group", &LoopStep::group)
+        .def_readonly("program", &LoopStep::program)
+        .def_readonly("params", &LoopStep::params);
+
+    py::class_<LoopSchedule>(m_backend, "LoopSchedule")
+        .def(py::init<>())
+        .def_readwrite("steps", &LoopSchedule::steps)
+        .def_readwrite("final_steps", &LoopSchedule::final_steps)
+        .def_readwrite("loop_count", &LoopSchedule::loop_count)
+        .def_readwrite("max_inflight", &LoopSchedule::max_inflight);
+
+    py::class_<CommandLoopOutputs, std::shared_ptr<CommandLoopOutputs>>(m_backend, "CommandLoopOutputs")
+        .def(
+            "get",
+            // Descriptors point into the outputs object, which has to be kept alive until they are consumed
+            [](CommandLoopOutputs const &self, int group, int iteration)
+            { return self.tensors.at(group).at(iteration); },
+            py::arg("group"),
+            py::arg("iteration"));
+
+    m_backend.def(
+        "run_command_loop",
+        &run_command_loop,
+        py::arg("backend"),
+        py::arg("schedule"),
+        py::arg("input_queues"),
+        py::arg("inputs"),
+        py::arg("output_queues"),
+        py::arg("timeout_secs") = 1,
+        py::call_guard<py::gil_scoped_release>());
     m_backend.def("binarize_tensor", &tt::backend::binarize_tensor<tt::tt_PytorchTensorDesc>);
     m_backend.def("binarize_tensor", &tt::backend::binarize_tensor<tt::tt_TilizedTensorDesc>);
     m_backend.def("debinarize_tensor", &tt::backend::debinarize_tensor<tt::tt_PytorchTensorDesc>);
@@ -715,6 +968,68 @@ void BackendModule(py::module &m_backend) {
     m_backend.def("finish_child_process", &tt::backend::finish_child_process);
     m_backend.def("load_cached_sys_param", &tt::load_cached_sys_param);
 
+    py::class_<tt::ShmRingBuffer, std::shared_ptr<tt::ShmRingBuffer>>(m_backend, "ShmRingBuffer")
+        .def(py::init<std::string const &, std::size_t>(), py::arg("name"), py::arg("capacity"))
+        .def_property_readonly("name", &tt::ShmRingBuffer::name)
+        .def_property_readonly("capacity", &tt::ShmRingBuffer::capacity)
+        .def("empty", &tt::ShmRingBuffer::empty)
+        .def(
+            "fits",
+            [](tt::ShmRingBuffer const &self, py::bytes header, std::vector<std::pair<std::uintptr_t, std::size_t>> const &buffers) {
+                std::vector<tt::ShmRingBuffer::Buffer> record = {{nullptr, py::len(header)}};
+                for (auto const &[ptr, size] : buffers) record.emplace_back(reinterpret_cast<const void *>(ptr), size);
+                return self.fits(record);
+            })
+        .def(
+            "write",
+            [](tt::ShmRingBuffer &self,
+               py::bytes header,
+               std::vector<std::pair<std::uintptr_t, std::size_t>> const &buffers,
+               int timeout_ms) {
+                // Buffers are (data_ptr, size in bytes) pairs, caller keeps the underlying tensors alive
+                std::string_view header_view = header;
+                std::vector<tt::ShmRingBuffer::Buffer> record = {{header_view.data(), header_view.size()}};
+                for (auto const &[ptr, size] : buffers) record.emplace_back(reinterpret_cast<const void *>(ptr), size);
+                py::gil_scoped_release release;
+                return self.write(record, timeout_ms);
+            },
+            py::arg("header"),
+            py::arg("buffers"),
+            py::arg("timeout_ms") = -1)
+        .def(
+            "read",
+            [](tt::ShmRingBuffer &self, int timeout_ms) -> std::optional<std::pair<py::bytes, std::vector<py::memoryview>>> {
+                // Returned views point into shared memory and are only valid until release()
+                std::vector<tt::ShmRingBuffer::Buffer> record;
+                bool ok;
+                {
+                    py::gil_scoped_release release;
+                    ok = self.read(record, timeout_ms);
+                }
+                if (not ok)
+                    return std::nullopt;
+
+                TT_ASSERT(record.size() > 0);
+                py::bytes header(static_cast<const char *>(record[0].first), record[0].second);
+                std::vector<py::memoryview> views;
+                for (std::size_t i = 1; i < record.size(); i++)
+                    views.push_back(py::memoryview::from_memory(const_cast<void *>(record[i].first), record[i].second));
+                return std::make_pair(header, views);
+            },
+            py::arg("timeout_ms") = -1)
+        .def("release", &tt::ShmRingBuffer::release)
+        .def(py::pickle(
+            [](const tt::ShmRingBuffer &ring) {  // __getstate__
+                return py::make_tuple(ring.name());
+            },
+            [](py::tuple t) {  // __setstate__
+                if (t.size() != 1)
+                    throw std::runtime_error("tt::ShmRingBuffer: Invalid state!");
+
+                // Unpickled copies attach to the segment, the original object owns it
+                return std::make_shared<tt::ShmRingBuffer>(t[0].cast<std::string>());
+            }));
+
     py::class_<DeviceGrid>(m_backend, "DeviceGrid")
         .def(py::init<std::pair<int, int>>())
         .def_readonly("r", &DeviceGrid::r)
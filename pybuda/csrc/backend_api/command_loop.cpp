@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "backend_api/command_loop.hpp"
+
+#include <thread>
+
+#include "utils/assert.hpp"
+
+namespace tt::backend_api
+{
+
+CommandLoop::CommandLoop(LoopSchedule schedule, CommandLoopHooks hooks) :
+    schedule_(std::move(schedule)), hooks_(std::move(hooks))
+{
+    TT_ASSERT(schedule_.loop_count >= 0);
+    TT_ASSERT(schedule_.max_inflight > 0, "Command loop needs at least one iteration in flight");
+
+    for (LoopStep const &step : schedule_.steps)
+    {
+        switch (step.type)
+        {
+            case LoopStep::Type::PushInputs: pushes_per_iteration_++; break;
+            case LoopStep::Type::RunProgram: programs_per_iteration_++; break;
+            case LoopStep::Type::PopOutputs: pops_per_iteration_++; break;
+        }
+    }
+    for (LoopStep const &step : schedule_.final_steps)
+        TT_ASSERT(step.type == LoopStep::Type::RunProgram, "Only programs can run after the last iteration");
+
+    TT_ASSERT(pushes_per_iteration_ == 0 or hooks_.push, "Command loop pushes inputs, but has no push hook");
+    TT_ASSERT(
+        programs_per_iteration_ + schedule_.final_steps.size() == 0 or hooks_.run,
+        "Command loop runs programs, but has no run hook");
+    TT_ASSERT(pops_per_iteration_ == 0 or hooks_.pop, "Command loop pops outputs, but has no pop hook");
+}
+
+bool CommandLoop::wait_for(std::atomic<std::uint64_t> const &counter, std::uint64_t target)
+{
+    if (counter >= target)
+        return not stopped_;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    progress_.wait(lock, [&] { return stopped_ or counter >= target; });
+    return not stopped_;
+}
+
+void CommandLoop::advance(std::atomic<std::uint64_t> &counter)
+{
+    {
+        // Bumped under the lock, so that a waiter can't miss the notification between its check and its wait
+        std::scoped_lock lock(mutex_);
+        counter++;
+    }
+    progress_.notify_all();
+}
+
+void CommandLoop::fail(std::exception_ptr error)
+{
+    {
+        std::scoped_lock lock(mutex_);
+        if (not error_)
+            error_ = error;
+        stopped_ = true;
+    }
+    progress_.notify_all();
+}
+
+void CommandLoop::stop()
+{
+    {
+        std::scoped_lock lock(mutex_);
+        stopped_ = true;
+    }
+    progress_.notify_all();
+}
+
+void CommandLoop::input_thread()
+{
+    for (int iteration = 0; iteration < schedule_.loop_count; iteration++)
+    {
+        for (LoopStep const &step : schedule_.steps)
+        {
+            if (step.type != LoopStep::Type::PushInputs)
+                continue;
+            if (stopped_)
+                return;
+
+            // Device input queues provide the backpressure, a full queue times out and gets retried
+            while (not hooks_.push(step.group, iteration))
+                if (stopped_)
+                    return;
+            advance(inputs_done_);
+        }
+    }
+}
+
+void CommandLoop::compute_thread()
+{
+    for (int iteration = 0; iteration < schedule_.loop_count; iteration++)
+    {
+        // Don't get more than max_inflight iterations ahead of the outputs
+        int drained = iteration - schedule_.max_inflight + 1;
+        if (pops_per_iteration_ > 0 and drained > 0 and
+            not wait_for(outputs_done_, std::uint64_t(drained) * pops_per_iteration_))
+            return;
+
+        int pushes_before = 0;
+        for (LoopStep const &step : schedule_.steps)
+        {
+            if (step.type == LoopStep::Type::PushInputs)
+            {
+                pushes_before++;
+                continue;
+            }
+            if (step.type != LoopStep::Type::RunProgram)
+                continue;
+
+            // Programs consume the inputs pushed before them in the same iteration
+            if (not wait_for(inputs_done_, std::uint64_t(iteration) * pushes_per_iteration_ + pushes_before))
+                return;
+            hooks_.run(step);
+            advance(programs_done_);
+        }
+    }
+
+    for (LoopStep const &step : schedule_.final_steps)
+    {
+        if (stopped_)
+            return;
+        hooks_.run(step);
+    }
+}
+
+void CommandLoop::output_thread()
+{
+    for (int iteration = 0; iteration < schedule_.loop_count; iteration++)
+    {
+        int programs_before = 0;
+        for (LoopStep const &step : schedule_.steps)
+        {
+            if (step.type == LoopStep::Type::RunProgram)
+            {
+                programs_before++;
+                continue;
+            }
+            if (step.type != LoopStep::Type::PopOutputs)
+                continue;
+
+            if (not wait_for(programs_done_, std::uint64_t(iteration) * programs_per_iteration_ + programs_before))
+                return;
+            while (not hooks_.pop(step.group, iteration))
+                if (stopped_)
+                    return;
+            advance(outputs_done_);
+        }
+    }
+}
+
+bool CommandLoop::run()
+{
+    TT_ASSERT(not stopped_ and inputs_done_ == 0 and programs_done_ == 0, "Command loop can only run once");
+
+    auto guarded = [this](void (CommandLoop::*thread_main)())
+    {
+        try
+        {
+            (this->*thread_main)();
+        }
+        catch (...)
+        {
+            fail(std::current_exception());
+        }
+    };
+
+    std::vector<std::thread> io_threads;
+    if (pushes_per_iteration_ > 0)
+        io_threads.emplace_back(guarded, &CommandLoop::input_thread);
+    if (pops_per_iteration_ > 0)
+        io_threads.emplace_back(guarded, &CommandLoop::output_thread);
+
+    // Programs are issued from the calling thread
+    guarded(&CommandLoop::compute_thread);
+    for (std::thread &thread : io_threads) thread.join();
+
+    if (error_)
+        std::rethrow_exception(error_);
+    return not stopped_;
+}
+
+}  // namespace tt::backend_api
@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace tt::backend_api
+{
+
+//
+// Native replacement for the python per-microbatch command loop (dc_transfer / run_program / dc_transfer). A whole
+// loop schedule is handed over at once and executed on dedicated threads: one pushing inputs, one issuing programs
+// and one popping outputs, so host conversion and queue I/O overlap with device execution.
+//
+// The loop doesn't know about the backend, the actual pushes, programs and pops are done through CommandLoopHooks.
+//
+struct LoopStep
+{
+    enum class Type
+    {
+        PushInputs,
+        RunProgram,
+        PopOutputs,
+    };
+
+    Type type = Type::RunProgram;
+    int group = 0;  // PushInputs / PopOutputs: index of the input or output queue group
+    std::string program;
+    std::map<std::string, std::string> params;
+
+    static LoopStep push_inputs(int group) { return LoopStep{Type::PushInputs, group, "", {}}; }
+    static LoopStep run_program(std::string program, std::map<std::string, std::string> params = {})
+    {
+        return LoopStep{Type::RunProgram, 0, std::move(program), std::move(params)};
+    }
+    static LoopStep pop_outputs(int group) { return LoopStep{Type::PopOutputs, group, "", {}}; }
+};
+
+struct LoopSchedule
+{
+    std::vector<LoopStep> steps;        // executed once per iteration, in order
+    std::vector<LoopStep> final_steps;  // programs run once after the last iteration, i.e. the optimizer
+    int loop_count = 1;
+
+    // Iterations the programs can run ahead of the output pops. Outputs that are never popped fill up the output
+    // queues, so with 1 each iteration waits until outputs of the previous one have been read.
+    int max_inflight = 1;
+};
+
+// Called from the loop threads. push and pop return false on a timeout, and get retried until the loop is stopped.
+struct CommandLoopHooks
+{
+    std::function<bool(int group, int iteration)> push;
+    std::function<void(LoopStep const &step)> run;
+    std::function<bool(int group, int iteration)> pop;
+};
+
+class CommandLoop
+{
+   public:
+    CommandLoop(LoopSchedule schedule, CommandLoopHooks hooks);
+
+    // Run the whole schedule, blocks until done. The first error raised by any of the threads stops the others and
+    // is rethrown. Returns false if the loop was stopped before finishing.
+    bool run();
+
+    // Stop a running loop from another thread, run() returns once the in-flight hook calls are done
+    void stop();
+
+   private:
+    void input_thread();
+    void compute_thread();
+    void output_thread();
+
+    // Wait until counter reaches target, false if the loop was stopped in the meantime
+    bool wait_for(std::atomic<std::uint64_t> const &counter, std::uint64_t target);
+    void advance(std::atomic<std::uint64_t> &counter);
+    void fail(std::exception_ptr error);
+
+    LoopSchedule schedule_;
+    CommandLoopHooks hooks_;
+
+    int pushes_per_iteration_ = 0;
+    int programs_per_iteration_ = 0;
+    int pops_per_iteration_ = 0;
+
+    // Steps done so far, over all iterations
+    std::atomic<std::uint64_t> inputs_done_{0};
+    std::atomic<std::uint64_t> programs_done_{0};
+    std::atomic<std::uint64_t> outputs_done_{0};
+
+    std::atomic<bool> stopped_{false};
+    std::mutex mutex_;
+    std::condition_variable progress_;
+    std::exception_ptr error_;
+};
+
+}  // namespace tt::backend_api
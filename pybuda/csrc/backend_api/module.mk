@@ -15,7 +15,8 @@ BUDABACKEND_PIPEGEN = third_party/budabackend/build/bin/pipegen2
 
 PYBUDA_CSRC_BACKENDAPI_LIB = $(LIBDIR)/libbackend_api.a
 PYBUDA_CSRC_BACKENDAPI_SRCS += \
-	pybuda/csrc/backend_api/backend_api.cpp
+	pybuda/csrc/backend_api/backend_api.cpp \
+	pybuda/csrc/backend_api/command_loop.cpp
 
 PYBUDA_CSRC_BACKENDAPI_INCLUDES = $(PYBUDA_CSRC_INCLUDES) $(BACKEND_INCLUDES)
 
@@ -0,0 +1,21 @@
+PYBUDA_CSRC_BACKENDAPI_TESTS = $(TESTDIR)/pybuda/csrc/backend_api/tests/backend_api_unit_tests
+PYBUDA_CSRC_BACKENDAPI_TESTS_SRCS = \
+	$(wildcard pybuda/csrc/backend_api/tests/*.cpp)
+
+PYBUDA_CSRC_BACKENDAPI_TESTS_INCLUDES = $(PYBUDA_CSRC_BACKENDAPI_INCLUDES)
+PYBUDA_CSRC_BACKENDAPI_TESTS_LDFLAGS = -lrt -lgtest -lgtest_main -lpthread -l$(PYTHON_VERSION) -lm
+
+PYBUDA_CSRC_BACKENDAPI_TESTS_OBJS = $(addprefix $(OBJDIR)/, $(PYBUDA_CSRC_BACKENDAPI_TESTS_SRCS:.cpp=.o))
+PYBUDA_CSRC_BACKENDAPI_TESTS_DEPS = $(addprefix $(OBJDIR)/, $(PYBUDA_CSRC_BACKENDAPI_TESTS_SRCS:.cpp=.d))
+
+-include $(PYBUDA_CSRC_BACKENDAPI_TESTS_DEPS)
+
+pybuda/csrc/backend_api/tests: $(PYBUDA_CSRC_BACKENDAPI_TESTS)
+
+$(PYBUDA_CSRC_BACKENDAPI_TESTS): $(PYBUDA_CSRC_BACKENDAPI_TESTS_OBJS) $(PYBUDA_CSRC_LIB)
+	@mkdir -p $(@D)
+	$(CXX) $(PYBUDA_CSRC_CFLAGS) $(CXXFLAGS) -o $@ $^ $(LDFLAGS) $(PYBUDA_CSRC_BACKENDAPI_TESTS_LDFLAGS)
+
+$(OBJDIR)/pybuda/csrc/backend_api/tests/%.o: pybuda/csrc/backend_api/tests/%.cpp
+	@mkdir -p $(@D)
+	$(CXX) $(PYBUDA_CSRC_CFLAGS) $(CXXFLAGS) $(PYBUDA_CSRC_BACKENDAPI_TESTS_INCLUDES) -c -o $@ $<
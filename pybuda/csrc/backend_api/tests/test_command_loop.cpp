@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "backend_api/command_loop.hpp"
+#include "fmt/core.h"
+#include "gtest/gtest.h"
+
+namespace tt::test
+{
+
+using backend_api::CommandLoop;
+using backend_api::CommandLoopHooks;
+using backend_api::LoopSchedule;
+using backend_api::LoopStep;
+
+// Hook calls, in the order they completed on any of the loop threads
+struct HookLog
+{
+    std::mutex mutex;
+    std::vector<std::string> events;
+    int pushes = 0;
+    int programs = 0;
+    int pops = 0;
+
+    void record(std::string event, int &counter)
+    {
+        std::scoped_lock lock(mutex);
+        events.push_back(std::move(event));
+        counter++;
+    }
+
+    std::size_t index_of(std::string const &event)
+    {
+        std::scoped_lock lock(mutex);
+        auto it = std::find(events.begin(), events.end(), event);
+        return it == events.end() ? events.size() : it - events.begin();
+    }
+};
+
+static LoopSchedule fwd_schedule(int loop_count, int max_inflight)
+{
+    LoopSchedule schedule;
+    schedule.steps = {LoopStep::push_inputs(0), LoopStep::run_program("run_fwd_0"), LoopStep::pop_outputs(0)};
+    schedule.loop_count = loop_count;
+    schedule.max_inflight = max_inflight;
+    return schedule;
+}
+
+TEST(CommandLoop, push_run_pop_ordering)
+{
+    HookLog log;
+    int program_iteration = 0;
+
+    LoopSchedule schedule = fwd_schedule(8, 2);
+    schedule.final_steps = {LoopStep::run_program("run_opt_0")};
+    CommandLoopHooks hooks = {
+        .push = [&](int group, int iteration) {
+            log.record(fmt::format("push{}_{}", group, iteration), log.pushes);
+            return true;
+        },
+        .run = [&](LoopStep const &step) {
+            log.record(
+                step.program == "run_fwd_0" ? fmt::format("run_{}", program_iteration++) : step.program, log.programs);
+        },
+        .pop = [&](int group, int iteration) {
+            log.record(fmt::format("pop{}_{}", group, iteration), log.pops);
+            return true;
+        },
+    };
+
+    EXPECT_TRUE(CommandLoop(schedule, hooks).run());
+    EXPECT_EQ(log.pushes, 8);
+    EXPECT_EQ(log.programs, 9);
+    EXPECT_EQ(log.pops, 8);
+
+    for (int iteration = 0; iteration < 8; iteration++)
+    {
+        std::size_t push = log.index_of(fmt::format("push0_{}", iteration));
+        std::size_t run = log.index_of(fmt::format("run_{}", iteration));
+        std::size_t pop = log.index_of(fmt::format("pop0_{}", iteration));
+        ASSERT_LT(pop, log.events.size());
+        EXPECT_LT(push, run);
+        EXPECT_LT(run, pop);
+    }
+
+    // The optimizer runs once, after the programs of the last iteration
+    EXPECT_GT(log.index_of("run_opt_0"), log.index_of("run_7"));
+}
+
+TEST(CommandLoop, max_inflight_backpressure)
+{
+    const int max_inflight = 2;
+    std::atomic<int> pops_done = 0;
+    std::atomic<int> max_ahead = 0;
+    int program_iteration = 0;
+
+    CommandLoopHooks hooks = {
+        .push = [](int, int) { return true; },
+        .run = [&](LoopStep const &) {
+            // Outputs of the iterations more than max_inflight back have to be popped by now
+            int ahead = program_iteration++ - pops_done;
+            max_ahead = std::max<int>(max_ahead, ahead);
+        },
+        .pop = [&](int, int) {
+            // Slow reader, programs would run away from it without the backpressure
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            pops_done++;
+            return true;
+        },
+    };
+
+    EXPECT_TRUE(CommandLoop(fwd_schedule(16, max_inflight), hooks).run());
+    EXPECT_EQ(pops_done, 16);
+    EXPECT_LT(max_ahead, max_inflight);
+}
+
+TEST(CommandLoop, timeouts_are_retried_once_per_step)
+{
+    // Every push and pop times out twice before going through
+    std::mutex mutex;
+    std::map<int, int> push_attempts, pop_attempts;
+    std::vector<int> pushed, popped;
+
+    auto flaky = [&mutex](std::map<int, int> &attempts, std::vector<int> &done, int iteration)
+    {
+        std::scoped_lock lock(mutex);
+        if (attempts[iteration]++ < 2)
+            return false;
+        done.push_back(iteration);
+        return true;
+    };
+    CommandLoopHooks hooks = {
+        .push = [&](int, int iteration) { return flaky(push_attempts, pushed, iteration); },
+        .run = [](LoopStep const &) {},
+        .pop = [&](int, int iteration) { return flaky(pop_attempts, popped, iteration); },
+    };
+
+    EXPECT_TRUE(CommandLoop(fwd_schedule(5, 1), hooks).run());
+    EXPECT_EQ(pushed, std::vector<int>({0, 1, 2, 3, 4}));
+    EXPECT_EQ(popped, std::vector<int>({0, 1, 2, 3, 4}));
+    for (int iteration = 0; iteration < 5; iteration++)
+    {
+        EXPECT_EQ(push_attempts[iteration], 3);
+        EXPECT_EQ(pop_attempts[iteration], 3);
+    }
+}
+
+TEST(CommandLoop, errors_are_rethrown_from_any_thread)
+{
+    for (std::string failing : {"push", "run", "pop"})
+    {
+        auto maybe_throw = [failing](std::string const &hook, int iteration)
+        {
+            if (hook == failing and iteration == 2)
+                throw std::runtime_error(hook + " failed");
+        };
+        int program_iteration = 0;
+        CommandLoopHooks hooks = {
+            .push = [&](int, int iteration) {
+                maybe_throw("push", iteration);
+                return true;
+            },
+            .run = [&](LoopStep const &) { maybe_throw("run", program_iteration++); },
+            .pop = [&](int, int iteration) {
+                maybe_throw("pop", iteration);
+                return true;
+            },
+        };
+
+        CommandLoop loop(fwd_schedule(6, 1), hooks);
+        try
+        {
+            loop.run();
+            ADD_FAILURE() << "Error thrown from " << failing << " wasn't rethrown";
+        }
+        catch (std::runtime_error const &e)
+        {
+            EXPECT_EQ(std::string(e.what()), failing + " failed");
+        }
+    }
+}
+
+}  // namespace tt::test
@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <numeric>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "utils/shm_ring_buffer.hpp"
+
+namespace tt::test
+{
+
+struct ShmRingBufferTest : public testing::Test
+{
+   protected:
+    static constexpr std::size_t capacity = 1024;
+    std::unique_ptr<ShmRingBuffer> ring;
+
+    void SetUp() override
+    {
+        std::string name = "/pybuda_test_ring_" + std::to_string(getpid()) + "_" +
+                           testing::UnitTest::GetInstance()->current_test_info()->name();
+        ring = std::make_unique<ShmRingBuffer>(name, capacity);
+    }
+
+    static std::vector<std::uint8_t> payload(std::size_t size, std::uint8_t seed)
+    {
+        std::vector<std::uint8_t> data(size);
+        std::iota(data.begin(), data.end(), seed);
+        return data;
+    }
+
+    static void expect_record(
+        std::vector<ShmRingBuffer::Buffer> const& record, std::vector<std::vector<std::uint8_t>> const& expected)
+    {
+        ASSERT_EQ(record.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); i++)
+        {
+            ASSERT_EQ(record[i].second, expected[i].size());
+            EXPECT_EQ(std::memcmp(record[i].first, expected[i].data(), expected[i].size()), 0) << "buffer " << i;
+        }
+    }
+
+    bool write(std::vector<std::vector<std::uint8_t>> const& buffers, int timeout_ms = 0)
+    {
+        std::vector<ShmRingBuffer::Buffer> record;
+        for (auto const& buffer : buffers) record.emplace_back(buffer.data(), buffer.size());
+        return ring->write(record, timeout_ms);
+    }
+};
+
+TEST_F(ShmRingBufferTest, wraparound)
+{
+    // Record sizes don't divide the capacity, so records regularly start past the end of the ring and wrap
+    std::vector<std::size_t> sizes = {200, 1, 0, 250, 64, 150, 130};
+    std::vector<std::vector<std::vector<std::uint8_t>>> in_flight;
+    std::size_t written = 0;
+    for (std::uint8_t i = 0; written < 10 * capacity; i++)
+    {
+        std::vector<std::vector<std::uint8_t>> record = {payload(8, i), payload(sizes[i % sizes.size()], i + 1)};
+        written += ShmRingBuffer::record_size({{nullptr, 8}, {nullptr, record[1].size()}});
+        ASSERT_TRUE(write(record));
+        in_flight.push_back(record);
+
+        // Keep two records in the ring at once
+        if (in_flight.size() < 2)
+            continue;
+
+        std::vector<ShmRingBuffer::Buffer> read;
+        ASSERT_TRUE(ring->read(read, 0));
+        expect_record(read, in_flight.front());
+        ring->release();
+        in_flight.erase(in_flight.begin());
+    }
+
+    std::vector<ShmRingBuffer::Buffer> read;
+    ASSERT_TRUE(ring->read(read, 0));
+    expect_record(read, in_flight.front());
+    ring->release();
+    EXPECT_TRUE(ring->empty());
+}
+
+TEST_F(ShmRingBufferTest, full_ring_times_out)
+{
+    std::vector<std::vector<std::uint8_t>> record = {payload(200, 0)};
+    EXPECT_THROW(write({payload(ring->max_record_size(), 0)}), std::runtime_error);
+
+    int records = 0;
+    while (write(record)) records++;
+    EXPECT_EQ(records, capacity / ShmRingBuffer::record_size({{nullptr, 200}}));
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(write(record, 50));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+
+    // Views stay valid, and space isn't returned, until release
+    std::vector<ShmRingBuffer::Buffer> read;
+    ASSERT_TRUE(ring->read(read, 0));
+    EXPECT_FALSE(write(record));
+    ring->release();
+    EXPECT_TRUE(write(record));
+}
+
+TEST_F(ShmRingBufferTest, blocked_sides_are_woken)
+{
+    std::vector<ShmRingBuffer::Buffer> read;
+    EXPECT_FALSE(ring->read(read, 10));
+
+    // Reader attaches by name, like a device in another process
+    ShmRingBuffer reader(ring->name());
+    std::thread consumer(
+        [&]
+        {
+            std::vector<ShmRingBuffer::Buffer> record;
+            for (std::uint8_t i = 0; i < 20; i++)
+            {
+                ASSERT_TRUE(reader.read(record, -1));
+                expect_record(record, {payload(400, i)});
+                reader.release();
+            }
+        });
+
+    // The ring holds at most two of these, so the producer keeps waiting for the consumer
+    for (std::uint8_t i = 0; i < 20; i++) ASSERT_TRUE(write({payload(400, i)}, -1));
+    consumer.join();
+    EXPECT_TRUE(ring->empty());
+}
+
+TEST_F(ShmRingBufferTest, shutdown)
+{
+    // Connectors wait in short timeouts and check for shutdown in between, a stuck producer has to get out
+    while (write({payload(200, 0)})) continue;
+
+    std::atomic<bool> shutdown{false};
+    std::atomic<bool> aborted{false};
+    std::thread producer(
+        [&]
+        {
+            while (not write({payload(200, 1)}, 10))
+            {
+                if (shutdown)
+                {
+                    aborted = true;
+                    return;
+                }
+            }
+        });
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    shutdown = true;
+    producer.join();
+    EXPECT_TRUE(aborted);
+
+    // Owner unlinks the segment, attached rings keep their mapping
+    std::string name = ring->name();
+    ShmRingBuffer attached(name);
+    ring.reset();
+    EXPECT_THROW(ShmRingBuffer{name}, std::runtime_error);
+
+    std::vector<ShmRingBuffer::Buffer> read;
+    ASSERT_TRUE(attached.read(read, 0));
+    expect_record(read, {payload(200, 0)});
+    attached.release();
+}
+
+}  // namespace tt::test
@@ -10,6 +10,8 @@
 #include <unordered_set>
 
 #include "balancer/balancer_cache_collection.hpp"
+#include "balancer/exceptions.hpp"
+#include "balancer/legalizer/constraints.hpp"
 #include "balancer/legalizer/legalizer.hpp"
 #include "balancer/policies/policies.hpp"
 #include "balancer/policies/policy_types.hpp"
@@ -20,6 +22,7 @@
 #include "placer/epoch_placer.hpp"
 #include "placer/placer.hpp"
 #include "python_bindings_common.hpp"
+#include "shared_utils/instrumentation.hpp"
 
 using NodeType = tt::graphlib::NodeType;
 
@@ -91,6 +94,7 @@ legalizer::GraphSolver get_graph_solver(
     LegalOpModels const& legal_op_models,
     bool use_op_model_recalculation)
 {
+    INSTRUMENT_SCOPE("create_graph_solver", "balancer");
     if (config.device_config.is_grayskull())
     {
         return legalizer::GraphSolver::create<legalizer::GrayskullConstraint>(
@@ -600,6 +604,68 @@ static void insert_input_queues(
     }
 }
 
+// Graph solver errors that can be detected up front from the graph alone. The graph solver stops on the first one
+// it runs into, while these can be fixed together with legalizer errors before the next balancer attempt.
+//
+// Only Grayskull's kMaxDRAMOutQueues limit qualifies. Fork errors on cumulative paths and single tile broadcast
+// errors depend on the op models the solver picks, so they still come one per attempt from the graph solver.
+//
+static std::vector<BalancerError> find_graph_solver_errors(Graph const* graph, BalancerConfig const& config)
+{
+    std::vector<BalancerError> errors;
+    if (config.device_config.is_grayskull())
+    {
+        // Same condition as in GrayskullConstraint::op_to_op_cost. A single error is enough, the handler splits
+        // forks of all nodes that exceed the limit.
+        for (Node* node : graph->nodes_by_type(NodeType::kBudaOp))
+        {
+            std::vector<Edge> users = graph->user_data_edges(node);
+            bool feeds_op = std::any_of(
+                users.begin(),
+                users.end(),
+                [graph](Edge const& edge)
+                { return graph->node_by_id(edge.consumer_node_id)->node_type() == NodeType::kBudaOp; });
+            if (feeds_op and users.size() > legalizer::EdgeCost::kMaxDRAMOutQueues)
+            {
+                errors.emplace_back(
+                    fmt::format("Node exceeds kMaxDRAMOutQueues {}", node->name()),
+                    BalancerError::NodeExceedsMaxOpForks(legalizer::EdgeCost::kMaxDRAMOutQueues));
+                break;
+            }
+        }
+    }
+    return errors;
+}
+
+static LegalOpModels get_legal_op_models_or_throw_all_errors(
+    Graph* graph, BalancerConfig const& config, std::shared_ptr<BalancerCacheCollection> cache_collection)
+{
+    std::vector<BalancerError> errors = find_graph_solver_errors(graph, config);
+
+    LegalOpModels valid_op_models;
+    try
+    {
+        valid_op_models = legalizer::get_legal_op_models(graph, config, cache_collection);
+    }
+    catch (BalancerError const& e)
+    {
+        if (not std::holds_alternative<BalancerError::NoValidGrid>(e.type))
+            throw;
+        errors.push_back(e);
+    }
+
+    if (errors.size() == 1)
+        throw errors.front();
+    if (errors.size() > 1)
+    {
+        std::string message = fmt::format("{} balancer errors:", errors.size());
+        for (BalancerError const& error : errors) message += "\n  " + error.message;
+        throw BalancerError(message, BalancerError::Multiple(std::move(errors)));
+    }
+
+    return valid_op_models;
+}
+
 static std::tuple<OpModelMap, BlockShapeMap, OutputHostTMMap, CutEdges> balancer_passes(
     Graph* graph,
     BalancerConfig& config,
@@ -607,7 +673,7 @@ static std::tuple<OpModelMap, BlockShapeMap, OutputHostTMMap, CutEdges> balancer
     std::optional<placer::PlacerSolution>& placer_solution)
 {
     log_debug(LogBalancer, "{}", config);
-    LegalOpModels valid_op_models = legalizer::get_legal_op_models(graph, config, cache_collection);
+    LegalOpModels valid_op_models = get_legal_op_models_or_throw_all_errors(graph, config, cache_collection);
 
     auto graph_solver = get_graph_solver(config, cache_collection, graph, valid_op_models);
 
@@ -628,6 +694,7 @@ std::shared_ptr<BalancerSolution> run_balancer_and_placer(
 {
     log_info("Running Balancer with Policy: {}", config.policy_type);
     PROFILE_SCOPE();
+    INSTRUMENT_SCOPE("run_balancer_and_placer", "balancer");
 
     // New epoch-by-epoch placement loop
     if (config.epoch_by_epoch)
@@ -49,8 +49,20 @@ typename std::enable_if<is_std_map<T>::value, int>::type get_map_size_bytes_appr
 //
 struct BalancerCacheCollection
 {
+    // Legal op models of a node, along with a fingerprint of everything in the graph they were derived from.
+    // Lets the legalizer skip nodes that weren't touched by graph edits between balancer attempts.
+    //
+    struct CachedLegalOpModels
+    {
+        std::string fingerprint;
+        std::vector<OpModel> op_models;
+    };
+
     std::unordered_map<Pipe, int> pipe_to_kb_len_cache;                    // Cache Pipe object to kernel broadcast len
     std::unordered_map<Pipe, ResourceUsage> pipe_to_resource_usage_cache;  // Cache Pipe object to ResourceUsage
+    std::unordered_map<graphlib::NodeId, CachedLegalOpModels> legal_op_models_cache;  // Cache node to legal OpModels
+    std::unordered_map<std::uint64_t, std::uint64_t> op_model_prototypes;  // OpModel id of a repeated block op to id
+                                                                            // of the identical OpModel it was copied from
 
     BalancerCacheCollection() { log_debug(tt::LogBalancer, "BalancerCacheCollection: Cache collection initialized"); }
 
@@ -74,6 +86,9 @@ struct BalancerCacheCollection
             tt::LogBalancer,
             "  pipe_to_resource_usage_cache size approx (bytes): {} b",
             get_map_size_bytes_approx(pipe_to_resource_usage_cache));
+
+        log_debug(tt::LogBalancer, "  legal_op_models_cache size (elems): {}", legal_op_models_cache.size());
+        log_debug(tt::LogBalancer, "  op_model_prototypes size (elems): {}", op_model_prototypes.size());
     }
 };
 
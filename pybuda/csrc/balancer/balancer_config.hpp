@@ -53,6 +53,9 @@ struct BalancerConfig
     std::unordered_map<std::string, OpOverride> op_overrides;
     std::vector<std::vector<std::string>> op_names_to_epoch_break;
     std::vector<std::vector<std::string>> op_names_to_chip_break;
+    // Subset of op_names_to_chip_break given by the user, if the rest was placed by the chip placement policy.
+    // Unset means all of them are user-given.
+    std::optional<std::vector<std::vector<std::string>>> user_op_names_to_chip_break;
     placer::OpToChipIdAssignment op_to_chip_id_assignment;
     std::unordered_map<std::string, placer::PlacerOpOverride> op_name_to_placer_overrides;
     bool enable_auto_transposing_placement;
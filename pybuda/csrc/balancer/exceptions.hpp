@@ -115,13 +115,23 @@ struct BalancerError : public std::exception
         Fatal(const std::string& message) : message(message) {}
     };
 
+    // Several independent, fixable errors found in the same balancer pass, so that their graph fixups can be
+    // applied together before balancing again
+    struct Multiple
+    {
+        std::vector<BalancerError> errors;
+
+        Multiple(std::vector<BalancerError>&& errors) : errors(std::move(errors)) {}
+    };
+
     using Type = std::variant<
         std::monostate,
         NodeExceedsMaxOpForks,
         InputBroadcastExceedsMaxGridForks,
         DRAMWriterNOPNeeded,
         NoValidGrid,
-        Fatal>;
+        Fatal,
+        Multiple>;
 
     std::string message;
     Type type;
@@ -11,6 +11,7 @@
 #include "graph_lib/node.hpp"
 #include "graph_lib/node_types.hpp"
 #include "reportify/reportify.hpp"
+#include "shared_utils/instrumentation.hpp"
 #include "utils/assert.hpp"
 
 namespace tt::balancer::legalizer
@@ -131,6 +132,34 @@ static std::uint64_t get_op_model_pair_id(const std::uint64_t prod_om_id, const
     return (size_t(prod_om_id) << 32llu) | size_t(cons_om_id);
 }
 
+// OpModel id that an OpModel of a repeated block op was copied from, or its own id.
+//
+static std::uint64_t get_op_model_prototype_id(
+    std::unordered_map<std::uint64_t, std::uint64_t> const& op_model_prototypes, std::uint64_t op_model_id)
+{
+    auto match = op_model_prototypes.find(op_model_id);
+    return match == op_model_prototypes.end() ? op_model_id : match->second;
+}
+
+// Everything an op-to-op constraint check reads from the graph, besides the OpModels on both ends of the edge.
+//
+static std::string get_repeated_block_edge_signature(graphlib::Graph const* graph, graphlib::Edge const& edge)
+{
+    auto edge_attrs = graph->get_edge_attributes(edge);
+    std::stringstream ss;
+    ss << edge.producer_output_port_id << ">" << edge.consumer_input_port_id << ":" << edge_attrs->get_ublock_order()
+       << ":";
+    for (graphlib::OpType const& tm : edge_attrs->get_tms()) ss << tm.as_string() << ";";
+
+    // Sibling edges between the same pair of nodes are double counted on all but the lowest port
+    graphlib::PortId smallest_port_id = edge.consumer_input_port_id;
+    for (graphlib::Edge const& operand : graph->operand_data_edges(graph->node_by_id(edge.consumer_node_id)))
+        if (operand.producer_node_id == edge.producer_node_id)
+            smallest_port_id = std::min(smallest_port_id, operand.consumer_input_port_id);
+    ss << smallest_port_id << ":" << graph->user_data_edges(graph->node_by_id(edge.producer_node_id)).size();
+    return ss.str();
+}
+
 bool GraphSolver::resolve_step(const bool self_cut_allowed)
 {
 #ifdef DEBUG
@@ -210,6 +239,19 @@ bool GraphSolver::resolve_step(const bool self_cut_allowed)
             std::uint64_t consumer_count = std::min(kNumBitsetBits, std::max(1lu, consumer_op_models.size()));
             bool cacheable = producer_node->node_type() == graphlib::NodeType::kBudaOp and
                              consumer_node->node_type() == graphlib::NodeType::kBudaOp;
+
+            // Ops of repeated blocks share OpModels with their prototypes (see legalizer), so they also share
+            // constraint results for edges with the same signature
+            SharedData::ConstraintResultCache* constraint_result_cache = &shared_data->constraint_result_cache;
+            std::unordered_map<std::uint64_t, std::uint64_t> const* op_model_prototypes = nullptr;
+            if (cacheable and balancer_cache_collection and not balancer_cache_collection->op_model_prototypes.empty())
+            {
+                op_model_prototypes = &balancer_cache_collection->op_model_prototypes;
+                constraint_result_cache =
+                    &shared_data->repeated_block_constraint_result_cache[get_repeated_block_edge_signature(graph, edge)];
+            }
+            std::int64_t constraint_cache_hits = 0;
+            std::int64_t constraint_cache_misses = 0;
             for (std::uint64_t producer_id = 0; producer_id < producer_count; ++producer_id)
             {
                 // If the producer cannot accomodate this path, continue.
@@ -237,23 +279,31 @@ bool GraphSolver::resolve_step(const bool self_cut_allowed)
 
                     if (cacheable)
                     {
-                        pair_id = get_op_model_pair_id(
-                            producer_op_models[producer_id].id.id, consumer_op_models[consumer_id].id.id);
-                        cache_it = shared_data->constraint_result_cache.find(pair_id);
+                        std::uint64_t producer_om_id = producer_op_models[producer_id].id.id;
+                        std::uint64_t consumer_om_id = consumer_op_models[consumer_id].id.id;
+                        if (op_model_prototypes)
+                        {
+                            producer_om_id = get_op_model_prototype_id(*op_model_prototypes, producer_om_id);
+                            consumer_om_id = get_op_model_prototype_id(*op_model_prototypes, consumer_om_id);
+                        }
+                        pair_id = get_op_model_pair_id(producer_om_id, consumer_om_id);
+                        cache_it = constraint_result_cache->find(pair_id);
                     }
 
-                    if (!cacheable or cache_it == shared_data->constraint_result_cache.end())
+                    if (!cacheable or cache_it == constraint_result_cache->end())
                     {
                         std::tie(cost, constraint_failure_reason) = cost_fn(
                             constraint, graph, edge, producer_op_models, consumer_op_models, producer_id, consumer_id);
                         if (cacheable)
                         {
-                            shared_data->constraint_result_cache.try_emplace(pair_id, cost, constraint_failure_reason);
+                            constraint_result_cache->try_emplace(pair_id, cost, constraint_failure_reason);
+                            constraint_cache_misses++;
                         }
                     }
                     else
                     {
                         std::tie(cost, constraint_failure_reason) = cache_it->second;
+                        constraint_cache_hits++;
                     }
 
                     if (NoConstraintFailure == constraint_failure_reason)
@@ -285,6 +335,8 @@ bool GraphSolver::resolve_step(const bool self_cut_allowed)
 #endif
                 }
             }
+            INSTRUMENT_COUNTER_ADD("balancer.constraint_cache_hits", constraint_cache_hits);
+            INSTRUMENT_COUNTER_ADD("balancer.constraint_cache_misses", constraint_cache_misses);
 
 #ifdef DEBUG
             if (enable_legalizer_detailed_debugging)
@@ -544,6 +596,7 @@ bool GraphSolver::self_cut(graphlib::Node* producer_node, graphlib::Node* consum
 void GraphSolver::resolve(bool partial_reset_allowed)
 {
     PROFILE_SCOPE();
+    INSTRUMENT_SCOPE("graph_solver_resolve", "balancer");
     graphlib::GraphTraversalContext graph_solver_graph_context(graph, &virtual_nodes, &edges_to_ignore);
     int default_resolve_retry_count_self_cutting = 20;
     if (env_as<int>("PYBUDA_MAX_GRAPH_CUT_RETRY", 0))
@@ -393,9 +393,14 @@ class GraphSolver
     struct SharedData
     {
        public:
+        using ConstraintResultCache =
+            std::unordered_map<std::uint64_t, const std::pair<const EdgeCost, const ConstraintFailureReason>>;
+
         std::unique_ptr<Constraint> constraint;
-        std::unordered_map<std::uint64_t, const std::pair<const EdgeCost, const ConstraintFailureReason>>
-            constraint_result_cache;
+        ConstraintResultCache constraint_result_cache;
+        // Constraint results between repeated block ops, keyed by edge signature and then by the pair of prototype
+        // OpModels, so all instances of an edge in a stack of identical blocks share one set of results.
+        std::unordered_map<std::string, ConstraintResultCache> repeated_block_constraint_result_cache;
 
        private:
         LegalOpModels legal_op_models;
@@ -19,6 +19,7 @@
 #include "passes/fuse_ops.hpp"
 #include "passes/print_graph.hpp"
 #include "passes/t_stream.hpp"
+#include "shared_utils/instrumentation.hpp"
 #include "shared_utils/sparse_matmul_utils.hpp"
 #include "utils/logger.hpp"
 
@@ -2420,9 +2421,112 @@ std::pair<OpModel, OpModelFailureReason> calculate_op_model(
     return std::make_pair(op_model, failure_reason);
 }
 
+static void fingerprint_op_type(std::ostream& os, graphlib::OpType const& op_type)
+{
+    using tt::operator<<;
+    os << op_type.as_string();
+    for (auto const& [name, value] : op_type.buda_attrs) os << "," << name << ":" << value;
+    os << ";";
+}
+
+// Everything legal OpModels of a node are derived from: the node itself, its operand and user edges (with TMs) and
+// the nodes directly on the other side of them. If two fingerprints of a node match, so do its legal OpModels.
+//
+// The structural variant leaves out node identity, so it's equal for isomorphic nodes of repeated blocks (i.e. the
+// same op in each layer of a transformer stack). Neighbours are then described by what they are instead of which node
+// they are, which also verifies the block boundary: the first and last instance of a block usually differ from the
+// rest by what feeds or consumes them. Tags the legalizer reads (padding_nop on the node itself turns off its
+// t-streaming, on a user turns off streaming into it) are part of both variants.
+//
+static std::string legal_op_models_fingerprint(
+    Graph const* graph, graphlib::BudaOpNode const* op_node, bool structural = false)
+{
+    std::stringstream ss;
+    if (not structural)
+        ss << op_node->id() << "|" << op_node->name() << "|";
+    fingerprint_op_type(ss, op_node->op_type());
+    ss << op_node->shape() << "|" << (int)op_node->output_df() << "," << (int)op_node->accumulate_df() << ","
+       << (int)op_node->intermediate_df() << "," << (int)op_node->math_fidelity() << ","
+       << (int)op_node->get_epoch_type() << "," << op_node->is_fused_op() << "," << op_node->is_buffering_op() << ","
+       << op_node->as<graphlib::TaggedNode>()->has_tag("padding_nop");
+
+    auto fingerprint_edge = [graph, structural, &ss](graphlib::Edge const& edge, graphlib::Node const* other)
+    {
+        auto edge_attrs = graph->get_edge_attributes(edge);
+        ss << "|" << edge.producer_output_port_id << ">" << edge.consumer_input_port_id << ":";
+        if (not structural)
+            ss << other->id();
+        else if (other->node_type() == graphlib::NodeType::kBudaOp)
+            fingerprint_op_type(ss, other->as<graphlib::BudaOpNode>()->op_type());
+        ss << "," << other->node_type() << "," << other->shape() << "," << (int)other->output_df() << ","
+           << edge_attrs->get_ublock_order() << "," << other->as<graphlib::TaggedNode>()->has_tag("padding_nop") << ",";
+        for (graphlib::OpType const& tm : edge_attrs->get_tms()) fingerprint_op_type(ss, tm);
+        if (other->node_type() == graphlib::NodeType::kInput)
+        {
+            ss << other->as<graphlib::InputNode>()->input_type();
+            if (structural)
+                ss << "," << other->as<graphlib::InputNode>()->is_prologue();
+        }
+        if (structural)
+            ss << "," << graph->operand_data_edges(other).size() << "," << graph->user_data_edges(other).size();
+    };
+
+    for (graphlib::Edge const& edge : graph->operand_data_edges(op_node))
+        fingerprint_edge(edge, graph->node_by_id(edge.producer_node_id));
+    for (graphlib::Edge const& edge : graph->user_data_edges(op_node))
+        fingerprint_edge(edge, graph->node_by_id(edge.consumer_node_id));
+
+    return ss.str();
+}
+
+// Copy legal OpModels of a repeated block op onto its isomorphic instance. Copies get their own ids, and are recorded
+// as prototypes in cache_collection so the GraphSolver can share constraint results between them.
+//
+static std::vector<OpModel> clone_legal_op_models(
+    Graph const* graph,
+    std::vector<OpModel> const& prototype_op_models,
+    graphlib::BudaOpNode const* prototype,
+    graphlib::BudaOpNode const* op_node,
+    BalancerCacheCollection& cache_collection)
+{
+    std::vector<graphlib::Edge> prototype_users = graph->user_data_edges(prototype);
+    std::vector<graphlib::Edge> users = graph->user_data_edges(op_node);
+    TT_ASSERT(prototype_users.size() == users.size());
+
+    std::vector<OpModel> op_models = prototype_op_models;
+    for (std::size_t i = 0; i < op_models.size(); i++)
+    {
+        OpModel& op_model = op_models[i];
+        op_model.id = UniqueId();
+        op_model.buda_op_node = op_node;
+
+        std::unordered_map<graphlib::NodeId, TensorShape> effective_input_buffer_shape_for_user;
+        for (std::size_t u = 0; u < users.size(); u++)
+        {
+            auto match = op_model.effective_input_buffer_shape_for_user.find(prototype_users[u].consumer_node_id);
+            if (match != op_model.effective_input_buffer_shape_for_user.end())
+                effective_input_buffer_shape_for_user[users[u].consumer_node_id] = match->second;
+        }
+        op_model.effective_input_buffer_shape_for_user = std::move(effective_input_buffer_shape_for_user);
+
+        std::uint64_t prototype_id = prototype_op_models[i].id.id;
+        auto prototype_of_prototype = cache_collection.op_model_prototypes.find(prototype_id);
+        if (prototype_of_prototype != cache_collection.op_model_prototypes.end())
+            prototype_id = prototype_of_prototype->second;
+        cache_collection.op_model_prototypes[op_model.id.id] = prototype_id;
+    }
+    return op_models;
+}
+
 // Calculate legal OpModels for a graph.
 // Optionally override can be passed in via nodes_to_legalize to only calculate OpModels for specified set of nodes.
 //
+// When legalizing the whole graph, OpModels are cached in cache_collection and reused on the next call for nodes
+// whose fingerprint didn't change, i.e. for all nodes untouched by graph fixups between balancer attempts.
+//
+// Within a call, only the first instance of each repeated block op is legalized, the rest get copies of its OpModels,
+// so legalization of deep models scales with the number of unique ops rather than with depth.
+//
 LegalOpModels get_legal_op_models(
     Graph const* graph,
     BalancerConfig const& config,
@@ -2430,6 +2534,7 @@ LegalOpModels get_legal_op_models(
     std::unordered_set<graphlib::Node*>* nodes_to_legalize)
 {
     PROFILE_SCOPE();
+    INSTRUMENT_SCOPE("get_legal_op_models", "balancer");
 #ifdef DEBUG
     BudaOpNodeLegalizerFailureInfo op_graph_debug_info;
     bool enable_legalizer_detailed_debugging = env_as<bool>("PYBUDA_LEGALIZER_DETAILED_DEBUGGING");
@@ -2438,6 +2543,10 @@ LegalOpModels get_legal_op_models(
 
     std::unordered_map<Node*, const BudaOpNodeLegalizerFailureInfo> nodes_without_legal_op_model;
     LegalOpModels valid_op_models;
+    bool reuse_legal_op_models = nullptr == nodes_to_legalize and cache_collection != nullptr and
+                                 not env_as<bool>("PYBUDA_DISABLE_LEGAL_OP_MODEL_REUSE");
+    bool reuse_repeated_blocks = cache_collection != nullptr and not env_as<bool>("PYBUDA_DISABLE_REPEATED_BLOCK_REUSE");
+    std::unordered_map<std::string, graphlib::BudaOpNode const*> repeated_block_prototypes;
     FactorizedShape device_grid(
         FactorizedInt::Factorial(config.device_config.grid_size.r),
         FactorizedInt::Factorial(config.device_config.grid_size.c));
@@ -2466,6 +2575,58 @@ LegalOpModels get_legal_op_models(
             continue;
         }
 
+        // Sparse matmul op models point into the sparse tensor of their operand, so they're always recalculated
+        bool reuse_node_op_models = reuse_legal_op_models and not op_node->is_sparse_matmul();
+
+        // Ops with per-node overrides aren't interchangeable with their isomorphic instances, and fused ops carry
+        // per-node sub-op names in their OpModels
+        bool repeated_block_op = reuse_repeated_blocks and not op_node->is_sparse_matmul() and
+                                 not op_node->is_fused_op() and not config.get_op_override(node->name());
+        std::string structural_fingerprint;
+        if (repeated_block_op)
+            structural_fingerprint = legal_op_models_fingerprint(graph, op_node, true /*structural*/);
+
+        std::string fingerprint;
+        if (reuse_node_op_models)
+        {
+            fingerprint = legal_op_models_fingerprint(graph, op_node);
+            auto cached = cache_collection->legal_op_models_cache.find(node->id());
+            if (cached != cache_collection->legal_op_models_cache.end() and cached->second.fingerprint == fingerprint)
+            {
+                log_debug(
+                    LogBalancer,
+                    "Reusing {} legal op models for node: {}",
+                    cached->second.op_models.size(),
+                    node->name());
+                INSTRUMENT_COUNTER_ADD("balancer.op_models_reused", cached->second.op_models.size());
+                valid_op_models.emplace(node, cached->second.op_models);
+                if (repeated_block_op)
+                    repeated_block_prototypes.emplace(std::move(structural_fingerprint), op_node);
+                continue;
+            }
+        }
+
+        if (repeated_block_op)
+        {
+            auto prototype = repeated_block_prototypes.find(structural_fingerprint);
+            if (prototype != repeated_block_prototypes.end())
+            {
+                std::vector<OpModel> op_models = clone_legal_op_models(
+                    graph, valid_op_models.at(prototype->second), prototype->second, op_node, *cache_collection);
+                log_debug(
+                    LogBalancer,
+                    "Reusing {} legal op models of repeated block op {} for node: {}",
+                    op_models.size(),
+                    prototype->second->name(),
+                    node->name());
+                if (reuse_node_op_models)
+                    cache_collection->legal_op_models_cache[node->id()] = {std::move(fingerprint), op_models};
+                INSTRUMENT_COUNTER_ADD("balancer.op_models_reused", op_models.size());
+                valid_op_models.emplace(node, std::move(op_models));
+                continue;
+            }
+        }
+
         BudaOpNodeLegalizerFailureInfo failure_info;
 
 #ifdef DEBUG
@@ -2678,12 +2839,20 @@ LegalOpModels get_legal_op_models(
 #endif
 
         log_debug(LogBalancer, "Total op models for node: {} {}", node->name(), valid_grids.size());
+        INSTRUMENT_COUNTER_ADD("balancer.op_models_legalized", valid_grids.size());
         if (valid_grids.empty())
         {
             nodes_without_legal_op_model.emplace(node, failure_info);
             log_warning(
                 LogBalancer, "No valid grids found for node: {} {} {}", node->name(), node->get_type(), node->shape());
         }
+        else
+        {
+            if (reuse_node_op_models)
+                cache_collection->legal_op_models_cache[node->id()] = {std::move(fingerprint), valid_grids};
+            if (repeated_block_op)
+                repeated_block_prototypes.emplace(std::move(structural_fingerprint), op_node);
+        }
         valid_op_models.emplace(node, valid_grids);
     }
 
@@ -3050,6 +3219,7 @@ static void resolve_input_queue_block_shapes(Graph const* graph, BalancerConfig
 std::tuple<OpModelMap, BlockShapeMap, OutputHostTMMap, CutEdges> resolve_block_shapes(
     Graph const* graph, BalancerConfig const& config, GraphSolverSolution const& graph_solver_solution)
 {
+    INSTRUMENT_SCOPE("resolve_block_shapes", "balancer");
     log_debug(LogBalancer, "Resolve block shapes:");
     OpModelMap op_models;
     OutputHostTMMap output_host_tms;
@@ -10,6 +10,7 @@
 #include "balancer/policies/policy_nlp.hpp"
 #include "balancer/policies/policy_random.hpp"
 #include "balancer/policies/policy_ribbon.hpp"
+#include "shared_utils/instrumentation.hpp"
 
 using Graph = tt::graphlib::Graph;
 using Node = tt::graphlib::Node;
@@ -25,6 +26,7 @@ legalizer::GraphSolverSolution run_policy(
     legalizer::GraphSolver &graph_solver,
     std::optional<placer::PlacerSolution> &placer_solution)
 {
+    INSTRUMENT_SCOPE("run_policy", "balancer");
     TT_ASSERT(
         !config.use_interactive_placer or can_use_interactive_placer(config.policy_type),
         "Interactive_placer is not currently supported by this policy!");
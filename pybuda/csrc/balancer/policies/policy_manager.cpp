@@ -110,7 +110,7 @@ std::tuple<bool, bool, bool> PolicyManager::commit_op(const OpModel& selected_op
         if (!skip_op_place)
         {
             op_placement = interactive_placer.place_op(
-                op->name(),
+                op,
                 selected_op_model.grid_shape,
                 try_transpose_op /* enable_transpose */,
                 chip_break_ops.find(op->name()) != chip_break_ops.end() /* chip_break */);
@@ -195,9 +195,9 @@ void PolicyManager::pair_two_ops_if_possible(
         //
         if (can_fit_on_single_epoch(
                 interactive_placer_tester,
-                buffered_op_model->buda_op_node->name(),
+                buffered_op_model->buda_op_node,
                 buffered_op_model->grid_shape,
-                op->name(),
+                op,
                 selected_op_model.grid_shape,
                 try_transpose_op))
         {
@@ -213,9 +213,9 @@ void PolicyManager::pair_two_ops_if_possible(
                     try_transpose_op /* allow_transpose */))
             {
                 op_placement = interactive_placer.place_two_ops_rowwise(
-                    buffered_op_model->buda_op_node->name(),
+                    buffered_op_model->buda_op_node,
                     buffered_op_model->grid_shape,
-                    op->name(),
+                    op,
                     selected_op_model.grid_shape,
                     try_transpose_op, /* enable_transpose */
                     chip_break_ops.find(op->name()) != chip_break_ops.end() /* chip_break */
@@ -237,7 +237,7 @@ void PolicyManager::pair_two_ops_if_possible(
             else
             {
                 op_placement = interactive_placer.place_op(
-                    buffered_op_model->buda_op_node->name(),
+                    buffered_op_model->buda_op_node,
                     buffered_op_model->grid_shape,
                     try_transpose_op /* enable_transpose */,
                     chip_break_ops.find(op->name()) != chip_break_ops.end() /* chip_break */);
@@ -245,7 +245,7 @@ void PolicyManager::pair_two_ops_if_possible(
                 if (op_placement.has_value())
                 {
                     op_placement = interactive_placer.place_op(
-                        op->name(),
+                        op,
                         selected_op_model.grid_shape,
                         try_transpose_op /* enable_transpose */,
                         false /* chip_break */);
@@ -266,7 +266,7 @@ void PolicyManager::pair_two_ops_if_possible(
                         // Revert buffered op placement as paired op placement failed. We dont want them in separate
                         // epochs.
                         //
-                        interactive_placer.rewind_to(buffered_op_model->buda_op_node->name());
+                        interactive_placer.rewind_to(buffered_op_model->buda_op_node);
                     }
                 }
             }
@@ -280,7 +280,7 @@ void PolicyManager::pair_two_ops_if_possible(
             // Place only buffered one.
             //
             op_placement = interactive_placer.place_op(
-                buffered_op_model->buda_op_node->name(),
+                buffered_op_model->buda_op_node,
                 buffered_op_model->grid_shape,
                 try_transpose_op /* enable_transpose */,
                 chip_break_ops.find(op->name()) != chip_break_ops.end() /* chip_break */);
@@ -371,14 +371,14 @@ RibbonSolution optimize_solution(
                     graph, op.op, op.model, next_op->op, next_op->model, interactive_placer, true /*allow_transpose*/))
             {
                 op_placement = interactive_placer.place_two_ops_rowwise(
-                    op.op->name(), op.model.grid_shape, next_op->op->name(), next_op->model.grid_shape, true);
+                    op.op, op.model.grid_shape, next_op->op, next_op->model.grid_shape, true);
 
                 placing_step = 2;
                 i++;
             }
             else
             {
-                op_placement = interactive_placer.place_op(op.op->name(), op.model.grid_shape, true);
+                op_placement = interactive_placer.place_op(op.op, op.model.grid_shape, true);
             }
 
             if (op_placement.has_value())
@@ -656,9 +656,9 @@ bool apply_solution(
             {
                 sparse_dense_pair = true;
                 op_placement = interactive_placer.place_two_ops_rowwise(
-                    op->name(),
+                    op,
                     it->second.model.grid_shape,
-                    dense_matmul_op->name(),
+                    dense_matmul_op,
                     it_dense->second.model.grid_shape,
                     true);
 
@@ -675,8 +675,7 @@ bool apply_solution(
 
         if (!sparse_dense_pair)
         {
-            op_placement =
-                interactive_placer.place_op(scheduled_ops[placed_op_index], it->second.model.grid_shape, true);
+            op_placement = interactive_placer.place_op(op, it->second.model.grid_shape, true);
         }
 
         TT_ASSERT(op_placement.has_value(), "Failed to re-place the solution on op {}", scheduled_ops[placed_op_index]);
@@ -920,9 +919,9 @@ legalizer::GraphSolverSolution run_policy_ribbon2(
                                     {
                                         sparse_dense_pair = true;
                                         op_placement = interactive_placer.place_two_ops_rowwise(
-                                            op->name(),
+                                            op,
                                             selected_op_model.grid_shape,
-                                            dense_matmul_op->name(),
+                                            dense_matmul_op,
                                             selected_op_model_dense.grid_shape,
                                             true);
                                     }
@@ -930,19 +929,19 @@ legalizer::GraphSolverSolution run_policy_ribbon2(
                                     //
                                     else if (can_fit_on_single_epoch(
                                                  ip_fittment_tester,
-                                                 op->name(),
+                                                 op,
                                                  selected_op_model.grid_shape,
-                                                 dense_matmul_op->name(),
+                                                 dense_matmul_op,
                                                  selected_op_model_dense.grid_shape))
                                     {
                                         sparse_dense_pair = true;
                                         op_placement = interactive_placer.place_op(
-                                            op->name(), selected_op_model.grid_shape, true /* enable_transpose */);
+                                            op, selected_op_model.grid_shape, true /* enable_transpose */);
 
                                         if (op_placement.has_value())
                                         {
                                             op_placement = interactive_placer.place_op(
-                                                dense_matmul_op->name(),
+                                                dense_matmul_op,
                                                 selected_op_model_dense.grid_shape,
                                                 true /* enable_transpose */);
                                         }
@@ -964,7 +963,7 @@ legalizer::GraphSolverSolution run_policy_ribbon2(
 
                         if (!sparse_dense_pair)
                         {
-                            op_placement = interactive_placer.place_op(op->name(), selected_op_model.grid_shape, true);
+                            op_placement = interactive_placer.place_op(op, selected_op_model.grid_shape, true);
                         }
 
                         new_epoch = !op_placement.has_value() || (op_index == scheduled_ops.size() - 1);
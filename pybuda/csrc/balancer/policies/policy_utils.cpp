@@ -423,11 +423,14 @@ void cut_graph_solver_epoch(
 {
     // Only cut edges from ops that have been placed already
     balancer::CutEdges const &already_cut_edges = graph_solver.get_cut_edges();
-    std::vector<std::string> const &current_epoch_ops = placer.current_epoch_ops();
+    std::vector<const graphlib::Node *> const &current_epoch_ops = placer.current_epoch_ops();
+    std::unordered_set<graphlib::NodeId> current_epoch_op_ids;
+    for (const graphlib::Node *op : current_epoch_ops) current_epoch_op_ids.insert(op->id());
+
     std::vector<graphlib::Edge> edges_to_cut;
-    for (auto const &op_name : current_epoch_ops)
+    for (const graphlib::Node *op : current_epoch_ops)
     {
-        for (auto const &edge : graph->user_data_edges(graph->get_node_by_name(op_name)))
+        for (auto const &edge : graph->user_data_edges(op))
         {
             auto *user = graph->node_by_id(edge.consumer_node_id);
             if (user->node_type() != graphlib::NodeType::kBudaOp)
@@ -436,7 +439,7 @@ void cut_graph_solver_epoch(
             if (already_cut_edges.find(edge) != already_cut_edges.end())
                 continue;
 
-            if (std::find(current_epoch_ops.begin(), current_epoch_ops.end(), user->name()) != current_epoch_ops.end())
+            if (current_epoch_op_ids.count(user->id()) > 0)
                 continue;
 
             edges_to_cut.push_back(edge);
@@ -541,7 +544,7 @@ void cut_graph_solver_ribbon(
     std::vector<graphlib::Edge> edges_to_cut;
     for (auto &edge : graph->operand_data_edges(op))
     {
-        if (placer.op_placed(graph->node_by_id(edge.producer_node_id)->name()) && pre_cut_edges.count(edge) == 0)
+        if (placer.op_placed(graph->node_by_id(edge.producer_node_id)) && pre_cut_edges.count(edge) == 0)
         {
             edges_to_cut.push_back(edge);
         }
@@ -841,20 +844,20 @@ bool validate_sparse_matmul_model(
 
 bool can_fit_on_single_epoch(
     tt::placer::InteractivePlacer &ip_fittment_tester,
-    const std::string &op_name_1,
+    const graphlib::Node *op_1,
     const tt::balancer::GridShape &op_shape_1,
-    const std::string &op_name_2,
+    const graphlib::Node *op_2,
     const tt::balancer::GridShape &op_shape_2,
     bool enable_transpose)
 {
     TT_ASSERT(ip_fittment_tester.current_epoch_empty(), "Test placer epoch must be empty!");
     std::optional<placer::CoordRange> test_placement;
 
-    test_placement = ip_fittment_tester.place_op(op_name_1, op_shape_1, enable_transpose);
+    test_placement = ip_fittment_tester.place_op(op_1, op_shape_1, enable_transpose);
 
     TT_ASSERT(test_placement.has_value(), "Single op must always fit!");
 
-    test_placement = ip_fittment_tester.place_op(op_name_2, op_shape_2, enable_transpose);
+    test_placement = ip_fittment_tester.place_op(op_2, op_shape_2, enable_transpose);
 
     ip_fittment_tester.rewind_epoch();
     return test_placement.has_value();
@@ -202,9 +202,9 @@ bool validate_sparse_matmul_model(
 
 bool can_fit_on_single_epoch(
     tt::placer::InteractivePlacer& ip_fittment_tester,
-    const std::string& op_name_1,
+    const graphlib::Node* op_1,
     const tt::balancer::GridShape& op_shape_1,
-    const std::string& op_name_2,
+    const graphlib::Node* op_2,
     const tt::balancer::GridShape& op_shape_2,
     bool enable_transpose = true);
 
@@ -10,6 +10,7 @@
 #include "balancer/policies/policy_utils.hpp"
 #include "balancer/python_interface.hpp"
 #include "balancer/balancer_utils.hpp"
+#include "graph_lib/op_registry.hpp"
 #include "graph_lib/utils.hpp"
 #include "placer/placer.hpp"
 #include "passes/fuse_ops.hpp"
@@ -164,6 +165,7 @@ void BalancerModule(py::module &m_balancer) {
     py::enum_<tt::placer::ChipPlacementPolicy>(m_balancer, "ChipPlacementPolicy")
         .value("MMIO_LAST", tt::placer::ChipPlacementPolicy::MMIO_LAST)
         .value("SNAKE", tt::placer::ChipPlacementPolicy::SNAKE)
+        .value("MIN_TRAFFIC", tt::placer::ChipPlacementPolicy::MIN_TRAFFIC)
         .export_values();
 
     py::enum_<legalizer::GraphSolverSelfCutType>(m_balancer, "GraphSolverSelfCutType")
@@ -234,6 +236,7 @@ void BalancerModule(py::module &m_balancer) {
         .def_readwrite("op_overrides", &BalancerConfig::op_overrides)
         .def_readwrite("op_names_to_epoch_break", &BalancerConfig::op_names_to_epoch_break)
         .def_readwrite("op_names_to_chip_break", &BalancerConfig::op_names_to_chip_break)
+        .def_readwrite("user_op_names_to_chip_break", &BalancerConfig::user_op_names_to_chip_break)
         .def_readwrite("op_names_to_chip_id_assignment", &BalancerConfig::op_names_to_chip_break)
         .def_readwrite("op_name_to_placer_overrides", &BalancerConfig::op_name_to_placer_overrides)
         .def_readwrite("enable_auto_transposing_placement", &BalancerConfig::enable_auto_transposing_placement)
@@ -479,8 +482,16 @@ namespace tt::balancer
 std::pair<int, int> get_parallelization(
     Graph const* graph, OpNode const* node, int fracture_factor, bool sparse_buffer_enable)
 {
-    auto eval_module = py::module_::import("pybuda.op.eval.buda");
-    py::function pybuda_parallelization = eval_module.attr("get_f_pybuda_parallelization")(node->op_type_ptr());
+    auto pybuda_parallelization = [node](OpShape const& op_shape, int fracture_factor)
+    {
+        if (auto parallelization = graphlib::get_builtin_op_parallelization(
+                node->op_type(), op_shape.outputs[0].rt, op_shape.outputs[0].ct, fracture_factor))
+            return *parallelization;
+
+        auto eval_module = py::module_::import("pybuda.op.eval.buda");
+        py::function parallelization = eval_module.attr("get_f_pybuda_parallelization")(node->op_type_ptr());
+        return parallelization(op_shape, fracture_factor).cast<std::pair<int, int>>();
+    };
 
     auto op_shape = get_op_shape(graph, node);
     if ( (node->node_type() == graphlib::kBudaOp) && node->as<graphlib::BudaOpNode>()->is_fused_op())
@@ -524,11 +535,11 @@ std::pair<int, int> get_parallelization(
     {
         int bcast_factor =
             graph->data_operands(node)[0]->as<graphlib::ConstantInputNode>()->get_sparse_buda().bcast_factor;
-        auto [r, c] = pybuda_parallelization(op_shape, fracture_factor).cast<std::pair<int, int>>();
+        auto [r, c] = pybuda_parallelization(op_shape, fracture_factor);
         TT_ASSERT((r % bcast_factor) == 0);
         return std::make_pair(r / bcast_factor, c);
     }
-    return pybuda_parallelization(op_shape, fracture_factor).cast<std::pair<int, int>>();
+    return pybuda_parallelization(op_shape, fracture_factor);
 }
 
 int get_execution_cycles(std::string const& arch_name, OpModel const& op_model, bool theoretical, std::vector<FusedSubOpModel> const& sub_op_models)
@@ -17,14 +17,23 @@ using namespace balancer;
 
 struct InteractivePlacerSanity : testing::Test
 {
+    // Graph of unconnected ops with the given names, interactive placer takes ops as graph nodes.
+    std::unique_ptr<graphlib::Graph> create_graph_with_ops(const std::map<std::string, placer::GridShape>& op_to_grid_shape)
+    {
+        auto graph = std::make_unique<graphlib::Graph>(graphlib::IRLevel::IR_BUDA);
+        for (const auto& [op_name, grid_shape] : op_to_grid_shape)
+        {
+            graph->add_node(graphlib::create_node<graphlib::BudaOpNode>(op_name, "nop"), 0 /*subgraph_id*/);
+        }
+        return graph;
+    }
 };
 
-// Unit test for InteractivePlacer::rewind_to(const std::string &op_name).
+// Unit test for InteractivePlacer::rewind_to(const graphlib::Node *op).
 //
 TEST_F(InteractivePlacerSanity, rewind_to)
 {
     balancer::BalancerConfig balancer_config = create_balancer_config();
-    placer::InteractivePlacer interactive_placer(nullptr /*graph*/, balancer_config);
     std::map<std::string, placer::GridShape> op_to_grid_shape = {
         {"op1", placer::GridShape(1, 1)},
         {"op2", placer::GridShape(1, 10)},
@@ -34,6 +43,8 @@ TEST_F(InteractivePlacerSanity, rewind_to)
         {"op6_pair1", placer::GridShape(5, 2)},
         {"op7_pair2", placer::GridShape(5, 2)},
         {"op8", placer::GridShape(3, 3)}};
+    std::unique_ptr<graphlib::Graph> graph = create_graph_with_ops(op_to_grid_shape);
+    placer::InteractivePlacer interactive_placer(graph.get(), balancer_config);
 
     std::optional<std::pair<std::string, placer::GridShape>> buffered_op;
     std::optional<placer::CoordRange> op_placement;
@@ -49,12 +60,17 @@ TEST_F(InteractivePlacerSanity, rewind_to)
         if (buffered_op.has_value())
         {
             op_placement = interactive_placer.place_two_ops_rowwise(
-                buffered_op->first, buffered_op->second, to_place.first, to_place.second, true /* enable_transpose */);
+                graph->get_node_by_name(buffered_op->first),
+                buffered_op->second,
+                graph->get_node_by_name(to_place.first),
+                to_place.second,
+                true /* enable_transpose */);
             buffered_op.reset();
         }
         else
         {
-            op_placement = interactive_placer.place_op(to_place.first, to_place.second, true /* enable_transpose */);
+            op_placement = interactive_placer.place_op(
+                graph->get_node_by_name(to_place.first), to_place.second, true /* enable_transpose */);
         }
 
         ASSERT_TRUE(op_placement.has_value());
@@ -64,7 +80,7 @@ TEST_F(InteractivePlacerSanity, rewind_to)
     //
     std::unordered_map<std::string, placer::OpPlacement> pre_rewind_placements =
         interactive_placer.get_current_name_to_op_placement();
-    interactive_placer.rewind_to(std::prev(op_to_grid_shape.end())->first);
+    interactive_placer.rewind_to(graph->get_node_by_name(std::prev(op_to_grid_shape.end())->first));
 
     // Verify that user overrides are preserved after rewind.
     //
@@ -92,13 +108,14 @@ TEST_F(InteractivePlacerSanity, chip_id_override)
 {
     const std::vector<std::uint32_t> chip_ids = {0, 1, 2, 3};
     balancer::BalancerConfig balancer_config = create_balancer_config(Arch::Wormhole_b0, chip_ids, balancer::PolicyType::Ribbon);
-    placer::InteractivePlacer interactive_placer(nullptr /*graph*/, balancer_config);
     std::map<std::string, placer::GridShape> op_to_grid_shape = {
         {"op1", placer::GridShape(8, 8)},
         {"op2", placer::GridShape(8, 8)},
         {"op3", placer::GridShape(8, 8)},
         {"op4", placer::GridShape(8, 8)},
     };
+    std::unique_ptr<graphlib::Graph> graph = create_graph_with_ops(op_to_grid_shape);
+    placer::InteractivePlacer interactive_placer(graph.get(), balancer_config);
 
     interactive_placer.get_op_overrides()["op1"].chip_id = 3;
     interactive_placer.get_op_overrides()["op2"].chip_id = 2;
@@ -106,7 +123,8 @@ TEST_F(InteractivePlacerSanity, chip_id_override)
 
     for (const auto& to_place : op_to_grid_shape)
     {
-        std::optional<placer::CoordRange> op_placement = interactive_placer.place_op(to_place.first, to_place.second);
+        std::optional<placer::CoordRange> op_placement =
+            interactive_placer.place_op(graph->get_node_by_name(to_place.first), to_place.second);
         ASSERT_TRUE(op_placement.has_value());
     }
 
@@ -131,7 +149,6 @@ TEST_F(InteractivePlacerSanity, chip_id_galaxy_snake)
         "pybuda/test/galaxy/one_shelf_runtime_params.yaml",
         placer::ChipPlacementPolicy::SNAKE
     );
-    placer::InteractivePlacer interactive_placer(nullptr /*graph*/, balancer_config);
     std::map<std::string, placer::GridShape> op_to_grid_shape = {
         {"op1", placer::GridShape(8, 8)},
         {"op2", placer::GridShape(8, 8)},
@@ -142,10 +159,13 @@ TEST_F(InteractivePlacerSanity, chip_id_galaxy_snake)
         {"op7", placer::GridShape(8, 8)},
         {"op8", placer::GridShape(8, 8)},
     };
+    std::unique_ptr<graphlib::Graph> graph = create_graph_with_ops(op_to_grid_shape);
+    placer::InteractivePlacer interactive_placer(graph.get(), balancer_config);
 
     for (const auto& to_place : op_to_grid_shape)
     {
-        std::optional<placer::CoordRange> op_placement = interactive_placer.place_op(to_place.first, to_place.second);
+        std::optional<placer::CoordRange> op_placement =
+            interactive_placer.place_op(graph->get_node_by_name(to_place.first), to_place.second);
         ASSERT_TRUE(op_placement.has_value());
     }
 
@@ -219,7 +239,7 @@ TEST_F(MultiLayerGraph, chip_id_layer_override)
     {
         if (node->node_type() != graphlib::NodeType::kBudaOp)
             continue;
-        std::optional<placer::CoordRange> op_placement = interactive_placer.place_op(node->name(), GridShape(1, 1));
+        std::optional<placer::CoordRange> op_placement = interactive_placer.place_op(node, GridShape(1, 1));
         ASSERT_TRUE(op_placement.has_value());
     }
 
@@ -243,14 +263,15 @@ TEST_F(InteractivePlacerSanity, nebula_grid_8x8)
     setenv("PYBUDA_NEBULA_GALAXY_PLACER", "1", 0);
     const std::vector<std::uint32_t> chip_ids = {0};
     balancer::BalancerConfig balancer_config = create_balancer_config(Arch::Wormhole_b0, chip_ids, balancer::PolicyType::Ribbon);
-    placer::InteractivePlacer interactive_placer(nullptr /*graph*/, balancer_config);
     std::map<std::string, placer::GridShape> op_to_grid_shape = {
         {"op1", placer::GridShape(9, 1)},
     };
+    std::unique_ptr<graphlib::Graph> graph = create_graph_with_ops(op_to_grid_shape);
+    placer::InteractivePlacer interactive_placer(graph.get(), balancer_config);
 
     interactive_placer.get_op_overrides()["op1"].chip_id = 0;
 
-    std::optional<placer::CoordRange> op_placement = interactive_placer.place_op("op1", op_to_grid_shape["op1"]);
+    std::optional<placer::CoordRange> op_placement = interactive_placer.place_op(graph->get_node_by_name("op1"), op_to_grid_shape["op1"]);
 
     // cannot fit on nebula 8x8 grid
     EXPECT_EQ(op_placement.has_value(), false);
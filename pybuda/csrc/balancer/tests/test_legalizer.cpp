@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <set>
+#include <sstream>
+
+#include "balancer/balancer_cache_collection.hpp"
+#include "balancer/legalizer/legalizer.hpp"
+#include "graph_lib/utils.hpp"
+#include "gtest/gtest.h"
+#include "test/common.hpp"
+#include "test_balancer_utils.hpp"
+
+namespace tt::test
+{
+using namespace balancer;
+
+struct LegalOpModelReuse : public BudaGraphTest
+{
+   protected:
+    virtual std::vector<OpType*> create_graph() override
+    {
+        auto act = create_activation(1, 1, 64, 64);
+        auto weights = create_parameter(1, 1, 64, 64);
+
+        matmul = create_op("matmul", {act, weights});
+        gelu = create_op("gelu", {matmul});
+        return {gelu};
+    }
+
+    static std::vector<std::uint64_t> op_model_ids(LegalOpModels const& legal_op_models, graphlib::Node const* node)
+    {
+        std::vector<std::uint64_t> ids;
+        for (OpModel const& op_model : legal_op_models.at(node)) ids.push_back(op_model.id.id);
+        return ids;
+    }
+
+    OpType* matmul;
+    OpType* gelu;
+};
+
+TEST_F(LegalOpModelReuse, untouched_graph)
+{
+    graphlib::Graph* graph = get_graph();
+    BalancerConfig balancer_config = create_balancer_config();
+    std::shared_ptr<BalancerCacheCollection> cache_collection = create_balancer_cache_collection();
+
+    LegalOpModels first = legalizer::get_legal_op_models(graph, balancer_config, cache_collection);
+    LegalOpModels second = legalizer::get_legal_op_models(graph, balancer_config, cache_collection);
+
+    EXPECT_EQ(op_model_ids(first, matmul), op_model_ids(second, matmul));
+    EXPECT_EQ(op_model_ids(first, gelu), op_model_ids(second, gelu));
+}
+
+TEST_F(LegalOpModelReuse, edited_neighbourhood_is_relegalized)
+{
+    graphlib::Graph* graph = get_graph();
+    BalancerConfig balancer_config = create_balancer_config();
+    std::shared_ptr<BalancerCacheCollection> cache_collection = create_balancer_cache_collection();
+
+    LegalOpModels first = legalizer::get_legal_op_models(graph, balancer_config, cache_collection);
+
+    // Insert a nop between matmul and gelu, both of their edges change
+    graphlib::Edge edge = graph->user_data_edges(matmul)[0];
+    auto* nop = graph->add_node(
+        graphlib::create_node<graphlib::BudaOpNode>("nop", "nop"), graph->get_subgraph_id_for_node(matmul->id()));
+    nop->set_shape(matmul->shape());
+    graphlib::insert_node_on_edge(graph, edge, nop);
+
+    LegalOpModels second = legalizer::get_legal_op_models(graph, balancer_config, cache_collection);
+
+    EXPECT_NE(op_model_ids(first, matmul), op_model_ids(second, matmul));
+    EXPECT_NE(op_model_ids(first, gelu), op_model_ids(second, gelu));
+    EXPECT_EQ(second.count(nop), 1);
+
+    // And reused again once the graph settles
+    LegalOpModels third = legalizer::get_legal_op_models(graph, balancer_config, cache_collection);
+    EXPECT_EQ(op_model_ids(second, matmul), op_model_ids(third, matmul));
+    EXPECT_EQ(op_model_ids(second, nop), op_model_ids(third, nop));
+}
+
+// Stack of identical matmul + gelu blocks
+struct RepeatedBlockReuse : public BudaGraphTest
+{
+   protected:
+    static constexpr int kNumBlocks = 4;
+
+    virtual std::vector<OpType*> create_graph() override
+    {
+        graphlib::Node* x = create_activation(1, 1, 64, 64);
+        for (int i = 0; i < kNumBlocks; i++)
+        {
+            auto weights = create_parameter(1, 1, 64, 64);
+            matmuls.push_back(create_op("matmul", {x, weights}));
+            gelus.push_back(create_op("gelu", {matmuls.back()}));
+            x = gelus.back();
+        }
+        return {gelus.back()};
+    }
+
+    std::vector<OpType*> matmuls;
+    std::vector<OpType*> gelus;
+};
+
+TEST_F(RepeatedBlockReuse, inner_blocks_share_op_models)
+{
+    graphlib::Graph* graph = get_graph();
+    BalancerConfig balancer_config = create_balancer_config();
+    std::shared_ptr<BalancerCacheCollection> cache_collection = create_balancer_cache_collection();
+
+    LegalOpModels legal_op_models = legalizer::get_legal_op_models(graph, balancer_config, cache_collection);
+
+    // First matmul is fed by the activation and the last gelu feeds the output, the blocks in between are isomorphic
+    std::vector<OpModel> const& prototype = legal_op_models.at(matmuls[1]);
+    for (int i = 2; i < kNumBlocks; i++)
+    {
+        std::vector<OpModel> const& copy = legal_op_models.at(matmuls[i]);
+        ASSERT_EQ(copy.size(), prototype.size());
+        for (std::size_t j = 0; j < copy.size(); j++)
+        {
+            EXPECT_NE(copy[j].id.id, prototype[j].id.id);
+            EXPECT_EQ(copy[j].buda_op_node, matmuls[i]);
+            EXPECT_EQ(copy[j].grid_shape, prototype[j].grid_shape);
+            EXPECT_EQ(copy[j].t_stream_factor, prototype[j].t_stream_factor);
+            EXPECT_EQ(cache_collection->op_model_prototypes.at(copy[j].id.id), prototype[j].id.id);
+            EXPECT_EQ(copy[j].effective_input_buffer_shape_for_user.count(gelus[i]->id()), 1);
+        }
+    }
+
+    // Block boundaries aren't shared
+    for (OpModel const& op_model : legal_op_models.at(matmuls[0]))
+        EXPECT_EQ(cache_collection->op_model_prototypes.count(op_model.id.id), 0);
+    for (OpModel const& op_model : legal_op_models.at(gelus.back()))
+        EXPECT_EQ(cache_collection->op_model_prototypes.count(op_model.id.id), 0);
+}
+
+// Same stack with a nop in each block, one of them tagged as a padding nop
+struct RepeatedBlockPaddingNop : public BudaGraphTest
+{
+   protected:
+    static constexpr int kNumBlocks = 4;
+    static constexpr int kPaddedBlock = 2;
+
+    virtual std::vector<OpType*> create_graph() override
+    {
+        graphlib::Node* x = create_activation(1, 1, 256, 256);
+        for (int i = 0; i < kNumBlocks; i++)
+        {
+            auto weights = create_parameter(1, 1, 256, 256);
+            matmuls.push_back(create_op("matmul", {x, weights}));
+            nops.push_back(create_op("nop", {matmuls.back()}));
+            x = create_op("gelu", {nops.back()});
+        }
+        nops[kPaddedBlock]->tag("padding_nop");
+        return {x->as<OpType>()};
+    }
+
+    static std::set<std::string> legal_set(std::vector<OpModel> const& op_models)
+    {
+        std::set<std::string> legal;
+        for (OpModel const& op_model : op_models)
+        {
+            std::stringstream ss;
+            ss << op_model.grid_shape << op_model.t_stream_factor;
+            legal.insert(ss.str());
+        }
+        return legal;
+    }
+
+    std::vector<OpType*> matmuls;
+    std::vector<OpType*> nops;
+};
+
+TEST_F(RepeatedBlockPaddingNop, padding_nop_blocks_are_legalized_separately)
+{
+    graphlib::Graph* graph = get_graph();
+    BalancerConfig balancer_config = create_balancer_config();
+    balancer_config.enable_t_streaming = true;
+    std::shared_ptr<BalancerCacheCollection> cache_collection = create_balancer_cache_collection();
+
+    LegalOpModels legal_op_models = legalizer::get_legal_op_models(graph, balancer_config, cache_collection);
+
+    // The padding nop doesn't t-stream, and neither does its producer into it
+    for (OpType* op : {nops[kPaddedBlock], matmuls[kPaddedBlock]})
+    {
+        for (OpModel const& op_model : legal_op_models.at(op))
+            EXPECT_EQ(cache_collection->op_model_prototypes.count(op_model.id.id), 0);
+    }
+    EXPECT_NE(legal_set(legal_op_models.at(nops[kPaddedBlock])), legal_set(legal_op_models.at(nops[1])));
+    EXPECT_NE(legal_set(legal_op_models.at(matmuls[kPaddedBlock])), legal_set(legal_op_models.at(matmuls[1])));
+
+    // Blocks without the tag still share
+    EXPECT_EQ(legal_set(legal_op_models.at(nops[3])), legal_set(legal_op_models.at(nops[1])));
+    for (OpModel const& op_model : legal_op_models.at(nops[3]))
+        EXPECT_EQ(cache_collection->op_model_prototypes.count(op_model.id.id), 1);
+}
+
+}  // namespace tt::test
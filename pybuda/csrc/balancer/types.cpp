@@ -16,7 +16,7 @@
 
 namespace tt::balancer
 {
-std::uint64_t UniqueId::next_id = 0;
+std::atomic<std::uint64_t> UniqueId::next_id = 0;
 
 TensorShape::TensorShape(graphlib::Shape const &shape) :
     w((int)shape.w()), z((int)shape.z()), rt((int)shape.rt()), ct((int)shape.ct())
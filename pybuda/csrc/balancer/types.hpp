@@ -4,6 +4,7 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <initializer_list>
 #include <map>
 #include <ostream>
@@ -35,7 +36,7 @@ namespace tt::balancer
 {
 struct UniqueId
 {
-    static std::uint64_t next_id;
+    static std::atomic<std::uint64_t> next_id;
     std::uint64_t id = 0;
     UniqueId() : id(next_id++) {}
     UniqueId(std::uint64_t id) : id(id) {}
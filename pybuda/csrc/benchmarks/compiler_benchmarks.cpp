@@ -0,0 +1,279 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+//
+// Timings of the compiler hot paths on BERT / ResNet / LLaMA scale graphs.
+//
+// Each benchmark takes (model, number of blocks) as arguments, graphs are built once per argument pair and shared
+// between benchmarks. Results are written as JSON with the standard google-benchmark flags:
+//
+//   compiler_benchmarks --benchmark_out=compiler_benchmarks.json --benchmark_out_format=json
+//
+#include <benchmark/benchmark.h>
+#include <pybind11/embed.h>
+
+#include <map>
+#include <optional>
+#include <sstream>
+
+#include "balancer/balancer.hpp"
+#include "balancer/balancer_cache_collection.hpp"
+#include "balancer/balancer_utils.hpp"
+#include "balancer/legalizer/graph_solver.hpp"
+#include "balancer/legalizer/legalizer.hpp"
+#include "balancer/tests/test_balancer_utils.hpp"
+#include "benchmarks/model_graphs.hpp"
+#include "buda_passes.hpp"
+#include "graph_lib/graph.hpp"
+#include "graph_lib/utils.hpp"
+#include "lower_to_buda/netlist.hpp"
+#include "passes/fork_join.hpp"
+#include "passes/pre_placer_buda_passes.hpp"
+#include "scheduler/scheduler.hpp"
+
+namespace tt::benchmarks
+{
+using balancer::BalancerConfig;
+using balancer::LegalOpModels;
+using graphlib::Graph;
+
+namespace
+{
+struct Model
+{
+    std::unique_ptr<Graph> graph;
+    std::optional<LegalOpModels> legal_op_models;
+};
+
+Model& get_model(benchmark::State& state)
+{
+    static std::map<std::pair<int, int>, Model> models;
+
+    ModelGraph model_graph = static_cast<ModelGraph>(state.range(0));
+    int num_blocks = static_cast<int>(state.range(1));
+    state.SetLabel(to_string(model_graph) + "/" + std::to_string(num_blocks));
+
+    Model& model = models[{state.range(0), num_blocks}];
+    if (not model.graph)
+    {
+        model.graph = create_model_graph(model_graph, num_blocks);
+        calculate_ublock_order(model.graph.get());
+    }
+    return model;
+}
+
+LegalOpModels const& get_legal_op_models(Model& model, BalancerConfig const& config)
+{
+    if (not model.legal_op_models)
+        model.legal_op_models = balancer::legalizer::get_legal_op_models(
+            model.graph.get(), config, test::create_balancer_cache_collection());
+    return *model.legal_op_models;
+}
+
+void model_args(benchmark::internal::Benchmark* b)
+{
+    b->Args({static_cast<int>(ModelGraph::Bert), 12});
+    b->Args({static_cast<int>(ModelGraph::ResNet), 16});
+    b->Args({static_cast<int>(ModelGraph::Llama), 32});
+    b->Unit(benchmark::kMillisecond);
+}
+}  // namespace
+
+static void BM_topological_sort(benchmark::State& state)
+{
+    Graph* graph = get_model(state).graph.get();
+    for (auto _ : state) benchmark::DoNotOptimize(graphlib::topological_sort(*graph));
+}
+BENCHMARK(BM_topological_sort)->Apply(model_args);
+
+static void BM_get_legal_op_models(benchmark::State& state)
+{
+    Graph* graph = get_model(state).graph.get();
+    BalancerConfig config = test::create_balancer_config();
+    for (auto _ : state)
+    {
+        // Cold cache, reuse between calls would only measure the cache lookups
+        auto cache_collection = test::create_balancer_cache_collection();
+        benchmark::DoNotOptimize(balancer::legalizer::get_legal_op_models(graph, config, cache_collection));
+    }
+}
+BENCHMARK(BM_get_legal_op_models)->Apply(model_args);
+
+static void BM_graph_solver_construction(benchmark::State& state)
+{
+    Model& model = get_model(state);
+    BalancerConfig config = test::create_balancer_config();
+    LegalOpModels const& legal_op_models = get_legal_op_models(model, config);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(balancer::get_graph_solver(
+            config, test::create_balancer_cache_collection(), model.graph.get(), legal_op_models));
+    }
+}
+BENCHMARK(BM_graph_solver_construction)->Apply(model_args);
+
+static void BM_graph_solver_resolve(benchmark::State& state)
+{
+    Model& model = get_model(state);
+    BalancerConfig config = test::create_balancer_config();
+    LegalOpModels const& legal_op_models = get_legal_op_models(model, config);
+    std::vector<graphlib::Node*> topo_sort = graphlib::topological_sort(*model.graph);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        balancer::legalizer::GraphSolver graph_solver = balancer::get_graph_solver(
+            config, test::create_balancer_cache_collection(), model.graph.get(), legal_op_models);
+        state.ResumeTiming();
+
+        // Same walk the simpler policies do, first available op model in topological order
+        for (graphlib::Node* node : topo_sort)
+        {
+            if (node->node_type() != graphlib::NodeType::kBudaOp)
+                continue;
+            graph_solver.set(node, *graph_solver.at(node).begin());
+        }
+        benchmark::DoNotOptimize(graph_solver.finish());
+    }
+}
+BENCHMARK(BM_graph_solver_resolve)->Apply(model_args);
+
+static void BM_get_edge_resource_usage(benchmark::State& state)
+{
+    Model& model = get_model(state);
+    BalancerConfig config = test::create_balancer_config();
+    LegalOpModels const& legal_op_models = get_legal_op_models(model, config);
+
+    std::vector<graphlib::Edge> edges;
+    for (graphlib::Node* node : model.graph->nodes())
+    {
+        if (node->node_type() != graphlib::NodeType::kBudaOp)
+            continue;
+        for (graphlib::Edge const& edge : model.graph->user_data_edges(node))
+            if (model.graph->node_by_id(edge.consumer_node_id)->node_type() == graphlib::NodeType::kBudaOp)
+                edges.push_back(edge);
+    }
+
+    for (auto _ : state)
+    {
+        std::unordered_map<balancer::Pipe, balancer::ResourceUsage> pipe_to_ru_cache;
+        for (graphlib::Edge const& edge : edges)
+        {
+            auto const& producer = legal_op_models.at(model.graph->node_by_id(edge.producer_node_id));
+            auto const& consumer = legal_op_models.at(model.graph->node_by_id(edge.consumer_node_id));
+            benchmark::DoNotOptimize(balancer::get_edge_resource_usage(
+                model.graph.get(), pipe_to_ru_cache, edge, producer.front(), consumer.front()));
+        }
+    }
+    state.counters["edges"] = edges.size();
+}
+BENCHMARK(BM_get_edge_resource_usage)->Apply(model_args);
+
+static void BM_run_scheduler(benchmark::State& state)
+{
+    Graph* graph = get_model(state).graph.get();
+    scheduler::SchedulerConfig config(static_cast<scheduler::SchedulerPolicy>(state.range(2)));
+    for (auto _ : state) benchmark::DoNotOptimize(scheduler::run_scheduler(config, graph));
+}
+BENCHMARK(BM_run_scheduler)
+    ->Apply(
+        [](benchmark::internal::Benchmark* b)
+        {
+            for (int policy : {scheduler::Topological, scheduler::ModuleInputsBFS, scheduler::MemoryPressure})
+            {
+                b->Args({static_cast<int>(ModelGraph::Bert), 12, policy});
+                b->Args({static_cast<int>(ModelGraph::ResNet), 16, policy});
+                b->Args({static_cast<int>(ModelGraph::Llama), 32, policy});
+            }
+            b->Unit(benchmark::kMillisecond);
+        });
+
+static void BM_run_balancer_and_placer(benchmark::State& state)
+{
+    Graph* graph = get_model(state).graph.get();
+    BalancerConfig config = test::create_balancer_config();
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::unique_ptr<Graph> clone(graph->clone());
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(
+            balancer::run_balancer_and_placer(clone.get(), config, test::create_balancer_cache_collection()));
+    }
+}
+BENCHMARK(BM_run_balancer_and_placer)->Apply(model_args)->Iterations(3);
+
+static void BM_insert_fork_join_buffering(benchmark::State& state)
+{
+    Graph* graph = get_model(state).graph.get();
+    BalancerConfig config = test::create_balancer_config();
+    std::unique_ptr<Graph> placed(graph->clone());
+    auto solution = balancer::run_balancer_and_placer(placed.get(), config, test::create_balancer_cache_collection());
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::unique_ptr<Graph> clone(placed->clone());
+        balancer::OpModelMap op_models = solution->op_models;
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(insert_fork_join_buffering(
+            clone.get(),
+            &op_models,
+            nullptr,
+            config.device_config.get_l1_usable_size(),
+            {},
+            config.fork_join_tiles_treshold));
+    }
+}
+BENCHMARK(BM_insert_fork_join_buffering)->Apply(model_args)->Iterations(3);
+
+static void BM_netlist_emission(benchmark::State& state)
+{
+    Graph* graph = get_model(state).graph.get();
+    BalancerConfig config = test::create_balancer_config();
+    std::unique_ptr<Graph> placed(graph->clone());
+    auto solution = balancer::run_balancer_and_placer(placed.get(), config, test::create_balancer_cache_collection());
+
+    // Queues and buffering have to be in place before lowering
+    std::string graph_name = placed->name();
+    PostPlacerConfig post_placer_config(
+        config.device_config, 1, 1, true, true, true, {}, config.fork_join_tiles_treshold);
+    std::vector<std::vector<placer::Blocks>> pre_allocated_blocks;
+    run_post_placer_buda_passes(
+        placed.get(),
+        graph_name,
+        config.device_config,
+        solution->placer_solution,
+        post_placer_config,
+        solution,
+        {},
+        pre_allocated_blocks,
+        0);
+
+    for (auto _ : state)
+    {
+        BudaNetlist netlist = lower_to_buda_netlist(
+            placed.get(), graph_name, solution->placer_solution, solution, config.chip_ids, config.device_config, false);
+        std::ostringstream out;
+        netlist.dump_to_stream(out);
+        benchmark::DoNotOptimize(out.str());
+    }
+}
+BENCHMARK(BM_netlist_emission)->Apply(model_args);
+
+}  // namespace tt::benchmarks
+
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    // Shape calculation and op models call into python
+    pybind11::scoped_interpreter guard{};
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
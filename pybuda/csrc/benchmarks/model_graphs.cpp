@@ -0,0 +1,226 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "benchmarks/model_graphs.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "graph_lib/graph.hpp"
+#include "graph_lib/node_types.hpp"
+#include "test/graph_api.hpp"
+#include "utils/assert.hpp"
+
+namespace tt::benchmarks
+{
+using graphlib::BudaOpNode;
+using graphlib::Graph;
+using graphlib::Node;
+using graphlib::OpType;
+
+namespace
+{
+constexpr std::uint32_t TILE = graphlib::Shape::BUDA_TILE_DIM;
+
+std::uint32_t round_up_to_tile(std::uint32_t dim) { return ((dim + TILE - 1) / TILE) * TILE; }
+
+class ModelBuilder
+{
+   public:
+    ModelBuilder(std::string const& name) : graph(std::make_unique<Graph>(graphlib::IRLevel::IR_BUDA, name)) {}
+
+    Node* activation(std::uint32_t r, std::uint32_t c) { return input(r, c, graphlib::InputNodeType::Activation); }
+    Node* parameter(std::uint32_t r, std::uint32_t c) { return input(r, c, graphlib::InputNodeType::Parameter); }
+    Node* constant(std::uint32_t r, std::uint32_t c) { return input(r, c, graphlib::InputNodeType::Constant); }
+
+    BudaOpNode* op(std::string const& type, std::vector<Node*> const& operands, std::vector<OpType::Attr> attrs = {})
+    {
+        return tt::add_node<BudaOpNode>(*graph, prefix + type + std::to_string(op_id++), type, attrs, operands);
+    }
+
+    void tm(BudaOpNode* consumer, graphlib::PortId operand, OpType const& tm)
+    {
+        for (graphlib::Edge const& edge : graph->operand_data_edges(consumer))
+            if (edge.consumer_input_port_id == operand)
+                graph->get_edge_attributes(edge)->append_tm(tm);
+    }
+
+    void broadcast(BudaOpNode* consumer, graphlib::PortId operand, int dim, std::uint32_t factor)
+    {
+        tm(consumer, operand, OpType("broadcast", {dim, (int)factor}));
+    }
+
+    void set_block(std::string const& block) { prefix = block + "."; }
+
+    std::unique_ptr<Graph> finish(Node* output)
+    {
+        tt::create_output(*graph, "output", output);
+        return std::move(graph);
+    }
+
+   private:
+    std::unique_ptr<Graph> graph;
+    std::string prefix;
+    int op_id = 0;
+    int input_id = 0;
+
+    Node* input(std::uint32_t r, std::uint32_t c, graphlib::InputNodeType type)
+    {
+        return tt::create_input(
+            *graph, prefix + "input" + std::to_string(input_id++), graphlib::Shape::create_buda(1, 1, r, c), type);
+    }
+};
+
+// exp(x) / sum(exp(x)), the sum is a matmul with ones, the way softmax is decomposed for Buda
+Node* softmax(ModelBuilder& b, Node* x, std::uint32_t columns)
+{
+    auto exp = b.op("exp", {x});
+    auto sum = b.op("matmul", {exp, b.constant(columns, TILE)});
+    auto out = b.op("multiply", {exp, b.op("reciprocal", {sum})});
+    b.broadcast(out, 1, 3, columns / TILE);
+    return out;
+}
+
+Node* layernorm(ModelBuilder& b, Node* x, std::uint32_t rows, std::uint32_t hidden)
+{
+    auto ones = b.constant(hidden, TILE);
+    auto centered = b.op("subtract", {x, b.op("matmul", {x, ones})});
+    b.broadcast(centered, 1, 3, hidden / TILE);
+    auto var = b.op("matmul", {b.op("multiply", {centered, centered}), ones});
+    auto normed = b.op("multiply", {centered, b.op("reciprocal", {b.op("sqrt", {var})})});
+    b.broadcast(normed, 1, 3, hidden / TILE);
+    auto scaled = b.op("multiply", {normed, b.parameter(TILE, hidden)});
+    b.broadcast(scaled, 1, 2, rows / TILE);
+    auto out = b.op("add", {scaled, b.parameter(TILE, hidden)});
+    b.broadcast(out, 1, 2, rows / TILE);
+    return out;
+}
+
+Node* rmsnorm(ModelBuilder& b, Node* x, std::uint32_t rows, std::uint32_t hidden)
+{
+    auto mean_square = b.op("matmul", {b.op("multiply", {x, x}), b.constant(hidden, TILE)});
+    auto normed = b.op("multiply", {x, b.op("reciprocal", {b.op("sqrt", {mean_square})})});
+    b.broadcast(normed, 1, 3, hidden / TILE);
+    auto out = b.op("multiply", {normed, b.parameter(TILE, hidden)});
+    b.broadcast(out, 1, 2, rows / TILE);
+    return out;
+}
+
+Node* attention(ModelBuilder& b, Node* x, std::uint32_t rows, std::uint32_t hidden)
+{
+    auto q = b.op("matmul", {x, b.parameter(hidden, hidden)});
+    auto k = b.op("matmul", {x, b.parameter(hidden, hidden)});
+    auto v = b.op("matmul", {x, b.parameter(hidden, hidden)});
+    auto scores = b.op("matmul", {q, k});
+    b.tm(scores, 1, OpType("transpose", {2, 3, -1}, {}, {{"dim0", 2}, {"dim1", 3}, {"z_dim_slice", -1}}));
+    auto context = b.op("matmul", {softmax(b, scores, rows), v});
+    return b.op("matmul", {context, b.parameter(hidden, hidden)});
+}
+
+std::unique_ptr<Graph> create_bert(int num_blocks)
+{
+    const std::uint32_t seq_len = 128, hidden = 768, ff = 3072;
+    ModelBuilder b("bert");
+    Node* x = b.activation(seq_len, hidden);
+    for (int i = 0; i < num_blocks; i++)
+    {
+        b.set_block("layer" + std::to_string(i));
+        x = layernorm(b, b.op("add", {x, attention(b, x, seq_len, hidden)}), seq_len, hidden);
+        auto ff0 = b.op("gelu", {b.op("matmul", {x, b.parameter(hidden, ff)})});
+        auto ff1 = b.op("matmul", {ff0, b.parameter(ff, hidden)});
+        x = layernorm(b, b.op("add", {x, ff1}), seq_len, hidden);
+    }
+    return b.finish(x);
+}
+
+std::unique_ptr<Graph> create_llama(int num_blocks)
+{
+    const std::uint32_t seq_len = 128, hidden = 4096, ff = 11008;
+    ModelBuilder b("llama");
+    Node* x = b.activation(seq_len, hidden);
+    for (int i = 0; i < num_blocks; i++)
+    {
+        b.set_block("layer" + std::to_string(i));
+        x = b.op("add", {x, attention(b, rmsnorm(b, x, seq_len, hidden), seq_len, hidden)});
+
+        Node* y = rmsnorm(b, x, seq_len, hidden);
+        auto gate = b.op("matmul", {y, b.parameter(hidden, ff)});
+        auto silu = b.op("multiply", {gate, b.op("sigmoid", {gate})});
+        auto up = b.op("matmul", {y, b.parameter(hidden, ff)});
+        auto down = b.op("matmul", {b.op("multiply", {silu, up}), b.parameter(ff, hidden)});
+        x = b.op("add", {x, down});
+    }
+    return b.finish(x);
+}
+
+std::unique_ptr<Graph> create_resnet(int num_blocks)
+{
+    // (blocks, spatial size, bottleneck channels, output channels) of the ResNet-50 stages
+    struct Stage
+    {
+        int blocks;
+        std::uint32_t spatial;
+        std::uint32_t mid;
+        std::uint32_t out;
+    };
+    const std::vector<Stage> stages = {{3, 56, 64, 256}, {4, 28, 128, 512}, {6, 14, 256, 1024}, {3, 7, 512, 2048}};
+
+    ModelBuilder b("resnet");
+    std::uint32_t rows = round_up_to_tile(56 * 56);
+    std::uint32_t channels = 64;
+    Node* x = b.activation(rows, channels);
+
+    // Buda has no relu unary, gelu stands in for it
+    int block = 0;
+    for (std::size_t s = 0; s < stages.size() and block < num_blocks; s++)
+    {
+        Stage const& stage = stages[s];
+        for (int i = 0; i < stage.blocks and block < num_blocks; i++, block++)
+        {
+            b.set_block("block" + std::to_string(block));
+
+            // Strided convs pick rows with a constant selection matrix, like sparse matmul does
+            std::uint32_t stage_rows = round_up_to_tile(stage.spatial * stage.spatial);
+            if (stage_rows != rows)
+            {
+                x = b.op("matmul", {b.constant(stage_rows, rows), x});
+                rows = stage_rows;
+            }
+
+            auto conv1 = b.op("gelu", {b.op("matmul", {x, b.parameter(channels, stage.mid)})});
+            auto conv2 = b.op("gelu", {b.op("matmul", {conv1, b.parameter(stage.mid, stage.mid)})});
+            auto conv3 = b.op("matmul", {conv2, b.parameter(stage.mid, stage.out)});
+            Node* shortcut = channels == stage.out ? x : b.op("matmul", {x, b.parameter(channels, stage.out)});
+            x = b.op("gelu", {b.op("add", {conv3, shortcut})});
+            channels = stage.out;
+        }
+    }
+    return b.finish(x);
+}
+}  // namespace
+
+std::string to_string(ModelGraph model)
+{
+    switch (model)
+    {
+        case ModelGraph::Bert: return "bert";
+        case ModelGraph::ResNet: return "resnet";
+        case ModelGraph::Llama: return "llama";
+    }
+    return "unknown";
+}
+
+std::unique_ptr<Graph> create_model_graph(ModelGraph model, int num_blocks)
+{
+    TT_ASSERT(num_blocks > 0);
+    switch (model)
+    {
+        case ModelGraph::Bert: return create_bert(num_blocks);
+        case ModelGraph::ResNet: return create_resnet(num_blocks);
+        case ModelGraph::Llama: return create_llama(num_blocks);
+    }
+    TT_THROW("Unknown model graph");
+    return nullptr;
+}
+
+}  // namespace tt::benchmarks
@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace tt::graphlib
+{
+class Graph;
+}
+
+namespace tt::benchmarks
+{
+
+enum class ModelGraph
+{
+    Bert,
+    ResNet,
+    Llama,
+};
+
+std::string to_string(ModelGraph model);
+
+// Synthetic Buda-level graph with the op mix, fork-joins and tensor shapes of the model, num_blocks
+// encoder layers / bottleneck blocks / decoder layers deep:
+//   Bert   - BERT-base encoder, seq 128, hidden 768, ff 3072
+//   ResNet - ResNet-50 bottlenecks at 224x224, convs as matmuls over flattened spatial dims
+//   Llama  - LLaMA-7B decoder, seq 128, hidden 4096, ff 11008, RMS norm and SwiGLU
+std::unique_ptr<graphlib::Graph> create_model_graph(ModelGraph model, int num_blocks);
+
+}  // namespace tt::benchmarks
@@ -0,0 +1,22 @@
+PYBUDA_CSRC_BENCHMARKS = $(TESTDIR)/pybuda/csrc/benchmarks/compiler_benchmarks
+PYBUDA_CSRC_BENCHMARKS_SRCS = \
+	pybuda/csrc/balancer/tests/test_balancer_utils.cpp \
+	$(wildcard pybuda/csrc/benchmarks/*.cpp)
+
+PYBUDA_CSRC_BENCHMARKS_INCLUDES = -Ipybuda/csrc/graph_lib $(PYBUDA_CSRC_INCLUDES)
+PYBUDA_CSRC_BENCHMARKS_LDFLAGS = -lstdc++fs -lbenchmark -lpthread -l$(PYTHON_VERSION) -lm
+
+PYBUDA_CSRC_BENCHMARKS_OBJS = $(addprefix $(OBJDIR)/, $(PYBUDA_CSRC_BENCHMARKS_SRCS:.cpp=.o))
+PYBUDA_CSRC_BENCHMARKS_DEPS = $(addprefix $(OBJDIR)/, $(PYBUDA_CSRC_BENCHMARKS_SRCS:.cpp=.d))
+
+-include $(PYBUDA_CSRC_BENCHMARKS_DEPS)
+
+pybuda/csrc/benchmarks: $(PYBUDA_CSRC_BENCHMARKS)
+
+$(PYBUDA_CSRC_BENCHMARKS): $(PYBUDA_CSRC_BENCHMARKS_OBJS) $(PYBUDA_CSRC_LIB)
+	@mkdir -p $(@D)
+	$(CXX) $(PYBUDA_CSRC_CFLAGS) $(CXXFLAGS) -o $@ $^ $(LDFLAGS) $(PYBUDA_CSRC_BENCHMARKS_LDFLAGS)
+
+$(OBJDIR)/pybuda/csrc/benchmarks/%.o: pybuda/csrc/benchmarks/%.cpp
+	@mkdir -p $(@D)
+	$(CXX) $(PYBUDA_CSRC_CFLAGS) $(CXXFLAGS) $(PYBUDA_CSRC_BENCHMARKS_INCLUDES) -c -o $@ $<
@@ -55,6 +55,7 @@
 #include "placer/utils.hpp"
 #include "python_bindings_common.hpp"
 #include "reportify/reportify.hpp"
+#include "shared_utils/instrumentation.hpp"
 #include "utils/assert.hpp"
 #include "utils/logger.hpp"
 #include "utils/ordered_associative_containers/ordered_map.hpp"
@@ -80,6 +81,15 @@ void lower_reshape(Graph *, graphlib::OpNode *node)
     node->change_op_type(op_type);
 }
 
+// Graph size gauges, sampled into the compile trace whenever an instrumented scope closes
+static void record_graph_size(graphlib::Graph const *graph)
+{
+    std::size_t num_edges = 0;
+    for (auto const &[node_id, operands] : graph->operands_map()) num_edges += operands.size();
+    INSTRUMENT_COUNTER_SET("graph.nodes", graph->num_nodes());
+    INSTRUMENT_COUNTER_SET("graph.edges", num_edges);
+}
+
 // *****************************************************************
 //  ************************** Main APIs **************************
 // *****************************************************************
@@ -88,6 +98,7 @@ void lower_reshape(Graph *, graphlib::OpNode *node)
 std::tuple<std::vector<std::pair<graphlib::NodeId, graphlib::NodeId>>, passes::FractureChipIdAssignments>
 run_post_initial_graph_passes(graphlib::Graph *graph, py::object compiler_cfg_object, passes::FractureGroups const &fracture_groups)
 {
+    INSTRUMENT_SCOPE("run_post_initial_graph_passes");
     std::shared_ptr<void> compiler_cfg = make_shared_py_object(compiler_cfg_object);
 
     passes::print_graph(graph, "INITIAL");
@@ -101,11 +112,13 @@ run_post_initial_graph_passes(graphlib::Graph *graph, py::object compiler_cfg_ob
 
     auto inserted_node_id_mapping = decompose_pybuda_graph(graph, "get_f_pybuda_decompose", compiler_cfg);
     auto chip_id_assignments = passes::fracture(graph, fracture_groups);
+    record_graph_size(graph);
     return std::make_tuple(inserted_node_id_mapping, chip_id_assignments);
 }
 
 void run_optimization_graph_passes(graphlib::Graph *graph, const DeviceConfig &device_config)
 {
+    INSTRUMENT_SCOPE("run_optimization_graph_passes");
     passes::print_graph(graph, "PRE OPTIMIZE");
     passes::lower_concat_to_runtime_transform(graph);
 
@@ -177,16 +190,19 @@ void run_optimization_graph_passes(graphlib::Graph *graph, const DeviceConfig &d
     passes::move_select_after_matmul_optional(graph);
 
     passes::fuse_tm_sequences(graph);
+    record_graph_size(graph);
     reportify::dump_graph(graph->name(), "post_erase_inverse_ops", graph);
 }
 
 std::vector<std::pair<graphlib::NodeId, graphlib::NodeId>> run_post_optimize_decompose_graph_passes(
     graphlib::Graph *graph, py::object compiler_cfg_object)
 {
+    INSTRUMENT_SCOPE("run_post_optimize_decompose_graph_passes");
     std::shared_ptr<void> compiler_cfg = make_shared_py_object(compiler_cfg_object);
 
     passes::print_graph(graph, "POST_OPTIMIZE");
     auto inserted_node_id_mapping = decompose_pybuda_graph(graph, "get_f_pybuda_decompose_post_optimize", compiler_cfg);
+    record_graph_size(graph);
 
     return inserted_node_id_mapping;
 }
@@ -195,16 +211,20 @@ std::vector<std::pair<graphlib::NodeId, graphlib::NodeId>> run_post_optimize_dec
 std::vector<std::pair<graphlib::NodeId, graphlib::NodeId>> run_post_autograd_graph_passes(
     graphlib::Graph *graph, py::object compiler_cfg_object)
 {
+    INSTRUMENT_SCOPE("run_post_autograd_graph_passes");
     std::shared_ptr<void> compiler_cfg = make_shared_py_object(compiler_cfg_object);
 
     passes::print_graph(graph, "POST_AUTOGRAD");
     lower_bwd_gather_ops(graph);
-    return decompose_pybuda_graph(graph, "get_f_pybuda_decompose_post_autograd", compiler_cfg);
+    auto inserted_node_id_mapping = decompose_pybuda_graph(graph, "get_f_pybuda_decompose_post_autograd", compiler_cfg);
+    record_graph_size(graph);
+    return inserted_node_id_mapping;
 }
 
 // ********** Run pre-lowering passes **********
 void run_pre_lowering_passes(graphlib::Graph *graph)
 {
+    INSTRUMENT_SCOPE("run_pre_lowering_passes");
     passes::print_graph(graph, "PRE_LOWERING");
     // Recalculate shapes, and figure out implicit broadcasts that are missing
     recalculate_shapes(graph);
@@ -236,6 +256,7 @@ void run_pre_lowering_passes(graphlib::Graph *graph)
     // Fold tile broadcasts into reduce and inputs
     fold_tile_broadcast_ops_into_inputs(graph);
     fold_tile_broadcast_ops_into_reduce(graph);
+    record_graph_size(graph);
 }
 
 // ********** Run lowering passes **********
@@ -264,8 +285,10 @@ std::pair<std::unique_ptr<graphlib::Graph>, placer::PlacerConfigUpdate> run_pre_
     const std::vector<AMPNodeProperties> &amp_properties,
     const std::vector<std::string> &op_intermediates_to_save,
     const bool use_interactive_placer,
-    bool enable_device_tilize)
+    bool enable_device_tilize,
+    placer::ChipPlacementPolicy chip_placement_policy)
 {
+    INSTRUMENT_SCOPE("run_pre_placer_buda_passes");
     log_debug(LogGraphCompiler, "Lowering target device\n{}", device_config);
 
     passes::print_graph(graph, "PRE_PLACER");
@@ -288,6 +311,7 @@ std::pair<std::unique_ptr<graphlib::Graph>, placer::PlacerConfigUpdate> run_pre_
     // Fuse ops
     if (enable_auto_fusing)
     {
+        INSTRUMENT_SCOPE("fuse_ops");
         recalculate_shapes(lowered_graph.get());
         fuse_ops(
             lowered_graph.get(),
@@ -362,15 +386,18 @@ std::pair<std::unique_ptr<graphlib::Graph>, placer::PlacerConfigUpdate> run_pre_
     //
     // Data formats
     //
-    run_dataformat_passes(
-        lowered_graph.get(),
-        device_config,
-        default_df_override,
-        default_accumulate_df,
-        fp32_fallback,
-        default_math_fidelity,
-        amp_level,
-        amp_properties);
+    {
+        INSTRUMENT_SCOPE("run_dataformat_passes");
+        run_dataformat_passes(
+            lowered_graph.get(),
+            device_config,
+            default_df_override,
+            default_accumulate_df,
+            fp32_fallback,
+            default_math_fidelity,
+            amp_level,
+            amp_properties);
+    }
 
     // At this point, there should be no more graph mutations.
     placer::PlacerConfigUpdate placer_config_update = schedule_pre_placer_graph(
@@ -382,7 +409,9 @@ std::pair<std::unique_ptr<graphlib::Graph>, placer::PlacerConfigUpdate> run_pre_
         op_names_to_epoch_break,
         fracture_chip_id_assignments,
         "" /* nops_remote_devices_postfix */,
-        use_interactive_placer);
+        use_interactive_placer,
+        chip_placement_policy);
+    record_graph_size(lowered_graph.get());
 
     return std::make_pair(std::move(lowered_graph), placer_config_update);
 }
@@ -426,6 +455,7 @@ PostPlacerResults run_post_placer_buda_passes(
     std::vector<std::vector<placer::Blocks>> &pre_allocated_blocks,
     std::uint32_t last_host_address)
 {
+    INSTRUMENT_SCOPE("run_post_placer_buda_passes");
     set_prologue_queues(graph, balancer_solution->op_models);
 
     replace_recompute_with_checkpoint(graph, placer_solution);
@@ -566,6 +596,7 @@ void run_pre_netlist_generation_buda_passes(
     std::uint32_t last_host_address
     )
 {
+    INSTRUMENT_SCOPE("run_pre_netlist_generation_buda_passes");
     if (env_as<bool>("PYBUDA_REPRODUCE_SUBGRAPH"))
     {
         std::string input_name = env_as<string> ("PYBUDA_REPRODUCE_SUBGRAPH_INPUT");
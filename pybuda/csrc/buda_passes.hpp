@@ -59,7 +59,8 @@ std::pair<std::unique_ptr<graphlib::Graph>, placer::PlacerConfigUpdate> run_pre_
     const std::vector<AMPNodeProperties> &amp_properties = {},
     const std::vector<std::string> &op_intermediates_to_save = {},
     bool use_interactive_placer = true,
-    bool enable_device_tilize = false);
+    bool enable_device_tilize = false,
+    placer::ChipPlacementPolicy chip_placement_policy = placer::ChipPlacementPolicy::MMIO_LAST);
 struct PostPlacerResults
 {
     std::unordered_map<std::string, float> perf_model_results;
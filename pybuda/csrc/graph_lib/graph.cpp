@@ -174,14 +174,51 @@ bool Graph::is_node_visible(const Node *node) const
     return false;
 }
 
+// Materialized view of the current traversal context, built once per context nodes so that repeated traversals of
+// the same epoch skip the per-edge visibility checks.
+//
+std::unique_ptr<TraversalView> Graph::materialize_traversal_view() const
+{
+    TT_ASSERT(traversal_view_ == nullptr, "Traversal view must be built from the unmaterialized context");
+    TT_ASSERT(node_traversal_context_ != nullptr);
+
+    auto view = std::make_unique<TraversalView>();
+    view->graph_version = structure_version_;
+    view->node_index.reserve(node_traversal_context_->size());
+    view->operand_edges.reserve(node_traversal_context_->size());
+    view->user_edges.reserve(node_traversal_context_->size());
+    for (const Node *node : *node_traversal_context_)
+    {
+        if (nodes_map_raw_.count(node->id()) == 0 or not is_node_visible(node))
+            continue;
+
+        view->node_index[node->id()] = view->operand_edges.size();
+        view->operand_edges.push_back(operand_edges(node));
+        view->user_edges.push_back(user_edges(node));
+    }
+    return view;
+}
+
+const TraversalView *Graph::valid_traversal_view() const
+{
+    if (traversal_view_ == nullptr or traversal_view_->graph_version != structure_version_)
+        return nullptr;
+    return traversal_view_;
+}
+
 // Tracking virtual nodes.
 //
-void Graph::mark_node_virtual(const Node *node) { virtual_nodes_.insert(node->id()); }
+void Graph::mark_node_virtual(const Node *node)
+{
+    virtual_nodes_.insert(node->id());
+    structure_version_++;
+}
 
 void Graph::mark_node_persisted(const Node *node)
 {
     TT_ASSERT(virtual_nodes_.count(node->id()) > 0);
     virtual_nodes_.erase(node->id());
+    structure_version_++;
 }
 
 bool Graph::is_node_virtual(const Node *node) const { return virtual_nodes_.count(node->id()) > 0; }
@@ -211,6 +248,17 @@ const std::unordered_set<Edge> &Graph::operand_edges_set(const Node *node) const
 std::vector<Edge> Graph::operand_edges(const Node *node, std::function<bool(Edge)> edge_filter) const
 {
     std::vector<Edge> operand_edges;
+    if (const TraversalView *view = valid_traversal_view())
+    {
+        if (auto index = view->node_index.find(node->id()); index != view->node_index.end())
+        {
+            for (const Edge &operand_edge : view->operand_edges[index->second])
+                if (edge_filter(operand_edge))
+                    operand_edges.push_back(operand_edge);
+            return operand_edges;
+        }
+    }
+
     auto sort_on_consumer_input_port = [](const Edge &a, const Edge &b) -> bool
     { return a.consumer_input_port_id < b.consumer_input_port_id; };
     for (auto operand_edge : this->operand_edges_set(node))
@@ -245,6 +293,16 @@ std::vector<Edge> Graph::edges(const Node *node, std::function<bool(Edge)> edge_
 std::vector<Edge> Graph::user_edges(const Node *node, std::function<bool(Edge)> edge_filter) const
 {
     std::vector<Edge> user_edges;
+    if (const TraversalView *view = valid_traversal_view())
+    {
+        if (auto index = view->node_index.find(node->id()); index != view->node_index.end())
+        {
+            for (const Edge &user_edge : view->user_edges[index->second])
+                if (edge_filter(user_edge))
+                    user_edges.push_back(user_edge);
+            return user_edges;
+        }
+    }
 
     // user-edge sorting is <producer_output_port_id, consumer_input_port_id, edge_creation_id>
     // in that exact order.
@@ -420,6 +478,7 @@ std::vector<Node *> Graph::data_users(const Node *node) const {
 
 std::unique_ptr<Node> Graph::remove_node(const NodeId node_id)
 {
+    this->structure_version_++;
     for (auto &operand_edge : this->operands_map_[node_id])
     {
         this->users_map_[operand_edge.producer_node_id].erase(operand_edge);
@@ -436,18 +495,43 @@ std::unique_ptr<Node> Graph::remove_node(const NodeId node_id)
     this->users_map_.erase(node_id);
     auto node_unique_ptr = std::move(this->nodes_map_.extract(node_id).mapped());
     this->nodes_map_raw_.erase(node_id);
-    this->nodes_.erase(
-        std::remove(this->nodes_.begin(), this->nodes_.end(), node_unique_ptr.get()), this->nodes_.end());
     this->virtual_nodes_.erase(node_id);
+
+    // Tombstone the slot, the node list is compacted once the open mutations end
+    auto slot = this->node_slots_.extract(node_id);
+    this->nodes_[slot.mapped()] = nullptr;
+    this->num_removed_slots_++;
+    this->nodes_snapshot_stale_ = true;
+    if (this->num_open_mutations_ == 0)
+        compact_nodes();
+
     node_unique_ptr->set_id(-1);
     return node_unique_ptr;
 }
 
 std::unique_ptr<Node> Graph::remove_node(const Node *node) { return remove_node(node->id()); }
 
+void Graph::compact_nodes() const
+{
+    if (num_removed_slots_ == 0)
+        return;
+
+    std::size_t next = 0;
+    for (Node *node : nodes_)
+    {
+        if (node == nullptr)
+            continue;
+        node_slots_[node->id()] = next;
+        nodes_[next++] = node;
+    }
+    nodes_.resize(next);
+    num_removed_slots_ = 0;
+}
+
 const Graph::NodeIdToNodePtr &Graph::nodes_map() const { return this->nodes_map_raw_; }
 
 void Graph::add_edge(const Edge& edge, std::shared_ptr<EdgeAttributes> edge_attributes) {
+    structure_version_++;
     users_map_[edge.producer_node_id].insert(edge);
     operands_map_[edge.consumer_node_id].insert(edge);
     if (edge_attributes) {
@@ -526,9 +610,38 @@ void Graph::add_edge(
     add_edge(*producer, *consumer, producer_output_port_id, consumer_input_port_id, edge_type);
 }
 
+void Graph::add_edges(const std::vector<Edge> &edges)
+{
+    edge_to_attr_map_.reserve(edge_to_attr_map_.size() + edges.size());
+    for (const Edge &edge : edges) add_edge(edge);
+}
+
+void Graph::remove_edges(const std::vector<Edge> &edges)
+{
+    this->structure_version_++;
+    std::unordered_map<NodeId, std::unordered_set<EdgeUniqueId, EdgeUniqueIdHash>> edges_by_consumer;
+    for (const Edge &edge : edges) edges_by_consumer[edge.consumer_node_id].insert(edge.unique_id());
+
+    for (const auto &[consumer_id, unique_ids] : edges_by_consumer)
+    {
+        std::unordered_set<Edge> &operand_edges = this->operands_map_[consumer_id];
+        for (auto it = operand_edges.begin(); it != operand_edges.end();)
+        {
+            if (unique_ids.count(it->unique_id()) == 0)
+            {
+                ++it;
+                continue;
+            }
+            this->users_map_[it->producer_node_id].erase(*it);
+            it = operand_edges.erase(it);
+        }
+    }
+}
+
 std::shared_ptr<EdgeAttributes> Graph::remove_edge(const Edge &edge)
 {
     auto attr = get_edge_attributes(edge);
+    this->structure_version_++;
     std::vector<Edge> operand_edges_to_remove;
     for (auto &operand_edge : this->operands_map_[edge.consumer_node_id]) {
         if (operand_edge.unique_id() == edge.unique_id()) {
@@ -544,9 +657,10 @@ std::shared_ptr<EdgeAttributes> Graph::remove_edge(const Edge &edge)
 
 std::vector<Node*> Graph::nodes(std::function<bool(Node*)> node_filter) const
 {
+    // Returns a copy, so it reads through tombstoned slots instead of handing out the node list
     std::vector<Node *> ret;
     for (Node *node: nodes_)
-        if (node_filter(node)) ret.push_back(node);
+        if (node != nullptr and node_filter(node)) ret.push_back(node);
     return ret;
 }
 
@@ -559,7 +673,7 @@ std::vector<Node*> Graph::nodes_by_subgraph(unsigned int subgraph_id) const
 {
     std::vector<Node *> ret;
     for (Node *node: nodes_)
-        if (node_id_to_subgraph_id_.at(node->id()) == subgraph_id) ret.push_back(node);
+        if (node != nullptr and node_id_to_subgraph_id_.at(node->id()) == subgraph_id) ret.push_back(node);
     return ret;
 }
 
@@ -575,7 +689,21 @@ unsigned int Graph::get_subgraph_id_for_node(NodeId node_id) const
 }
 
 const std::vector<Node*>& Graph::nodes() const {
-    return nodes_;
+    if (num_open_mutations_ == 0)
+    {
+        compact_nodes();
+        return nodes_;
+    }
+
+    if (nodes_snapshot_stale_)
+    {
+        nodes_snapshot_.clear();
+        for (Node *node : nodes_)
+            if (node != nullptr)
+                nodes_snapshot_.push_back(node);
+        nodes_snapshot_stale_ = false;
+    }
+    return nodes_snapshot_;
 }
 int Graph::num_users(const Node* node) const { return this->users_map().at(node->id()).size(); }
 
@@ -950,7 +1078,7 @@ std::vector<Node *> Graph::ordered_partial_datacopy_outputs() const
 
 std::vector<Node *> Graph::get_constant_nodes(bool recurse) const {
     std::vector<Node*> constants;
-    for (Node *node: nodes_) {
+    for (Node *node: nodes()) {
         if (node->node_type() == NodeType::kInput)
         {
             InputNode* input_node = node->as<InputNode>();
@@ -979,7 +1107,7 @@ std::vector<std::string> Graph::get_constant_names() const {
 std::vector<Node *> Graph::get_parameter_nodes() const
 {
     std::vector<Node *> parameters;
-    for (Node *node : nodes_)
+    for (Node *node : nodes())
     {
         if (node->node_type() == NodeType::kInput)
         {
@@ -1003,7 +1131,7 @@ std::vector<std::string> Graph::get_ordered_output_names() const {
 
 bool Graph::contains_nodes_of_epoch_type(NodeEpochType node_epoch_type) const {
     // Cache if it starts getting slow?
-    for (Node *node : nodes_) {
+    for (Node *node : nodes()) {
         if (node->get_epoch_type() == node_epoch_type)
             return true;
     }
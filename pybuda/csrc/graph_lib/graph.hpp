@@ -54,6 +54,19 @@ enum class IRLevel
     IR_CONSTEVAL,
 };
 
+// Immutable snapshot of the edges visible in a node traversal context, see GraphTraversalContext.
+// Nodes of the context get dense indices, and their adjacency lists are pre-filtered and pre-sorted the same way
+// Graph::operand_edges / Graph::user_edges return them. The view is only consulted while the graph structure is
+// unchanged since it was built (graph_version), any edge or node removal makes queries fall back to the
+// per-edge visibility checks.
+struct TraversalView
+{
+    std::uint64_t graph_version = 0;
+    std::unordered_map<NodeId, std::uint32_t> node_index;
+    std::vector<std::vector<Edge>> operand_edges;
+    std::vector<std::vector<Edge>> user_edges;
+};
+
 class Graph
 {
    public:
@@ -212,6 +225,10 @@ class Graph
     std::unique_ptr<Node> remove_node(const Node *node);
 
     std::shared_ptr<EdgeAttributes> remove_edge(const Edge &edge);
+
+    // Batched edge edits, removal scans each consumer's operand set once instead of once per edge
+    void add_edges(const std::vector<Edge> &edges);
+    void remove_edges(const std::vector<Edge> &edges);
     void set_id(int id) { this->unique_id_ = id; }
     int id() const { return this->unique_id_; }
     const std::string &name() const { return this->name_; }
@@ -293,6 +310,8 @@ class Graph
     bool is_graph_traversal_context_set() const;
     bool is_node_virtual(const Node *node) const;
     bool is_edge_visible(const Edge &edge) const;
+    std::unique_ptr<TraversalView> materialize_traversal_view() const;
+    const TraversalView *valid_traversal_view() const;
 
     // two attributes to accomodate user-assigned graph-ids
     static GraphId last_graph_id_assigned_;
@@ -312,8 +331,15 @@ class Graph
     std::vector<NodeId> ordered_module_output_node_ids_;
     std::vector<NodeId> ordered_module_target_node_ids_;
 
-    // ordered by insertion order
-    std::vector<Node *> nodes_;
+    // ordered by insertion order, removed nodes leave a nullptr slot while a GraphMutation is open
+    mutable std::vector<Node *> nodes_;
+    mutable std::size_t num_removed_slots_ = 0;
+    mutable std::unordered_map<NodeId, std::size_t> node_slots_;
+    int num_open_mutations_ = 0;
+    // Live nodes handed out by nodes() while a mutation is open, removals only tombstone nodes_ so callers still
+    // iterating the snapshot never see a nullptr. Rebuilt on the next read after a node is added or removed.
+    mutable std::vector<Node *> nodes_snapshot_;
+    mutable bool nodes_snapshot_stale_ = true;
 
     NodeNameToNodeId node_name_to_node_id_;
     NodeIdToNodePtr nodes_map_raw_;
@@ -326,9 +352,16 @@ class Graph
     const std::unordered_set<const Node *> *virtual_node_traversal_context_ = nullptr;
     const std::unordered_set<graphlib::Edge> *ignored_edges_traversal_context_ = nullptr;
     const std::unordered_set<const Node *> *node_traversal_context_ = nullptr;
+    const TraversalView *traversal_view_ = nullptr;
     std::unordered_set<NodeId> virtual_nodes_;
 
+    // Bumped on every change that can affect edge visibility, invalidates the materialized traversal view
+    std::uint64_t structure_version_ = 0;
+
+    void compact_nodes() const;
+
     friend class GraphTraversalContext;
+    friend class GraphMutation;
     friend class tt::balancer::legalizer::GraphSolver;
 };
 
@@ -348,7 +381,9 @@ NodeClassType *Graph::add_node(std::unique_ptr<NodeClassType> node, unsigned int
     node_name_to_node_id_[node->name()] = node_id;
     nodes_map_[node_id] = std::move(node);
     NodeClassType *result = (NodeClassType *)nodes_map_[node_id].get();
+    node_slots_[node_id] = nodes_.size();
     nodes_.push_back(result);
+    nodes_snapshot_stale_ = true;
     nodes_map_raw_[node_id] = result;
     operands_map_[node_id] = {};
     users_map_[node_id] = {};
@@ -381,6 +416,7 @@ class GraphTraversalContext
         graph->virtual_node_traversal_context_ = context_virtual_nodes;
         graph->ignored_edges_traversal_context_ = edges_to_ignore;
         graph->node_traversal_context_ = nullptr;
+        set_traversal_view();
     }
 
     GraphTraversalContext(
@@ -393,6 +429,7 @@ class GraphTraversalContext
         graph->virtual_node_traversal_context_ = nullptr;
         graph->ignored_edges_traversal_context_ = nullptr;
         graph->node_traversal_context_ = node_traversal_context;
+        set_traversal_view();
     }
 
     GraphTraversalContext(
@@ -408,6 +445,7 @@ class GraphTraversalContext
         graph->virtual_node_traversal_context_ = context_virtual_nodes;
         graph->ignored_edges_traversal_context_ = edges_to_ignore;
         graph->node_traversal_context_ = node_traversal_context;
+        set_traversal_view();
     }
 
     ~GraphTraversalContext()
@@ -415,6 +453,7 @@ class GraphTraversalContext
         graph->virtual_node_traversal_context_ = virtual_node_traversal_context_cache;
         graph->ignored_edges_traversal_context_ = ignored_edges_traversal_context_cache;
         graph->node_traversal_context_ = node_traversal_context_cache;
+        graph->traversal_view_ = traversal_view_cache;
     }
 
    private:
@@ -422,6 +461,51 @@ class GraphTraversalContext
     const std::unordered_set<const Node *> *virtual_node_traversal_context_cache = nullptr;
     const std::unordered_set<graphlib::Edge> *ignored_edges_traversal_context_cache = nullptr;
     const std::unordered_set<const Node *> *node_traversal_context_cache = nullptr;
+    const TraversalView *traversal_view_cache = nullptr;
+    std::unique_ptr<TraversalView> traversal_view;
+
+    // Epoch scoped contexts are entered once and traversed many times by the solver and policies, materialize
+    // the visible subgraph of the context nodes up front
+    void set_traversal_view()
+    {
+        traversal_view_cache = graph->traversal_view_;
+        graph->traversal_view_ = nullptr;
+        if (graph->node_traversal_context_ != nullptr)
+            traversal_view = graph->materialize_traversal_view();
+        graph->traversal_view_ = traversal_view.get();
+    }
+};
+
+// Batches structural edits of a graph. While a mutation is open, remove_node only tombstones the node's slot in the
+// insertion-ordered node list, and the list is compacted once when the last open mutation ends. Passes deleting
+// thousands of nodes stay linear, and the resulting node order is the same as with one-by-one removal.
+//
+// Inside a mutation nodes() returns a snapshot of the live nodes, so removing nodes while iterating it is safe. The
+// snapshot is only rebuilt when nodes() is read again after nodes were added or removed.
+class GraphMutation
+{
+   public:
+    GraphMutation(graphlib::Graph *graph) : graph(graph) { graph->num_open_mutations_++; }
+    GraphMutation(const GraphMutation &other) = delete;
+    GraphMutation &operator=(const GraphMutation &other) = delete;
+
+    ~GraphMutation()
+    {
+        if (--graph->num_open_mutations_ == 0)
+        {
+            graph->compact_nodes();
+            graph->nodes_snapshot_.clear();
+            graph->nodes_snapshot_stale_ = true;
+        }
+    }
+
+    void remove_nodes(const std::vector<graphlib::Node *> &nodes)
+    {
+        for (graphlib::Node *node : nodes) graph->remove_node(node);
+    }
+
+   private:
+    graphlib::Graph *graph;
 };
 
 std::ostream &operator<<(std::ostream &out, const Edge &e);
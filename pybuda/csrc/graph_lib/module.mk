@@ -6,6 +6,7 @@ PYBUDA_CSRC_GRAPH_LIB_SRCS = \
 	pybuda/csrc/graph_lib/graph.cpp \
 	pybuda/csrc/graph_lib/node.cpp \
 	pybuda/csrc/graph_lib/node_types.cpp \
+	pybuda/csrc/graph_lib/op_registry.cpp \
 	pybuda/csrc/graph_lib/shape.cpp \
 	pybuda/csrc/graph_lib/utils.cpp \
 	pybuda/csrc/graph_lib/python_bindings.cpp
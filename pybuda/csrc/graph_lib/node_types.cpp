@@ -13,6 +13,7 @@
 #include "graph_lib/utils.hpp"
 #include "graph_lib/graph.hpp"
 #include "graph_lib/node.hpp"
+#include "graph_lib/op_registry.hpp"
 #include "graph_lib/python_bindings.hpp"
 
 namespace tt {
@@ -260,6 +261,9 @@ void PyOpNode::copy_parent_op_attributes(PyOpNode *node)
 
 bool OpNode::is_tm() const
 {
+    if (auto traits = get_builtin_op_traits(op_name(), node_type() != NodeType::kPyOp))
+        return traits->is_tm;
+
     std::string path = node_type() == NodeType::kPyOp ? "pybuda.op.eval.pybuda" : "pybuda.op.eval.buda";
     py::object eval_module = py::module_::import(path.c_str());
     py::function is_tm = eval_module.attr("is_tm");
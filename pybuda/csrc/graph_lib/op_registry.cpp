@@ -0,0 +1,482 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "graph_lib/op_registry.hpp"
+
+#include <unordered_map>
+
+#include "graph_lib/node_types.hpp"
+#include "utils/assert.hpp"
+
+namespace tt::graphlib
+{
+
+namespace
+{
+enum class OpModule
+{
+    EltwiseUnary,
+    EltwiseBinary,
+    EltwiseNary,
+    TM,
+    Other,
+};
+
+using OpTraitsMap = std::unordered_map<std::string, OpTraits>;
+
+void register_ops(OpTraitsMap &map, OpModule module, std::vector<std::string> const &ops)
+{
+    OpTraits traits;
+    traits.is_tm = module == OpModule::TM;
+    traits.is_eltwise_unary = module == OpModule::EltwiseUnary;
+    traits.is_eltwise_binary = module == OpModule::EltwiseBinary;
+    traits.is_eltwise_nary = module == OpModule::EltwiseNary;
+    traits.is_eltwise = traits.is_eltwise_unary or traits.is_eltwise_binary or traits.is_eltwise_nary;
+    for (std::string const &op : ops) map[op] = traits;
+}
+
+OpTraitsMap const &pybuda_ops()
+{
+    static OpTraitsMap const map = []
+    {
+        OpTraitsMap map;
+        register_ops(
+            map,
+            OpModule::EltwiseBinary,
+            {"add",
+             "divide",
+             "subtract",
+             "multiply",
+             "maximum",
+             "minimum",
+             "heaviside",
+             "binary_stack",
+             "power",
+             "greater",
+             "greater_equal",
+             "less",
+             "less_equal",
+             "equal",
+             "not_equal",
+             "logical_and"});
+        register_ops(
+            map,
+            OpModule::EltwiseUnary,
+            {"nop",      "buffer",      "exp",    "reciprocal", "sqrt",           "relu",   "leaky_relu", "gelu",
+             "gelu_derivative", "log",  "sigmoid", "clip",      "abs",            "cosine", "sine",
+             "tile_broadcast",  "argmax", "tanh",  "cumsum",    "logical_not",    "dropout", "pow",
+             "tilizer",         "erf"});
+        register_ops(
+            map, OpModule::EltwiseNary, {"conv_sum", "concatenate", "where", "index_copy", "interleave", "stack"});
+        register_ops(
+            map,
+            OpModule::TM,
+            {"transpose",
+             "adv_index",
+             "reshape",
+             "index",
+             "select",
+             "gather",
+             "hslice",
+             "hstack",
+             "vslice",
+             "vstack",
+             "broadcast",
+             "repeat",
+             "repeat_dim",
+             "conv2d_depthwise_weights",
+             "conv2d_depthwise_weights_bw",
+             "conv2d_grouped_weights",
+             "conv2d_grouped_weights_bw",
+             "conv2d_prestride_act",
+             "conv2d_prestride_weights",
+             "pad_tile",
+             "narrow",
+             "pad",
+             "unsqueeze",
+             "squeeze",
+             "pixel_shuffle",
+             "buda_pad",
+             "buda_unpad"});
+        register_ops(
+            map,
+            OpModule::Other,
+            {"matmul",       "sparse_matmul", "depthwise",  "embedding",     "reduce_avg",      "reduce_sum",
+             "reduce_max",   "grouped_reduce_avg", "conv2d", "conv2d_transpose", "conv3d",      "max_pool1d",
+             "max_pool2d",   "max_pool3d",    "avg_pool1d", "avg_pool2d",    "constant",        "resize2d",
+             "resize3d",     "dram_queue",    "softmax",    "log_softmax",   "softmax_bw",      "mask",
+             "layernorm",    "layernorm_bw",  "batchnorm",  "quantize",      "buda_quantize",   "dequantize",
+             "requantize",   "buda_requantize", "buda_dequantize"});
+        return map;
+    }();
+    return map;
+}
+
+OpTraitsMap const &buda_ops()
+{
+    static OpTraitsMap const map = []
+    {
+        OpTraitsMap map;
+        register_ops(
+            map,
+            OpModule::EltwiseBinary,
+            {"add",
+             "subtract",
+             "multiply",
+             "maximum",
+             "minimum",
+             "heaviside",
+             "binary_vstack",
+             "binary_hstack",
+             "greater",
+             "greater_equal",
+             "less",
+             "less_equal",
+             "equal",
+             "not_equal"});
+        register_ops(
+            map,
+            OpModule::EltwiseUnary,
+            {"ethernet_datacopy", "nop",     "buffer", "exp",    "reciprocal", "sqrt",  "lrelu",
+             "gelu",              "gelu_derivative",   "log",    "sigmoid",    "tanh",  "abs",
+             "dropout",           "cosine",  "sine",   "power",  "tilizer"});
+        // Live in eltwise_unary, but is_eltwise_unary excludes them
+        register_ops(map, OpModule::EltwiseUnary, {"clip", "reduce"});
+        map["clip"].is_eltwise_unary = false;
+        map["reduce"].is_eltwise_unary = false;
+        register_ops(
+            map, OpModule::EltwiseNary, {"conv_sum", "hconcat", "vconcat", "concatenate", "index_copy", "splice"});
+        register_ops(
+            map,
+            OpModule::TM,
+            {"transpose",
+             "reshape",
+             "select",
+             "gather",
+             "hslice",
+             "hstack",
+             "vslice",
+             "vstack",
+             "broadcast",
+             "conv2d_grouped_weights",
+             "conv2d_prestride_act",
+             "tile_broadcast",
+             "buda_pad",
+             "buda_unpad"});
+        register_ops(
+            map,
+            OpModule::Other,
+            {"matmul",
+             "depthwise",
+             "embedding",
+             "constant",
+             "dram_queue",
+             "fused_op",
+             "quantization",
+             "dequantization",
+             "requantization",
+             "void"});
+        return map;
+    }();
+    return map;
+}
+
+std::uint32_t align_up(std::uint32_t value, std::uint32_t alignment)
+{
+    return ((value + alignment - 1) / alignment) * alignment;
+}
+
+std::optional<bool> attr_as_bool(OpType::Attr const &attr)
+{
+    if (std::holds_alternative<bool>(attr))
+        return std::get<bool>(attr);
+    if (std::holds_alternative<int>(attr))
+        return std::get<int>(attr) != 0;
+    return std::nullopt;
+}
+
+std::optional<int> named_int_attr(OpType const &op_type, std::string const &name)
+{
+    auto it = op_type.named_attrs.find(name);
+    if (it == op_type.named_attrs.end() or not std::holds_alternative<int>(it->second))
+        return std::nullopt;
+    return std::get<int>(it->second);
+}
+
+// Row dim of a buda op output, rounded to the tile height the way eltwise and matmul shape functions do it
+void align_buda_rows(std::vector<std::uint32_t> &dims, int tile_height)
+{
+    std::uint32_t &rows = dims[dims.size() - 2];
+    if (rows > (std::uint32_t)tile_height and tile_height != Shape::BUDA_TILE_DIM)
+        rows = tile_height;
+    else
+        rows = align_up(rows, tile_height);
+}
+
+std::optional<NativeOpShape> buda_eltwise_binary_shape(OpType const &op_type, std::vector<Shape> const &operands, int tile_height)
+{
+    if (operands.size() != 2 or not op_type.attr.empty() or op_type.op == "binary_vstack" or
+        op_type.op == "binary_hstack")
+        return std::nullopt;
+
+    std::vector<std::uint32_t> in0 = operands[0].as_vector();
+    std::vector<std::uint32_t> in1 = operands[1].as_vector();
+    if (in0.size() != in1.size())
+        return std::nullopt;
+
+    std::vector<std::uint32_t> dims = in0;
+    std::vector<DimBroadcast> broadcasts;
+    int dim_r = (int)dims.size() - 2;
+    for (int dim = dim_r; dim < dim_r + 2; dim++)
+    {
+        if (in0[dim] == in1[dim])
+            continue;
+        if (in1[dim] == Shape::BUDA_TILE_DIM)
+        {
+            broadcasts.emplace_back(1, dim, in0[dim]);
+        }
+        else if (in0[dim] == Shape::BUDA_TILE_DIM)
+        {
+            broadcasts.emplace_back(0, dim, in1[dim]);
+            dims[dim] = in1[dim];
+        }
+        else
+        {
+            // Let python raise the error
+            return std::nullopt;
+        }
+    }
+
+    align_buda_rows(dims, tile_height);
+    return NativeOpShape(dims, broadcasts);
+}
+
+std::optional<NativeOpShape> buda_matmul_shape(OpType const &op_type, std::vector<Shape> const &operands, int tile_height)
+{
+    if (operands.size() < 2 or operands.size() > 4)
+        return std::nullopt;
+
+    std::optional<bool> accumulate = op_type.attr.size() >= 1 ? attr_as_bool(op_type.attr[0]) : false;
+    std::optional<bool> is_sparse = op_type.attr.size() >= 2 ? attr_as_bool(op_type.attr[1]) : false;
+    if (not accumulate or not is_sparse or *is_sparse)
+        return std::nullopt;
+
+    std::vector<std::uint32_t> in0 = operands[0].as_vector();
+    std::vector<std::uint32_t> in1 = operands[1].as_vector();
+    if (in0.size() < 3 or in1.size() < 3)
+        return std::nullopt;
+
+    std::vector<std::uint32_t> dims;
+    if (in1.size() > in0.size())
+    {
+        dims.assign(in1.begin(), in1.end() - 2);
+        dims.push_back(in0[in0.size() - 2]);
+    }
+    else
+    {
+        dims.assign(in0.begin(), in0.end() - 1);
+    }
+    dims.push_back(in1.back());
+    align_buda_rows(dims, tile_height);
+
+    std::vector<DimBroadcast> broadcasts;
+    std::uint32_t z0 = in0[in0.size() - 3], z1 = in1[in1.size() - 3];
+    if (z0 != z1)
+    {
+        if (z0 == 1)
+            broadcasts.emplace_back(0, 1, z1);
+        else if (z1 == 1)
+            broadcasts.emplace_back(1, 1, z0);
+        else
+            return std::nullopt;
+        dims[dims.size() - 3] = std::max(z0, z1);
+    }
+
+    std::uint32_t inner0 = in0.back(), inner1 = in1[in1.size() - 2];
+    if (inner0 != inner1)
+    {
+        if (inner0 == Shape::BUDA_TILE_DIM)
+        {
+            broadcasts.emplace_back(0, 3, inner1);
+            dims.back() = inner1;
+        }
+        else if (inner1 == Shape::BUDA_TILE_DIM)
+        {
+            broadcasts.emplace_back(1, 2, inner0);
+            dims[dims.size() - 2] = inner0;
+        }
+        else
+        {
+            return std::nullopt;
+        }
+    }
+
+    if (*accumulate)
+        dims[dims.size() - 3] = 1;
+
+    return NativeOpShape(dims, broadcasts);
+}
+
+std::optional<NativeOpShape> buda_op_shape(
+    OpType const &op_type, std::vector<Shape> const &operands, int tile_height, int tile_width)
+{
+    if (tile_height > Shape::BUDA_TILE_DIM)
+        return std::nullopt;
+
+    std::string const &op = op_type.op;
+    if (op == "matmul")
+        return buda_matmul_shape(op_type, operands, tile_height);
+
+    if (op == "transpose" and operands.size() == 1)
+    {
+        std::optional<int> dim0 = named_int_attr(op_type, "dim0");
+        std::optional<int> dim1 = named_int_attr(op_type, "dim1");
+        if (not dim0 or not dim1)
+            return std::nullopt;
+
+        std::vector<std::uint32_t> dims = operands[0].as_vector();
+        int rank = (int)dims.size();
+        int d0 = *dim0 < 0 ? *dim0 + rank : *dim0;
+        int d1 = *dim1 < 0 ? *dim1 + rank : *dim1;
+        TT_ASSERT(d0 == rank - 2 and d1 == rank - 1, "Buda TM transpose can only transpose R/C dims", op_type.as_string());
+        std::swap(dims[d0], dims[d1]);
+        return NativeOpShape(dims, {});
+    }
+
+    if (op == "broadcast" and operands.size() == 1 and op_type.attr.size() >= 2 and
+        std::holds_alternative<int>(op_type.attr[0]) and std::holds_alternative<int>(op_type.attr[1]))
+    {
+        std::vector<std::uint32_t> dims = operands[0].as_vector();
+        int dim = std::get<int>(op_type.attr[0]);
+        if (dim < 0)
+            dim += dims.size();
+        dims[dims.size() - 2] = align_up(dims[dims.size() - 2], tile_height);
+        dims[dims.size() - 1] = align_up(dims[dims.size() - 1], tile_width);
+        dims[dim] *= std::get<int>(op_type.attr[1]);
+        return NativeOpShape(dims, {});
+    }
+
+    if (op == "tile_broadcast" and operands.size() == 1)
+        return NativeOpShape(operands[0].as_vector(), {});
+
+    std::optional<OpTraits> traits = get_builtin_op_traits(op, true);
+    if (not traits)
+        return std::nullopt;
+
+    if (traits->is_eltwise_binary)
+        return buda_eltwise_binary_shape(op_type, operands, tile_height);
+
+    // reduce and unsqueezing nops change the shape
+    bool is_unsqueeze = op == "nop" and op_type.attr.size() == 2;
+    if (traits->is_eltwise_unary and not is_unsqueeze and operands.size() == 1)
+    {
+        std::vector<std::uint32_t> dims = operands[0].as_vector();
+        align_buda_rows(dims, tile_height);
+        return NativeOpShape(dims, {});
+    }
+
+    return std::nullopt;
+}
+
+std::optional<NativeOpShape> pybuda_op_shape(OpType const &op_type, std::vector<Shape> const &operands)
+{
+    std::optional<OpTraits> traits = get_builtin_op_traits(op_type.op, false);
+    if (not traits)
+        return std::nullopt;
+
+    if (traits->is_eltwise_unary and operands.size() == 1 and op_type.op != "argmax" and
+        op_type.op != "tile_broadcast")
+        return NativeOpShape(operands[0].as_vector(), {});
+
+    if (traits->is_eltwise_binary and operands.size() == 2 and op_type.attr.empty() and op_type.op != "binary_stack")
+    {
+        std::vector<std::uint32_t> in0 = operands[0].as_vector();
+        std::vector<std::uint32_t> in1 = operands[1].as_vector();
+        while (in0.size() < in1.size()) in0.insert(in0.begin(), 1);
+        while (in1.size() < in0.size()) in1.insert(in1.begin(), 1);
+
+        int rank = (int)in0.size();
+        std::vector<std::uint32_t> dims;
+        std::vector<DimBroadcast> broadcasts;
+        for (int dim = 0; dim < rank; dim++)
+        {
+            if (in0[dim] == in1[dim])
+            {
+                dims.push_back(in0[dim]);
+            }
+            else if (in1[dim] == 1)
+            {
+                broadcasts.emplace_back(1, dim - rank, in0[dim]);
+                dims.push_back(in0[dim]);
+            }
+            else if (in0[dim] == 1)
+            {
+                broadcasts.emplace_back(0, dim - rank, in1[dim]);
+                dims.push_back(in1[dim]);
+            }
+            else
+            {
+                // Let python raise the error
+                return std::nullopt;
+            }
+        }
+        return NativeOpShape(dims, broadcasts);
+    }
+
+    return std::nullopt;
+}
+}  // namespace
+
+std::optional<OpTraits> get_builtin_op_traits(std::string const &op_name, bool is_buda)
+{
+    OpTraitsMap const &map = is_buda ? buda_ops() : pybuda_ops();
+    auto it = map.find(op_name);
+    if (it == map.end())
+        return std::nullopt;
+    return it->second;
+}
+
+std::optional<NativeOpShape> get_builtin_op_shape(
+    OpType const &op_type, std::vector<Shape> const &operands, bool is_buda, int tile_height, int tile_width)
+{
+    return is_buda ? buda_op_shape(op_type, operands, tile_height, tile_width) : pybuda_op_shape(op_type, operands);
+}
+
+std::optional<std::pair<int, int>> get_builtin_op_parallelization(
+    OpType const &op_type, int output_rt, int output_ct, int fracture_factor)
+{
+    std::string const &op = op_type.op;
+    if (op == "matmul")
+    {
+        std::optional<bool> is_sparse = op_type.attr.size() >= 2 ? attr_as_bool(op_type.attr[1]) : false;
+        if (not is_sparse)
+            return std::nullopt;
+        if (not *is_sparse)
+            return std::make_pair(output_rt, output_ct);
+        TT_ASSERT(output_rt % fracture_factor == 0);
+        return std::make_pair(output_rt / fracture_factor, output_ct * fracture_factor);
+    }
+
+    if (op == "reduce")
+    {
+        if (op_type.attr.empty() or not std::holds_alternative<int>(op_type.attr[0]))
+            return std::nullopt;
+        switch (std::get<int>(op_type.attr[0]))
+        {
+            case 1: return std::make_pair(output_rt, output_ct);
+            case 2: return std::make_pair(1, output_ct);
+            case 3: return std::make_pair(output_rt, 1);
+            default: return std::nullopt;
+        }
+    }
+
+    // Stacking binaries aren't supported by HW, python reports them
+    std::optional<OpTraits> traits = get_builtin_op_traits(op, true);
+    if (traits and (traits->is_eltwise_unary or op == "clip" or
+                    (traits->is_eltwise_binary and op != "binary_vstack" and op != "binary_hstack")))
+        return std::make_pair(output_rt, output_ct);
+
+    return std::nullopt;
+}
+
+}  // namespace tt::graphlib
@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "graph_lib/shape.hpp"
+
+namespace tt::graphlib
+{
+struct OpType;
+
+//
+// Native metadata for the built-in op set, so that passes can query op classes, shapes and parallelization without
+// going through pybuda.op.eval on every node.
+//
+// The tables mirror op_to_module_map of pybuda.op.eval.pybuda and pybuda.op.eval.buda and have to be kept in sync
+// with them. Ops the registry doesn't know (custom ops, or built-in ops whose rule isn't ported) return nullopt, and
+// callers fall back to the python implementation.
+//
+struct OpTraits
+{
+    bool is_tm = false;
+    bool is_eltwise = false;
+    bool is_eltwise_unary = false;
+    bool is_eltwise_binary = false;
+    bool is_eltwise_nary = false;
+};
+
+std::optional<OpTraits> get_builtin_op_traits(std::string const &op_name, bool is_buda);
+
+// Output dims and operand broadcasts, same as get_f_pybuda_shape would return
+using NativeOpShape = std::tuple<std::vector<std::uint32_t>, std::vector<DimBroadcast>>;
+std::optional<NativeOpShape> get_builtin_op_shape(
+    OpType const &op_type,
+    std::vector<Shape> const &operands,
+    bool is_buda,
+    int tile_height = Shape::BUDA_TILE_DIM,
+    int tile_width = Shape::BUDA_TILE_DIM);
+
+// Grid (r, c) the buda op can be parallelized over, for the given output shape in tiles
+std::optional<std::pair<int, int>> get_builtin_op_parallelization(
+    OpType const &op_type, int output_rt, int output_ct, int fracture_factor);
+
+}  // namespace tt::graphlib
@@ -2,8 +2,10 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 #include "graph_lib/node_types.hpp"
+#include "graph_lib/op_registry.hpp"
 #include "graph_lib/utils.hpp"
 #include "gtest/gtest.h"
+#include "test/graph_api.hpp"
 
 using namespace tt::graphlib;
 
@@ -143,3 +145,137 @@ TEST_F(GraphlibTest, kernel_broadcast_stack)
         }
     }
 }
+
+TEST_F(GraphlibTest, builtin_op_traits)
+{
+    EXPECT_TRUE(get_builtin_op_traits("add", true)->is_eltwise_binary);
+    EXPECT_TRUE(get_builtin_op_traits("transpose", false)->is_tm);
+    EXPECT_TRUE(get_builtin_op_traits("splice", true)->is_eltwise_nary);
+
+    // Different module on each level
+    EXPECT_TRUE(get_builtin_op_traits("tile_broadcast", false)->is_eltwise_unary);
+    EXPECT_TRUE(get_builtin_op_traits("tile_broadcast", true)->is_tm);
+
+    // Eltwise, but not unary
+    OpTraits reduce = *get_builtin_op_traits("reduce", true);
+    EXPECT_TRUE(reduce.is_eltwise);
+    EXPECT_FALSE(reduce.is_eltwise_unary);
+
+    EXPECT_FALSE(get_builtin_op_traits("my_custom_op", false).has_value());
+}
+
+TEST_F(GraphlibTest, builtin_op_shape)
+{
+    auto [dims, broadcasts] = *get_builtin_op_shape(
+        OpType("matmul"), {Shape::create_buda({1, 1, 64, 32}), Shape::create_buda({1, 4, 128, 96})}, true);
+    EXPECT_EQ(dims, (std::vector<std::uint32_t>{1, 4, 64, 128}));
+    ASSERT_EQ(broadcasts.size(), 2);
+    EXPECT_EQ(broadcasts[0], DimBroadcast(0, 1, 4));
+    EXPECT_EQ(broadcasts[1], DimBroadcast(0, 3, 128));
+
+    std::tie(dims, broadcasts) =
+        *get_builtin_op_shape(OpType("multiply"), {Shape::create({8, 1, 16}), Shape::create({4, 1})}, false);
+    EXPECT_EQ(dims, (std::vector<std::uint32_t>{8, 4, 16}));
+    ASSERT_EQ(broadcasts.size(), 3);
+    EXPECT_EQ(broadcasts[0], DimBroadcast(1, -3, 8));
+    EXPECT_EQ(broadcasts[1], DimBroadcast(0, -2, 4));
+    EXPECT_EQ(broadcasts[2], DimBroadcast(1, -1, 16));
+
+    // Sparse matmul isn't ported, goes to python
+    EXPECT_FALSE(get_builtin_op_shape(
+                     OpType("matmul", {false, true}),
+                     {Shape::create_buda({1, 1, 64, 32}), Shape::create_buda({1, 1, 32, 32})},
+                     true)
+                     .has_value());
+}
+
+TEST_F(GraphlibTest, builtin_op_parallelization)
+{
+    EXPECT_EQ(get_builtin_op_parallelization(OpType("gelu"), 4, 8, 1), std::make_pair(4, 8));
+    EXPECT_EQ(get_builtin_op_parallelization(OpType("reduce", {2, std::string("sum"), 1}), 4, 8, 1), std::make_pair(1, 8));
+    EXPECT_EQ(get_builtin_op_parallelization(OpType("matmul", {false, true}), 4, 8, 2), std::make_pair(2, 16));
+    EXPECT_FALSE(get_builtin_op_parallelization(OpType("binary_vstack"), 4, 8, 1).has_value());
+}
+
+TEST_F(GraphlibTest, graph_mutation_batched_removal)
+{
+    Graph graph(IRLevel::IR_BUDA);
+    Shape shape = Shape::create_buda(1, 1, 32, 32);
+    auto in0 = tt::create_input(graph, "in0", shape);
+    auto in1 = tt::create_input(graph, "in1", shape);
+    auto nop0 = tt::add_node<BudaOpNode>(graph, "nop0", "nop", {}, {in0});
+    auto nop1 = tt::add_node<BudaOpNode>(graph, "nop1", "nop", {}, {in1});
+    auto add = tt::add_node<BudaOpNode>(graph, "add", "add", {}, {nop0, nop1});
+    auto out = tt::create_output(graph, "out", add);
+
+    {
+        GraphMutation mutation(&graph);
+        graph.remove_edges(graph.operand_data_edges(add));
+        mutation.remove_nodes({nop1, in1});
+        EXPECT_FALSE(graph.has_node_with_name("nop1"));
+        EXPECT_EQ(graph.operand_data_edges(add).size(), 0);
+        EXPECT_EQ(graph.user_data_edges(nop0).size(), 0);
+
+        // Filtered copies of the node list can be taken in the middle of a mutation and see the removals
+        EXPECT_EQ(graph.nodes([](Node *) { return true; }), std::vector<Node *>({in0, nop0, add, out}));
+        mutation.remove_nodes({nop0});
+    }
+
+    EXPECT_EQ(graph.nodes(), std::vector<Node *>({in0, add, out}));
+    EXPECT_EQ(graph.node_by_id(add->id()), add);
+
+    graph.add_edges(
+        {Edge(in0->id(), 0, add->id(), 0, EdgeType::kData), Edge(in0->id(), 0, add->id(), 1, EdgeType::kData)});
+    EXPECT_EQ(graph.operand_data_edges(add).size(), 2);
+
+    {
+        // Inside a mutation nodes() hands out a snapshot, removing nodes while iterating it doesn't touch it
+        GraphMutation mutation(&graph);
+        const std::vector<Node *> &snapshot = graph.nodes();
+        std::vector<Node *> visited;
+        for (Node *node : snapshot)
+        {
+            visited.push_back(node);
+            if (node == in0)
+                mutation.remove_nodes({in0});
+        }
+        EXPECT_EQ(visited, std::vector<Node *>({in0, add, out}));
+        EXPECT_EQ(graph.nodes(), std::vector<Node *>({add, out}));
+    }
+
+    EXPECT_EQ(graph.nodes(), std::vector<Node *>({add, out}));
+    EXPECT_EQ(graph.operand_data_edges(add).size(), 0);
+}
+
+TEST_F(GraphlibTest, epoch_traversal_view)
+{
+    Graph graph(IRLevel::IR_BUDA);
+    Shape shape = Shape::create_buda(1, 1, 32, 32);
+    auto in0 = tt::create_input(graph, "in0", shape);
+    auto nop0 = tt::add_node<BudaOpNode>(graph, "nop0", "nop", {}, {in0});
+    auto nop1 = tt::add_node<BudaOpNode>(graph, "nop1", "nop", {}, {nop0});
+    auto add = tt::add_node<BudaOpNode>(graph, "add", "add", {}, {nop0, nop1});
+    tt::create_output(graph, "out", add);
+
+    std::unordered_set<const Node *> epoch_nodes = {nop0, nop1, add};
+    Edge ignored_edge = graph.get_edges(nop0, nop1)[0];
+    std::unordered_set<Edge> edges_to_ignore = {ignored_edge};
+    std::unordered_set<const Node *> virtual_nodes;
+    {
+        GraphTraversalContext epoch_context(&graph, &epoch_nodes, &virtual_nodes, &edges_to_ignore);
+
+        // Edges leaving the epoch and ignored edges are filtered out of the view
+        EXPECT_EQ(graph.operand_edges(nop0).size(), 0);
+        EXPECT_EQ(graph.data_users(nop0), std::vector<Node *>({add}));
+        EXPECT_EQ(graph.data_operands(add), std::vector<Node *>({nop0, nop1}));
+        EXPECT_EQ(graph.user_edges(add).size(), 0);
+        EXPECT_EQ(graph.operand_data_edges(add, [](Edge edge) { return edge.consumer_input_port_id == 1; }).size(), 1);
+
+        // Structural edits invalidate the view, queries see the current graph
+        graph.remove_edge(graph.get_edges(nop1, add)[0]);
+        EXPECT_EQ(graph.data_operands(add), std::vector<Node *>({nop0}));
+    }
+
+    EXPECT_EQ(graph.data_operands(nop0), std::vector<Node *>({in0}));
+    EXPECT_EQ(graph.data_users(nop0).size(), 2);
+}
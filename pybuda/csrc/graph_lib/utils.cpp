@@ -13,6 +13,7 @@
 #include "graph_lib/edge.hpp"
 #include "graph_lib/node.hpp"
 #include "graph_lib/node_types.hpp"
+#include "graph_lib/op_registry.hpp"
 #include "autograd/binding.hpp"
 #include "utils/logger.hpp"
 #include "reportify/reportify.hpp"
@@ -25,6 +26,9 @@ namespace graphlib {
 bool is_eltwise(const OpNode *op)
 {
     bool is_buda = dynamic_cast<const BudaOpNode *>(op) != nullptr;
+    if (auto traits = get_builtin_op_traits(op->op_name(), is_buda))
+        return traits->is_eltwise and op->op_name() != "concatenate";
+
     py::object eval_module = py::module_::import(is_buda ? "pybuda.op.eval.buda" : "pybuda.op.eval.pybuda");
     py::function is_eltwise = eval_module.attr("is_eltwise");
     // TODO: better determination of non elementwise ops
@@ -35,6 +39,9 @@ bool is_eltwise(const OpNode *op)
 bool is_eltwise_nary(const OpNode *op)
 {
     bool is_buda = dynamic_cast<const BudaOpNode *>(op) != nullptr;
+    if (auto traits = get_builtin_op_traits(op->op_name(), is_buda))
+        return traits->is_eltwise_nary;
+
     py::object eval_module = py::module_::import(is_buda ? "pybuda.op.eval.buda" : "pybuda.op.eval.pybuda");
     py::function is_eltwise_nary = eval_module.attr("is_eltwise_nary");
     return is_eltwise_nary(op->op_type()).cast<bool>();
@@ -43,6 +50,9 @@ bool is_eltwise_nary(const OpNode *op)
 bool is_eltwise_unary(const OpNode *op)
 {
     bool is_buda = dynamic_cast<const BudaOpNode *>(op) != nullptr;
+    if (auto traits = get_builtin_op_traits(op->op_name(), is_buda))
+        return traits->is_eltwise_unary;
+
     py::object eval_module = py::module_::import(is_buda ? "pybuda.op.eval.buda" : "pybuda.op.eval.pybuda");
     py::function is_eltwise_unary = eval_module.attr("is_eltwise_unary");
     return is_eltwise_unary(op->op_type()).cast<bool>();
@@ -51,6 +61,9 @@ bool is_eltwise_unary(const OpNode *op)
 bool is_eltwise_binary(const OpNode *op)
 {
     bool is_buda = dynamic_cast<const BudaOpNode *>(op) != nullptr;
+    if (auto traits = get_builtin_op_traits(op->op_name(), is_buda))
+        return traits->is_eltwise_binary;
+
     py::object eval_module = py::module_::import(is_buda ? "pybuda.op.eval.buda" : "pybuda.op.eval.pybuda");
     py::function is_eltwise_binary = eval_module.attr("is_eltwise_binary");
     return is_eltwise_binary(op->op_type()).cast<bool>();
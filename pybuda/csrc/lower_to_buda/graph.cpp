@@ -39,25 +39,34 @@ std::vector<std::uint32_t> BudaGraph::get_matching_epoch(graphlib::NodeEpochType
     return ret;
 }
 
-std::ostream &operator<<(std::ostream &os, BudaGraph const &g) {
+bool BudaGraph::is_epoch_emitted(std::size_t epoch) const
+{
+    return not (arch_name == "grayskull" and ops[epoch].size() == 0);
+}
+
+void BudaGraph::dump_epoch(std::ostream &os, std::size_t epoch) const
+{
+    if (not is_epoch_emitted(epoch))
+        return;
 
     const std::string indent = "    ";
-    for (std::size_t epoch = 0; epoch < g.ops.size(); epoch++) {
-        if (g.arch_name == "grayskull" and g.ops[epoch].size() == 0)
-        {
-            continue;
-        }
-        os << "  " << get_subgraph_name(g.epoch_types[epoch], epoch, g.arch_name, g.epoch_to_temporal_epoch_id[epoch], g.epoch_to_subgraph_index[epoch]) << ":" << std::endl;
-        os << indent << "target_device: " << g.epoch_target_devices[epoch] << std::endl;
+    os << "  " << get_subgraph_name(epoch_types[epoch], epoch, arch_name, epoch_to_temporal_epoch_id[epoch], epoch_to_subgraph_index[epoch]) << ":" << std::endl;
+    os << indent << "target_device: " << epoch_target_devices[epoch] << std::endl;
 
-        int input_count = (g.epoch_types[epoch] == graphlib::NodeEpochType::Optimizer) ? 1 : g.microbatch_size;
-        os << indent << "input_count: " << input_count << std::endl;
-        for (const BudaOp &op : g.ops[epoch]) {
-            if (op.debug_info)
-                os << std::endl << op.debug_info;
-            os << indent << op << std::endl;
-        }
-        os << std::endl;
+    int input_count = (epoch_types[epoch] == graphlib::NodeEpochType::Optimizer) ? 1 : microbatch_size;
+    os << indent << "input_count: " << input_count << std::endl;
+    for (const BudaOp &op : ops[epoch]) {
+        if (op.debug_info)
+            os << std::endl << op.debug_info;
+        os << indent << op << std::endl;
+    }
+    os << std::endl;
+}
+
+std::ostream &operator<<(std::ostream &os, BudaGraph const &g) {
+
+    for (std::size_t epoch = 0; epoch < g.ops.size(); epoch++) {
+        g.dump_epoch(os, epoch);
     }
 
     return os;
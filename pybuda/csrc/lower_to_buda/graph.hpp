@@ -23,6 +23,10 @@ struct BudaGraph {
         : name(name), arch_name(arch_name), microbatch_size(microbatch) {}
     std::vector<std::uint32_t> get_matching_epoch(graphlib::NodeEpochType type) const;
 
+    // Each epoch is emitted as its own netlist graph; empty epochs are skipped on grayskull
+    bool is_epoch_emitted(std::size_t epoch) const;
+    void dump_epoch(std::ostream &os, std::size_t epoch) const;
+
 };
 
 std::string get_subgraph_name(graphlib::NodeEpochType epoch_type, int epoch_number, const std::string& arch_name, std::uint32_t temporal_epoch_id, std::uint32_t subgraph_index);
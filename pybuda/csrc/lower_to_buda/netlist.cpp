@@ -3,7 +3,16 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "lower_to_buda/netlist.hpp"
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <future>
 #include <sstream>
+#include <streambuf>
+#include <thread>
 
 #include "buda_passes.hpp"
 #include "graph_lib/graph.hpp"
@@ -28,35 +37,157 @@ using Node = graphlib::Node;
 using NodeType = graphlib::NodeType;
 using Edge = graphlib::Edge;
 
+namespace
+{
+// Buffered std::streambuf writing straight to a file descriptor, so netlists can be emitted without first being
+// assembled in memory
+class FdStreamBuf : public std::streambuf
+{
+   public:
+    explicit FdStreamBuf(int fd, std::size_t buffer_size = 1 << 20) : fd_(fd), buffer_(buffer_size)
+    {
+        setp(buffer_.data(), buffer_.data() + buffer_.size());
+    }
+
+    ~FdStreamBuf() { flush_buffer(); }
+
+    // Write out whatever is still buffered, returns false on failure
+    bool finish() { return flush_buffer(); }
+
+   protected:
+    int_type overflow(int_type ch) override
+    {
+        if (not flush_buffer())
+            return traits_type::eof();
+        if (not traits_type::eq_int_type(ch, traits_type::eof()))
+        {
+            *pptr() = traits_type::to_char_type(ch);
+            pbump(1);
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(const char *s, std::streamsize n) override
+    {
+        // Large writes bypass the buffer
+        if (n >= static_cast<std::streamsize>(buffer_.size()))
+            return (flush_buffer() and write_all(s, n)) ? n : 0;
+        return std::streambuf::xsputn(s, n);
+    }
+
+    // Netlist lines end with std::endl, flushing on each would turn every line into a write syscall. Data goes out
+    // when the buffer fills up, or on finish().
+    int sync() override { return 0; }
+
+   private:
+    int fd_;
+    std::vector<char> buffer_;
+
+    bool write_all(const char *data, std::size_t size)
+    {
+        while (size > 0)
+        {
+            ssize_t written = ::write(fd_, data, size);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                return false;
+            }
+            data += written;
+            size -= written;
+        }
+        return true;
+    }
+
+    bool flush_buffer()
+    {
+        std::size_t size = pptr() - pbase();
+        bool ok = write_all(pbase(), size);
+        setp(buffer_.data(), buffer_.data() + buffer_.size());
+        return ok;
+    }
+};
+
 void dump_group_of_queues(
-    std::stringstream &ss, const std::string &type, const std::vector<BudaQueue> &qs, std::size_t longest_name)
+    std::ostream &os,
+    const std::string &type,
+    const std::vector<BudaQueue> &queues,
+    const std::vector<std::size_t> &indices,
+    std::size_t longest_name)
 {
-    if (qs.size() > 0)
+    if (indices.size() > 0)
     {
-        ss << std::endl
+        os << std::endl
            << "  "
            << "# " << type << std::endl;
-        for (const BudaQueue &q : qs)
+        for (std::size_t index : indices)
         {
-            ss << "  " << q.as_string(longest_name) << std::endl;
+            os << "  " << queues[index].as_string(longest_name) << std::endl;
         }
     }
 }
 
-std::string BudaNetlist::dump_to_yaml() const
+void dump_graphs(std::ostream &os, const std::vector<BudaGraph> &graphs, bool parallel)
 {
-    std::stringstream ss;
+    if (not parallel)
+    {
+        for (const BudaGraph &g : graphs) os << g;
+        return;
+    }
 
-    ss << comments;
+    // Every epoch is an independent netlist graph, so they are formatted concurrently into their own buffers and
+    // written out in order. Work is done in windows to bound the memory held by formatted-but-unwritten epochs.
+    std::vector<std::pair<const BudaGraph *, std::size_t>> jobs;
+    for (const BudaGraph &g : graphs)
+        for (std::size_t epoch = 0; epoch < g.ops.size(); epoch++)
+            if (g.is_epoch_emitted(epoch))
+                jobs.emplace_back(&g, epoch);
+
+    std::size_t num_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::size_t window = num_threads * 4;
+    std::vector<std::string> buffers(std::min(window, jobs.size()));
+    for (std::size_t window_start = 0; window_start < jobs.size(); window_start += window)
+    {
+        std::size_t window_size = std::min(window, jobs.size() - window_start);
+        std::atomic<std::size_t> next_job{0};
+        auto worker = [&]()
+        {
+            for (std::size_t i = next_job++; i < window_size; i = next_job++)
+            {
+                auto const &[g, epoch] = jobs[window_start + i];
+                std::ostringstream ss;
+                g->dump_epoch(ss, epoch);
+                buffers[i] = ss.str();
+            }
+        };
+
+        std::vector<std::future<void>> workers;
+        for (std::size_t t = 0; t < std::min(num_threads, window_size); t++)
+            workers.push_back(std::async(std::launch::async, worker));
+        for (auto &w : workers) w.get();
+
+        for (std::size_t i = 0; i < window_size; i++)
+        {
+            os << buffers[i];
+            std::string().swap(buffers[i]);
+        }
+    }
+}
+}  // namespace
+
+void BudaNetlist::dump_to_stream(std::ostream &os, bool parallel_graphs) const
+{
+    os << comments;
     if (comments)
-        ss << std::endl;  // Add an extra newline for readability
+        os << std::endl;  // Add an extra newline for readability
 
-    ss << debug_info;
+    os << debug_info;
 
-    ss << "devices:" << std::endl;
-    ss << "  arch: " << arch_string << std::endl << std::endl;
+    os << "devices:" << std::endl;
+    os << "  arch: " << arch_string << std::endl << std::endl;
 
-    ss << "queues:" << std::endl;
+    os << "queues:" << std::endl;
 
     std::size_t longest_name = 0;
     for (const BudaQueue &q : queues)
@@ -65,54 +196,69 @@ std::string BudaNetlist::dump_to_yaml() const
             longest_name = q.name.length();
     }
 
-    // Group by type, for nicer display
-    std::unordered_map<std::string, std::vector<BudaQueue>> grouped;
-
-    for (const BudaQueue &q : queues)
-    {
-        grouped[q.type].push_back(q);
-    }
-
-    // Fixed order of common types
+    // Group by type, for nicer display. Fixed order of common types first, followed by any other types that might've
+    // showed up, in order of appearance.
     std::vector<std::string> types = {"input", "output", "parameter", "constant", "epoch_to_epoch", "accumulator"};
-
-    for (std::string type : types)
+    std::unordered_map<std::string, std::vector<std::size_t>> grouped;
+    for (std::size_t i = 0; i < queues.size(); i++)
     {
-        dump_group_of_queues(ss, type, grouped[type], longest_name);
-        grouped.erase(type);
+        auto [it, inserted] = grouped.try_emplace(queues[i].type);
+        if (inserted and std::find(types.begin(), types.end(), queues[i].type) == types.end())
+            types.push_back(queues[i].type);
+        it->second.push_back(i);
     }
 
-    // Print other groups that might've showed up that we don't know about
-    for (auto const &[type, qs] : grouped)
+    for (std::string const &type : types)
     {
-        dump_group_of_queues(ss, type, qs, longest_name);
+        if (auto match = grouped.find(type); match != grouped.end())
+            dump_group_of_queues(os, type, queues, match->second, longest_name);
     }
 
-    ss << std::endl;
-    ss << "graphs:" << std::endl;
-    for (const BudaGraph &g : graphs)
-    {
-        ss << g;
-    }
+    os << std::endl;
+    os << "graphs:" << std::endl;
+    dump_graphs(os, graphs, parallel_graphs);
 
-    ss << std::endl;
-    ss << "programs:" << std::endl;
+    os << std::endl;
+    os << "programs:" << std::endl;
     for (const program::Program &p : programs)
     {
-        ss << "  - " << p;
+        os << "  - " << p;
     }
 
-    ss << std::endl;
+    os << std::endl;
 
     if (fused_ops.size() > 0)
     {
-        ss << "fused_ops:" << std::endl;
-        for (const BudaFusedOp &op : fused_ops) ss << "  " << op;
+        os << "fused_ops:" << std::endl;
+        for (const BudaFusedOp &op : fused_ops) os << "  " << op;
     }
+}
 
+std::string BudaNetlist::dump_to_yaml() const
+{
+    std::stringstream ss;
+    dump_to_stream(ss);
     return ss.str();
 }
 
+void BudaNetlist::dump_to_file(std::string const &filename, bool parallel_graphs) const
+{
+    int fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        throw std::runtime_error("Failed to open netlist file for writing: " + filename);
+
+    bool ok;
+    {
+        FdStreamBuf buf(fd);
+        std::ostream os(&buf);
+        dump_to_stream(os, parallel_graphs);
+        ok = os.good() and buf.finish();
+    }
+    ok = (::close(fd) == 0) and ok;
+    if (not ok)
+        throw std::runtime_error("Failed to write netlist file: " + filename);
+}
+
 std::string get_buda_queue_type(graphlib::QueueNode *node)
 {
     if (node->node_type() == graphlib::NodeType::kInput)
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <memory>
+#include <ostream>
 #include <vector>
 
 #include "balancer/balancer.hpp"
@@ -31,6 +32,10 @@ struct BudaNetlist {
     std::string arch_string;
 
     std::string dump_to_yaml() const;
+    // Stream the netlist out without building it in memory first. With parallel_graphs, epoch graphs are formatted
+    // concurrently and emitted in order.
+    void dump_to_stream(std::ostream &os, bool parallel_graphs = false) const;
+    void dump_to_file(std::string const &filename, bool parallel_graphs = true) const;
     inline void append_comment(std::string const &comment)
     {
         if (comments)
@@ -31,7 +31,7 @@ ifndef BUDABACKEND_LIBDIR
 $(error BUDABACKEND_LIBDIR not set)
 endif
 
-PYBUDA_CSRC_LDFLAGS = -Wl,-z,origin -Wl,-rpath,\$$ORIGIN/../python_env/lib/$(PYTHON_VERSION)/site-packages/torch/lib -Wl,-rpath,\$$ORIGIN/../budabackend/build/lib -Wl,-rpath,\$$ORIGIN/../../$(BUDABACKEND_LIBDIR) -lstdc++fs -lboost_serialization -ltorch -ltorch_cpu -lc10 -ltorch_python
+PYBUDA_CSRC_LDFLAGS = -Wl,-z,origin -Wl,-rpath,\$$ORIGIN/../python_env/lib/$(PYTHON_VERSION)/site-packages/torch/lib -Wl,-rpath,\$$ORIGIN/../budabackend/build/lib -Wl,-rpath,\$$ORIGIN/../../$(BUDABACKEND_LIBDIR) -lstdc++fs -lrt -lboost_serialization -ltorch -ltorch_cpu -lc10 -ltorch_python
 
 PYBUDA_CSRC_SRCS = \
 		pybuda/csrc/pybuda_bindings.cpp \
@@ -49,6 +49,8 @@ PYBUDA_CSRC_SRCS = \
 
 include pybuda/csrc/passes/tests/module.mk
 include pybuda/csrc/balancer/tests/module.mk
+include pybuda/csrc/backend_api/tests/module.mk
+include pybuda/csrc/benchmarks/module.mk
 
 PYBUDA_CSRC_OBJS = $(addprefix $(OBJDIR)/, $(PYBUDA_CSRC_SRCS:.cpp=.o))
 PYBUDA_CSRC_DEPS = $(addprefix $(OBJDIR)/, $(PYBUDA_CSRC_SRCS:.cpp=.d))
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "passes/commute_utils.hpp"
 #include "graph_lib/node_types.hpp"
+#include "graph_lib/op_registry.hpp"
 #include "graph_lib/utils.hpp"
 #include "passes/passes_utils.hpp"
 
@@ -179,9 +180,6 @@ graphlib::Shape shape_of_only_operand(graphlib::Graph *graph, graphlib::OpNode *
 
 bool are_compatible_ops(graphlib::Graph *graph, graphlib::OpNode *a, graphlib::OpNode *b, graphlib::Shape *updated_shape, bool check_inverse)
 {
-    py::object eval_module = py::module_::import("pybuda.op.eval.pybuda");
-    py::function is_tm = eval_module.attr("is_tm");
-
     if (a == b)
         return (not check_inverse);
 
@@ -198,7 +196,7 @@ bool are_compatible_ops(graphlib::Graph *graph, graphlib::OpNode *a, graphlib::O
 
     // Inverse tms have to be the same op, except for unsqueeze/squeeze case
     bool are_compatible_tms = 
-        is_tm(a->op_type()).cast<bool>() and 
+        a->is_tm() and 
         ((a->op_name() == b->op_name()) or
         ((a->op_name() == "unsqueeze" and b->op_name() == "squeeze") or (a->op_name() == "squeeze" and b->op_name() == "unsqueeze")));
 
@@ -810,6 +808,9 @@ bool commute_through_quantization(
 
 bool is_elementwise(graphlib::OpNode *op)
 {
+    if (auto traits = graphlib::get_builtin_op_traits(op->op_name(), false))
+        return traits->is_eltwise;
+
     py::object eval_module = py::module_::import("pybuda.op.eval.pybuda");
     py::function is_eltwise = eval_module.attr("is_eltwise");
     return is_eltwise(op->op_type()).cast<bool>();
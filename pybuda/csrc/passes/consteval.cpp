@@ -84,13 +84,21 @@ static std::vector<graphlib::Node *> split_consteval_input_forks(
         }
     }
 
+    // Drop the split inputs in one pass, erasing them one by one is quadratic in the number of inputs
+    std::size_t num_inputs = inputs.size();
+    inputs.erase(
+        std::remove_if(
+            inputs.begin(),
+            inputs.end(),
+            [&removed_to_forked](graphlib::Node *node) { return removed_to_forked.count(node) > 0; }),
+        inputs.end());
+    TT_ASSERT(num_inputs - inputs.size() == removed_to_forked.size(), "Node not found in inputs, this should never happen");
+
+    graphlib::GraphMutation mutation(graph);
     for (auto iter : removed_to_forked) {
         graphlib::Node *node = iter.first;
         graphlib::Node *first_forked = iter.second.front();
 
-        auto remove_iter = std::find(inputs.begin(), inputs.end(), node);
-        TT_ASSERT(remove_iter != inputs.end(), "Node not found in inputs, this should never happen");
-        inputs.erase(std::find(inputs.begin(), inputs.end(), node));
         auto removed_node = graph->remove_node(node);
 
         // Need to maintain original name because user can access it by name
@@ -131,6 +139,9 @@ void run_consteval_graph_pass(graphlib::Graph *graph)
 
     std::vector<graphlib::Node *> needs_visit =
         graphlib::topological_sort(*graph, graphlib::is_consteval_capable_input_type);
+
+    // Promotion removes the promoted ops and their other operands from the runtime graph one at a time
+    graphlib::GraphMutation mutation(graph);
     while (not needs_visit.empty()) {
         graphlib::InputNode *input = dynamic_cast<graphlib::InputNode *>(needs_visit.back());
         needs_visit.pop_back();
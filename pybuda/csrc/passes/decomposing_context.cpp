@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "decomposing_context.hpp"
+#include "autograd/binding.hpp"
 #include "buda_passes.hpp"
 #include "utils/assert.hpp"
 #include "utils/logger.hpp"
@@ -54,13 +55,9 @@ NodeContext DecomposingContext::op(
     }
     new_node->set_golden_transforms(this->node_->get_golden_transforms());
 
-    py::module_ eval_module = py::module_::import("pybuda.op.eval.pybuda");
-    py::function pybuda_shape = eval_module.attr("get_f_pybuda_shape")(op_type);
-    std::vector<std::vector<std::uint32_t>> operand_tuples;
-    for (NodeContext const &op_node : operands) operand_tuples.push_back(op_node.shape.as_vector());
-    py::tuple ret = pybuda_shape(operand_tuples);
-    graphlib::Shape shape = graphlib::Shape::create(ret[0].cast<std::vector<std::uint32_t>>());
-    std::vector<graphlib::DimBroadcast> broadcasts = ret[1].cast<std::vector<graphlib::DimBroadcast>>();
+    std::vector<graphlib::Shape> operand_shapes;
+    for (NodeContext const &op_node : operands) operand_shapes.push_back(op_node.shape);
+    auto [shape, broadcasts] = ::get_op_shape(op_type, operand_shapes, false);
 
     new_node->set_shape(shape);
 
@@ -339,6 +339,7 @@ void commute_and_bypass(graphlib::Graph *graph, std::vector<graphlib::Node *> co
             handle_change_rank(graph, new_edge);   
         }
     };
+    graphlib::GraphMutation mutation(graph);
     bypass_node(graph, first, true, change_rank);
     bypass_node(graph, last, true, change_rank);
 }
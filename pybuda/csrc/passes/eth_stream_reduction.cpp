@@ -14,6 +14,7 @@
 #include "graph_lib/node_types.hpp"
 #include "graph_lib/utils.hpp"
 
+#include "placer/eth_topology.hpp"
 #include "placer/placer.hpp"
 #include "post_placer_buda_passes.hpp"
 #include "t_stream.hpp"
@@ -65,6 +66,7 @@ struct chip_to_chip_data_edge_t
     graphlib::PortId operand_index;
     int streams_needed_per_hop;
     int streams_needed_total; // in case of multiple hops this may be different from above
+    std::vector<chip_boundary_id_t> chip_boundaries; // one per hop on the route from producer to consumer chip
 };
 
 // producer-consumer_pair, data_edge, chip_to_insert_serializing op on
@@ -118,9 +120,29 @@ static uint32_t get_producer_consumer_pair_temporal_epoch(placer::PlacerSolution
     }
 }
 
+// Without a cluster topology, adjacent chip ids are assumed to be connected
+static std::vector<chip_boundary_id_t> get_route_chip_boundaries(
+    placer::EthLinkTopology const& topology, uint32_t producer_chip, uint32_t consumer_chip)
+{
+    std::vector<chip_boundary_id_t> chip_boundaries;
+    if (topology.empty())
+    {
+        for (auto c = std::min(producer_chip, consumer_chip); c != std::max(producer_chip, consumer_chip); c++)
+            chip_boundaries.push_back(chip_boundary_id_t{c, c + 1});
+        return chip_boundaries;
+    }
+
+    std::vector<uint32_t> route = topology.route(producer_chip, consumer_chip);
+    TT_ASSERT(route.size() > 1, "No ethernet route between chips", producer_chip, consumer_chip);
+    for (std::size_t i = 1; i < route.size(); i++)
+        chip_boundaries.push_back(chip_boundary_id_t{std::min(route[i - 1], route[i]), std::max(route[i - 1], route[i])});
+    return chip_boundaries;
+}
+
 static std::unordered_map<int, temporal_epoch_chip_to_chip_data_edges_t> collect_chip_to_chip_data_edges_per_temporal_epoch(
     graphlib::Graph *graph, 
-    placer::PlacerSolution &placer_solution) 
+    placer::PlacerSolution &placer_solution,
+    placer::EthLinkTopology const& topology) 
 {
     auto chip_to_chip_data_edges_per_temporal_epoch = std::unordered_map<int, temporal_epoch_chip_to_chip_data_edges_t>{};
     for (auto const& [node_id, edges] : graph->operands_map())
@@ -147,15 +169,14 @@ static std::unordered_map<int, temporal_epoch_chip_to_chip_data_edges_t> collect
                 graphlib::Node* consumer_node = graph->node_by_id(edge.consumer_node_id);
                 auto &chip_to_chip_edges = chip_to_chip_data_edges_per_temporal_epoch[temporal_epoch];
                 int streams_needed_per_hop = get_op_num_input_streams(*consumer_node, placer_solution, edge.consumer_input_port_id); 
-                int num_hops = std::abs(static_cast<long>(producer_chip) - static_cast<long>(consumer_chip));
+                std::vector<chip_boundary_id_t> chip_boundaries = get_route_chip_boundaries(topology, producer_chip, consumer_chip);
+                int num_hops = chip_boundaries.size();
                 int streams_needed_total = num_hops * streams_needed_per_hop;
-                auto const& chip_boundary = chip_boundary_id_t{std::min(producer_chip, consumer_chip), std::max(producer_chip, consumer_chip)};
                 auto const& producer_consumer_pair = producer_consumer_pair_t{producer->name(), consumer->name(), edge.consumer_input_port_id};
 
                 log_debug("\tChip-to-chip edge between {} (chip {}) and {} (chip {}). {} streams needed per hop", producer->name(), producer_chip, consumer->name(), consumer_chip, streams_needed_per_hop);
-                for (auto c = chip_boundary.first; c != chip_boundary.second; c++) 
+                for (auto const& one_hop_chip_boundary : chip_boundaries)
                 {
-                    auto const& one_hop_chip_boundary = chip_boundary_id_t{c, c+1};
                     chip_to_chip_edges.chip_boundary_producer_consumer_pairs[one_hop_chip_boundary].insert(producer_consumer_pair);
                     chip_to_chip_edges.chip_boundary_needed_streams[one_hop_chip_boundary] += streams_needed_per_hop;
                     log_debug("\t\t chip {} -> chip {}: {} required streams added, {} needed in total", one_hop_chip_boundary.first, one_hop_chip_boundary.second, streams_needed_per_hop, chip_to_chip_edges.chip_boundary_needed_streams.at(one_hop_chip_boundary));
@@ -165,7 +186,8 @@ static std::unordered_map<int, temporal_epoch_chip_to_chip_data_edges_t> collect
                         .consumer_chip=consumer_chip, 
                         .operand_index=edge.consumer_input_port_id,
                         .streams_needed_per_hop=streams_needed_per_hop,
-                        .streams_needed_total=streams_needed_total
+                        .streams_needed_total=streams_needed_total,
+                        .chip_boundaries=chip_boundaries
                     };
                 TT_ASSERT(edge.producer_node_id == producer->id());
             }
@@ -223,12 +245,9 @@ void try_serialize(
     edges_to_serialize.push_back({*edge_iter, data_edge, target_epoch_id});
 
     // remove the edge from all chip-to-chip-boundaries from producer to consumer
-    auto start = std::min(data_edge.producer_chip, data_edge.consumer_chip);
-    auto end = std::max(data_edge.producer_chip, data_edge.consumer_chip);
-    TT_ASSERT(end > start);
-    for (auto c = start; c != end; c++)
+    TT_ASSERT(not data_edge.chip_boundaries.empty());
+    for (auto const& chip_boundary : data_edge.chip_boundaries)
     {
-        auto const& chip_boundary = chip_boundary_id_t{c, c + 1};
         chip_boundary_producer_consumer_pairs.at(chip_boundary).erase(*edge_iter);
     }
 }
@@ -246,12 +265,9 @@ void try_serialize_with_tensix_datacopy(
 {
     auto const& data_edge = chip_to_chip_data_edges.at(*edge_iter);
     int streams_saved = data_edge.streams_needed_per_hop - 1;  // we still need a stream after serialization
-    auto start = std::min(data_edge.producer_chip, data_edge.consumer_chip);
-    auto end = std::max(data_edge.producer_chip, data_edge.consumer_chip);
-    TT_ASSERT(end > start);
-    for (auto c = start; c != end; c++)
+    TT_ASSERT(not data_edge.chip_boundaries.empty());
+    for (auto const& chip_boundary : data_edge.chip_boundaries)
     {
-        auto const& chip_boundary = chip_boundary_id_t{c, c + 1};
         chip_boundary_needed_streams.at(chip_boundary) -= streams_saved;
     }
 
@@ -380,7 +396,8 @@ static std::vector<data_edge_serialization_spec_t> choose_chip_to_chip_data_edge
     std::unordered_map<int, temporal_epoch_chip_to_chip_data_edges_t>& chip_to_chip_data_edges_per_temporal_epoch, 
     placer::PlacerSolution &placer_solution,
     balancer::BalancerSolution &balancer_solution,
-    DeviceConfig const& device_config) 
+    DeviceConfig const& device_config,
+    placer::EthLinkTopology const& topology) 
 {
     std::unordered_map<int, std::unordered_map<uint32_t, placer::PlacerSolution::EpochId>> temporal_epoch_chip_id_to_global_epoch_id_map;
     for (std::uint32_t e = 0; e < placer_solution.num_epochs; e++) {
@@ -389,10 +406,9 @@ static std::vector<data_edge_serialization_spec_t> choose_chip_to_chip_data_edge
         temporal_epoch_chip_id_to_global_epoch_id_map[placer_solution.temporal_epoch_id(e)][placer_solution.epoch_id_to_chip.at(e)] = epoch_info.global_epoch_id;
     }
 
-    // Temporary flag to pick correct number of eth links depending on setup, until general implementation comes
+    // Link count used when there's no cluster topology to look it up in, 2 for nebula setups and 4 for galaxy ones
     bool eth_links_between_chips_nebula = (bool)env_as<int>("PYBUDA_ETH_LINKS_NEBULA", 0);
-
-    // auto cluster_desc_uniq = tt_ClusterDescriptor::create_from_yaml(device_config.cluster_config_yaml);
+    int default_eth_links_between_chips = eth_links_between_chips_nebula ? 2 : 4;
 
     auto edges_to_serialize = std::vector<data_edge_serialization_spec_t>{};
     constexpr int ETH_STREAMS_PER_LINK = 8;
@@ -405,14 +421,10 @@ static std::vector<data_edge_serialization_spec_t> choose_chip_to_chip_data_edge
 
         for (auto const& [chip_boundary, required_streams] : temporal_epoch_chip_to_chip_data_edges_specs.chip_boundary_needed_streams)
         {
-            // Old code that only worked with topologies where adjacent chip IDs were always connected to each other
-            // this isn't generally true. For now we hardcode to 4 links for galaxy setups and have a flag for nebula setups, but we should generalize
-            // -> first to get the # links between any connected chips and assume that's the number for any other
-            //    pair of connected chips. This generally true (assuming all links train on boot)
-            // Then we need to update this pass to always serialize chip to chip if ethernet datacopy is enabled
-            //auto const& links_between_chips = cluster_desc_uniq->get_directly_connected_ethernet_channels_between_chips(chip_boundary.first, chip_boundary.second);
-            int eth_links_between_chips = eth_links_between_chips_nebula ? 2 : 4; //links_between_chips.size();
-            TT_ASSERT(eth_links_between_chips >= 0, "Entries should only be produced for adjacent chips");
+            // Chip boundaries are hops on the routes between chips, so they are always between adjacent chips
+            int eth_links_between_chips = topology.empty() ? default_eth_links_between_chips
+                                                           : topology.num_links(chip_boundary.first, chip_boundary.second);
+            TT_ASSERT(eth_links_between_chips > 0, "Entries should only be produced for adjacent chips");
             int available_streams = eth_links_between_chips * ETH_STREAMS_PER_LINK;
             // For ethernet datacopy serialization, we serialize all chip to chip edges
             // For tensix datacopy we only can conditionally serialize to save cores
@@ -774,6 +786,7 @@ static void add_datacopy_placement_entry(
             .end = placed_cores_end,
         }};
     placer_solution.name_to_op_placement.insert({datacopy_node->name(), placement});
+    placer_solution.invalidate_node_placements();
     placer_solution.epoch_id_to_op_placement.at(epoch_id).push_back(placement);
     log_trace(tt::LogPlacer, "\tAdded ethernet datacopy placement for {} at global epoch {}, chip {}", datacopy_node->name(), epoch_id, target_chip);
 }
@@ -897,6 +910,7 @@ static std::tuple<Edge, graphlib::Node*, Edge, balancer::TStreamFactor> insert_d
         // Delete the placement entry since we are serializing the buffer and need to redo it's placement/allocation
         // Might not need to do this for eth datacopy
         placer_solution.name_to_queue_placement.erase(consumer_name);
+        placer_solution.invalidate_node_placements();
     }
 
     add_datacopy_balancer_entry(
@@ -1112,12 +1126,13 @@ void reduce_ethernet_stream_usage(
     DeviceConfig const& device_config)
 {
     bool tensix_datacopy_eth_link_serialization_enabled = env_as<bool>("PYBUDA_ENABLE_ETH_SERIALIZATION");
-    auto chip_to_chip_data_edges = collect_chip_to_chip_data_edges_per_temporal_epoch(graph, placer_solution);
+    placer::EthLinkTopology topology(device_config);
+    auto chip_to_chip_data_edges = collect_chip_to_chip_data_edges_per_temporal_epoch(graph, placer_solution, topology);
 
     if (tensix_datacopy_eth_link_serialization_enabled)
     {
         auto const& edges_to_serialize = choose_chip_to_chip_data_edges_to_serialize<true>(
-            graph, chip_to_chip_data_edges, placer_solution, balancer_solution, device_config);
+            graph, chip_to_chip_data_edges, placer_solution, balancer_solution, device_config, topology);
         serialize_chosen_chip_to_chip_data_edges<true>(
             graph, placer_solution, balancer_solution, device_config, edges_to_serialize);
         // Deallocate here so we can reallocate them alongside the serialized buffers. Otherwise when we try to allocate
@@ -1128,7 +1143,7 @@ void reduce_ethernet_stream_usage(
     else
     {
         auto const& edges_to_serialize = choose_chip_to_chip_data_edges_to_serialize<false>(
-            graph, chip_to_chip_data_edges, placer_solution, balancer_solution, device_config);
+            graph, chip_to_chip_data_edges, placer_solution, balancer_solution, device_config, topology);
         serialize_chosen_chip_to_chip_data_edges<false>(
             graph, placer_solution, balancer_solution, device_config, edges_to_serialize);
         // Deallocate here so we can reallocate them alongside the serialized buffers. Otherwise when we try to allocate
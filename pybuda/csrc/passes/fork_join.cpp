@@ -3,7 +3,10 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "passes/fork_join.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <map>
 #include <string>
 #include <queue>
 #include <unordered_map>
@@ -27,9 +30,10 @@ namespace tt
 using Node = graphlib::Node;
 using Graph = graphlib::Graph;
 using NodeId = graphlib::NodeId;
-// Trace fork BFS until join
+// Parents of nodes in a branch, along with depth at which they were reached
 using NodeMap = std::unordered_map<Node *, std::pair<Node *, std::uint32_t>>;
 
+// Trace fork BFS until join
 struct CurrentState
 {
     Node *fork;
@@ -61,31 +65,106 @@ std::vector<Node *> remove_duplicates_and_outputs(std::vector<Node *> nodes, gra
     return ret;
 }
 
+// All queues except for buffering ones break fork-joins
+static bool breaks_fork_joins(Node *node)
+{
+    return node->node_type() == graphlib::kQueue && !(node->as<graphlib::QueueNode>()->is_buffering());
+}
+
+// Nodes that fork tracing continues to from the given node
+static std::vector<Node *> fork_join_children(const Graph *graph, Node *node, graphlib::NodeEpochType epoch_type)
+{
+    std::vector<Node *> children;
+    if (breaks_fork_joins(node))
+        return children;
+
+    for (Node *child : remove_duplicates_and_outputs(graph->data_users(node), epoch_type))
+        if (!breaks_fork_joins(child))
+            children.push_back(child);
+    return children;
+}
+
+// Immediate post-dominators of all nodes of one epoch type, over the edges that fork tracing follows. nullptr stands
+// for the virtual exit node that all branches which never reconverge end in.
+//
+// Every path from a fork goes through its immediate post-dominator, so all of the fork's branches have joined by the
+// time they reach it; tracing the fork never needs to go further than that.
+class ForkJoinPostDominators
+{
+    std::unordered_map<Node *, Node *> ipdom;
+    std::unordered_map<Node *, std::size_t> topo_index;
+
+    Node *intersect(Node *a, Node *b) const
+    {
+        // Post-dominators are always later in topological order, with the exit node being last
+        auto before = [this](Node *x, Node *y)
+        { return x != nullptr && (y == nullptr || topo_index.at(x) < topo_index.at(y)); };
+        while (a != b)
+        {
+            while (before(a, b)) a = ipdom.at(a);
+            while (before(b, a)) b = ipdom.at(b);
+        }
+        return a;
+    }
+
+   public:
+    ForkJoinPostDominators(
+        const Graph *graph, const std::vector<Node *> &topo_order, graphlib::NodeEpochType epoch_type)
+    {
+        for (std::size_t i = 0; i < topo_order.size(); i++)
+        {
+            Node *node = topo_order[i];
+            if (node->get_epoch_type() == epoch_type && node->node_type() != graphlib::NodeType::kOutput)
+                topo_index[node] = i;
+        }
+
+        // Graph is a DAG, so a single pass in reverse topological order is enough
+        for (auto it = topo_order.rbegin(); it != topo_order.rend(); ++it)
+        {
+            if (topo_index.count(*it) == 0)
+                continue;
+
+            std::vector<Node *> children = fork_join_children(graph, *it, epoch_type);
+            Node *dom = children.empty() ? nullptr : children[0];
+            for (std::size_t i = 1; i < children.size() && dom != nullptr; i++) dom = intersect(dom, children[i]);
+            ipdom[*it] = dom;
+        }
+    }
+
+    Node *immediate(Node *node) const { return ipdom.at(node); }
+};
+
 void record_fork_join(
     Node *fork,
     Node *join_point,
     Node *parent0,
     Node *parent1,
     const NodeMap &parents,
+    const NodeMap &other_parents,
     std::vector<ForkJoin> &fork_joins)
 {
     std::vector<Node *> path0 = {join_point, parent0};
     std::vector<Node *> path1 = {join_point, parent1};
 
-    try
+    // Parents of the two joined branches, preferring the first one for nodes visited by both
+    auto parent_of = [&parents, &other_parents](Node *node)
     {
-        while (path0.back() != fork)
-        {
-            path0.push_back(parents.at(path0.back()).first);
-        }
-        while (path1.back() != fork)
-        {
-            path1.push_back(parents.at(path1.back()).first);
-        }
+        auto match = parents.find(node);
+        if (match != parents.end())
+            return match->second.first;
+        match = other_parents.find(node);
+        if (match == other_parents.end())
+            TT_THROW("Missing parent when traversing back to fork point.");
+        return match->second.first;
+    };
+
+    while (path0.back() != fork)
+    {
+        path0.push_back(parent_of(path0.back()));
     }
-    catch (std::out_of_range &e)
+    while (path1.back() != fork)
     {
-        TT_THROW("Missing parent when traversing back to fork point.");
+        path1.push_back(parent_of(path1.back()));
     }
 
     // We'll find sub-forks, which should be thrown out - they will be found later from that fork spot
@@ -110,7 +189,12 @@ void print_fork_join(const ForkJoin &fj)
     for (Node *node : fj.second) std::cout << "   - " << node->name() << std::endl;
 }
 
-void trace_fork(const Graph *graph, Node *fork, std::vector<ForkJoin> &fork_joins, graphlib::NodeEpochType epoch_type)
+void trace_fork(
+    const Graph *graph,
+    Node *fork,
+    std::vector<ForkJoin> &fork_joins,
+    graphlib::NodeEpochType epoch_type,
+    const ForkJoinPostDominators &post_dominators)
 {
     // The strategy is to traverse all forks and count the size of consumed inputs to make fwd progress. The difference
     // when joined is how much we need to buffer to make sure that long side can make full fwd progress and max speed.
@@ -120,35 +204,35 @@ void trace_fork(const Graph *graph, Node *fork, std::vector<ForkJoin> &fork_join
     // Best reference I could find:
     // https://cs.stackexchange.com/questions/57221/efficient-algorithms-for-identifying-the-diamond-forkjoin-vertices-and-the-diam
 
-    // We can probably do something simpler, since forks in graphs are relatively rare. On each fork, do a step-by-step
-    // BFS search on both forks until one "dies" (i.e. reaches an output), or we find a common point. Keep track of the
-    // path along the way. This is quite inefficient for large graphs with lots of complex fork/joins, but those should
-    // be extremely rare in AI models.
+    // On each fork, do a step-by-step BFS search on all branches, keeping track of the path along the way, and record a
+    // fork-join whenever two branches reach a common point. A branch stops when it "dies" (i.e. reaches an output), or
+    // reaches the immediate post-dominator of the fork - all branches are bound to meet there. Tracing also ends as soon
+    // as every pair of branches has joined, so in practice only the region between the fork and its reconvergence
+    // point is visited.
 
     std::vector<Node *> data_users = remove_duplicates_and_outputs(graph->data_users(fork), epoch_type);
     if (data_users.size() == 1)
         return;  // this is not the fork you're looking for
 
-    // Initial state
-    NodeMap parents = NodeMap();
-    std::unordered_map<Node *, std::uint32_t> node_depth;
-    // std::cout << "trace fork: " << fork->name() << std::endl;
+    // A branch starting at a queue dies right away, so the fork may never reconverge even if the rest of it does
+    bool any_branch_dies = std::any_of(data_users.begin(), data_users.end(), breaks_fork_joins);
+    Node *reconvergence = any_branch_dies ? nullptr : post_dominators.immediate(fork);
 
     std::vector<CurrentState> states(data_users.size());
     for (std::size_t i = 0; i < data_users.size(); i++)
     {
         Node *user = data_users[i];
-        // std::cout << "Initializing child: " << user->name() << " at depth 1" << std::endl;
         states[i].fork = fork;
         states[i].current_nodes = {user};
         states[i].parents[user] = std::make_pair(fork, 1);
         states[i].node_depth[user] = 1;
     }
 
-    std::string indent = " ";
     bool done = false;
     std::unordered_map<std::uint32_t, std::unordered_set<std::uint32_t>> joined;
-    while (!done)
+    std::size_t joined_pairs = 0;
+    const std::size_t all_pairs = states.size() * (states.size() - 1) / 2;
+    while (!done && joined_pairs < all_pairs)
     {
         done = true;
         for (std::size_t i = 0; i < states.size(); i++)
@@ -161,27 +245,17 @@ void trace_fork(const Graph *graph, Node *fork, std::vector<ForkJoin> &fork_join
             std::vector<Node *> next_children;
             for (Node *node : state.current_nodes)
             {
-                if (node->node_type() == graphlib::kQueue && !(node->as<graphlib::QueueNode>()->is_buffering()))
-                    continue;  // all queues except for buffering break fork-joins
-
-                std::vector<Node *> children = remove_duplicates_and_outputs(graph->data_users(node), epoch_type);
+                if (node == reconvergence)
+                    continue;  // every other branch ends up here too, nothing new to find past this point
 
-                for (Node *child : children)
+                for (Node *child : fork_join_children(graph, node, epoch_type))
                 {
-                    if (child->node_type() == graphlib::kQueue && !(child->as<graphlib::QueueNode>()->is_buffering()))
-                        continue;  // all queues except for buffering break fork-joins
-
                     std::uint32_t depth = state.node_depth[node] + 1;
                     if (depth > state.node_depth[child])
                         state.node_depth[child] = depth;
 
-                    // std::cout << indent << " - branch: " << i << " -> child (depth " << depth << "): " <<
-                    // child->name() << std::endl;
-
                     if ((state.parents.count(child) == 0) || (depth > state.parents[child].second))
                     {
-                        // std::cout << indent << "     updating parent of  " << child->name() << " to " << node->name()
-                        // << " due to depth " << depth << std::endl;
                         state.parents[child] = std::make_pair(node, depth);
                         next_children.push_back(child);
                     }
@@ -197,20 +271,22 @@ void trace_fork(const Graph *graph, Node *fork, std::vector<ForkJoin> &fork_join
 
                         if (states[j].parents.count(child) > 0)
                         {
-                            // std::cout << indent << " found fork with branch " << j << std::endl;
-                            NodeMap common_parents;
-                            common_parents.insert(state.parents.begin(), state.parents.end());
-                            common_parents.insert(states[j].parents.begin(), states[j].parents.end());
                             record_fork_join(
-                                state.fork, child, states[j].parents.at(child).first, node, common_parents, fork_joins);
+                                state.fork,
+                                child,
+                                states[j].parents.at(child).first,
+                                node,
+                                state.parents,
+                                states[j].parents,
+                                fork_joins);
                             joined[i].insert(j);
                             joined[j].insert(i);
+                            joined_pairs++;
                         }
                     }
                 }
             }
             state.current_nodes = next_children;
-            indent += "  ";
 
             if (state.current_nodes.size() > 0)
                 done = false;
@@ -221,7 +297,11 @@ void trace_fork(const Graph *graph, Node *fork, std::vector<ForkJoin> &fork_join
 std::vector<ForkJoin> find_fork_joins(Graph *graph)
 {
     std::vector<ForkJoin> fork_joins;
-    for (Node *node : graphlib::topological_sort(*graph))
+    std::vector<Node *> topo_order = graphlib::topological_sort(*graph);
+
+    // Computed once per epoch type, and shared by all forks in it
+    std::map<graphlib::NodeEpochType, ForkJoinPostDominators> post_dominators;
+    for (Node *node : topo_order)
     {
         // fork from input can be ignored, as queues can buffer the source at any rate
         if ((node->node_type() == graphlib::kInput) || (node->node_type() == graphlib::kQueue))
@@ -229,7 +309,11 @@ std::vector<ForkJoin> find_fork_joins(Graph *graph)
 
         if (graph->data_users(node).size() > 1)
         {
-            trace_fork(graph, node, fork_joins, node->get_epoch_type());
+            graphlib::NodeEpochType epoch_type = node->get_epoch_type();
+            auto match = post_dominators.find(epoch_type);
+            if (match == post_dominators.end())
+                match = post_dominators.emplace(epoch_type, ForkJoinPostDominators(graph, topo_order, epoch_type)).first;
+            trace_fork(graph, node, fork_joins, epoch_type, match->second);
         }
     }
     return fork_joins;
@@ -368,21 +452,6 @@ bool is_fork_join_on_path(const std::vector<Node *> &path, const ForkJoin *fj)
     return contains_fork && contains_join;
 }
 
-// returns true if first fork-join is ancestor of second fork-join
-bool is_ancestor(const ForkJoin *fj_1, const ForkJoin *fj_2)
-{
-    // if path is only 2 nodes then it can't contain fork-join without having same fork and join as descendant.
-    if ((fj_1->first.size() > 2 && is_fork_join_on_path(fj_1->first, fj_2)) ||
-        (fj_1->second.size() > 2 && is_fork_join_on_path(fj_1->second, fj_2)))
-    {
-        return true;
-    }
-    else
-    {
-        return false;
-    }
-}
-
 // Graph of fork-joins. Each node is one fork-join, and each edge tells which fork-join is contained inside another
 // edge goes from child to parent fork-join.
 FJGraph::FJGraph(graphlib::Graph *graph)
@@ -406,31 +475,53 @@ FJGraph::FJGraph(graphlib::Graph *graph)
     // fork and join of current fj is contained on either of two paths on possible ancestor  fork-join. special case is
     // when two fork-joins share both fork and join node. Then, no one is ancestor so we don't have connection between
     // nodes.
-    for (std::size_t i = 0; i < fork_joins.size() - 1; i++)
+    //
+    // Rather than checking all pairs of fork-joins, index which paths go through each node, and only look at the
+    // paths that go through the fork of a fork-join for its join.
+    std::unordered_map<Node *, std::vector<std::pair<std::uint32_t, std::uint32_t>>> paths_through_node;
+    for (std::uint32_t i = 0; i < fork_joins.size(); i++)
+    {
+        // if path is only 2 nodes then it can't contain fork-join without having same fork and join as descendant.
+        const std::vector<Node *> *paths[2] = {&fork_joins[i].first, &fork_joins[i].second};
+        for (std::uint32_t p = 0; p < 2; p++)
+            if (paths[p]->size() > 2)
+                for (Node *node : *paths[p]) paths_through_node[node].emplace_back(i, p);
+    }
+
+    // ancestors[j] holds indices of all fork-joins that are ancestors of fork-join j
+    std::vector<std::set<std::uint32_t>> ancestors(fork_joins.size());
+    for (std::uint32_t j = 0; j < fork_joins.size(); j++)
     {
-        for (std::size_t j = i + 1; j < fork_joins.size(); j++)
+        Node *fork = fork_joins[j].first[0];
+        Node *join = fork_joins[j].first.back();
+        auto with_fork = paths_through_node.find(fork);
+        auto with_join = paths_through_node.find(join);
+        if (with_fork == paths_through_node.end() or with_join == paths_through_node.end())
+            continue;
+
+        std::set<std::pair<std::uint32_t, std::uint32_t>> join_paths(with_join->second.begin(), with_join->second.end());
+        for (auto const &path : with_fork->second)
         {
-            const ForkJoin *fj_1 = &fork_joins[i];
-            const ForkJoin *fj_2 = &fork_joins[j];
-            if (fj_1->first[0] == fj_2->first[0] && fj_1->first.back() == fj_2->first.back())
-            {
-                // if fork and join from two fork-joins are the same, then this is the special where we can't say which
-                // fork-join is ancestor and which descendant.
+            std::uint32_t i = path.first;
+            if (i == j or join_paths.count(path) == 0)
                 continue;
-            }
-            if (is_ancestor(fj_1, fj_2))
-            {
-                // fj_1 is ancestor to fj2 so we need edge from fj_2 to fj_1
-                this->add_edge(j, i);
-            }
-            else
-            {
-                if (is_ancestor(fj_2, fj_1))
-                {
-                    // fj_2 is ancestor to fj_1 so we need edge from fj_1 to fj_2
-                    this->add_edge(i, j);
-                }
-            }
+            // if fork and join from two fork-joins are the same, then this is the special where we can't say which
+            // fork-join is ancestor and which descendant.
+            if (fork_joins[i].first[0] == fork and fork_joins[i].first.back() == join)
+                continue;
+            ancestors[j].insert(i);
+        }
+    }
+
+    for (std::uint32_t j = 0; j < fork_joins.size(); j++)
+    {
+        for (std::uint32_t i : ancestors[j])
+        {
+            // when two fork-joins are ancestors of each other, the one with lower index is treated as the ancestor
+            if (j < i and ancestors[i].count(j) > 0)
+                continue;
+            // i is ancestor to j so we need edge from j to i
+            this->add_edge(j, i);
         }
     }
 
@@ -1391,6 +1482,189 @@ uint32_t expand_output_buffer(balancer::OpModel& op_model, float scale_usable_l1
 }
 
 
+// Emits nop or buffering queue instructions at the fork of the given short path, for to_add tiles of buffering that
+// couldn't be provided by expanding L1 buffers. Returns false if the requirement was too small to bother with.
+static bool add_buffering_instructions_at_fork(
+    const Graph *graph,
+    const std::vector<Node *> &path,
+    std::uint32_t to_add,
+    std::uint32_t &additional_available_buff,
+    tt::ordered_map<InsInstructionUniqueId, std::shared_ptr<InsertionInstruction>, InsInstructionUniqueIdHash>
+        &instructions,
+    const tt::ordered_map<InsInstructionUniqueId, std::shared_ptr<InsertionInstruction>, InsInstructionUniqueIdHash>
+        &previous_ins_instructions,
+    balancer::OpModelMap *op_models_post_placer,
+    balancer::OpModels *op_models,
+    const std::uint32_t usable_l1_size,
+    const int fork_join_tiles_treshold,
+    std::function<int(const tt::balancer::OpModel &)> buffering_factor,
+    const ForkJoin &fj,
+    FJGraph &fj_graph)
+{
+    // If enabled we will add buffering queues instead of NOPs to buffer fork-joins.
+    const bool add_buffer_queues = env_as<int>("PYBUDA_FORK_JOIN_BUF_QUEUES", 0);
+
+    const int max_queue_mem =
+        1024 * 1024 * 1024;  // 1GB, this is ad hoc limit for maximum memory buffering queues can consume on one chip.
+
+    // insert NOPs or queue if number of tiles exceeds threshold
+    balancer::OpModel &op_model = get_op_model(op_models_post_placer, op_models, path[0]);
+
+    std::uint32_t tile_size = balancer::tile_size_bytes(op_model.output_buffers.at(0).data_format);
+
+    int buff_mem_consumption = buffering_queues_mem_consumption(instructions) +
+                               buffering_queues_mem_consumption(previous_ins_instructions);
+    Node *src = path[0];
+    std::vector<Node*> dests;
+    // currently if src is recompute, we skip adding queue
+    // because of possible graph change (reconnecting consumers from recompute node)
+    // that results in hang.
+    bool src_is_recompute = is_recompute(graph, src);
+
+    // if there is sub fork-join from fork of current fj (fj) on path, we have to add nop effectivaly before sub
+    // fork-join. we do that by adding instructions for mergeable nops on both paths of sub fork-join. Nops with
+    // mergeable tag will be merged in one nop if they have same source (in method merge_tagged_nops_with_same_src)
+    auto [join, req, avail, sub_fj] = fj_graph.find_sub_fork_join_from_node(fj, path, src);
+    if (join != nullptr)
+    {
+        dests.push_back(sub_fj->first[1]);
+        dests.push_back(sub_fj->second[1]);
+    }
+    else
+    {
+        dests.push_back(path[1]);
+    }
+    bool merge_nops = dests.size() > 1;
+
+    if (add_buffer_queues && (int)to_add > (int)fork_join_tiles_treshold && buff_mem_consumption < max_queue_mem &&
+        !src_is_recompute)
+    {
+        // number of tiles to add (to_add) is greater than threshold config.fork_join_tiles_treshold => use queues
+        // instead of nops
+        auto edges = graph->user_data_edges(src);
+        for (std::uint32_t fork_id = 0; fork_id < edges.size(); fork_id++)
+        {
+            for (Node *dest : dests)
+            {
+                graphlib::Edge e = edges[fork_id];
+                if (e.consumer_node_id == dest->id())
+                {
+                    // number if entries in queue is 2 * microbatch_size at maximum. We take the minimum of that
+                    // upper limit and estimation we get from padding requirement to_add (which is number of tiles
+                    // we have to padd on path) When one path of fork join is much longer than other this to_add
+                    // becomes large. That would increase number of tensors we have to buffer. Luckily for us,
+                    // maximum number of tensors that can be inside one queue ,that is inside one epoch, is
+                    // microbatch_size.
+                    int num_entries = std::min(
+                        2 * graph->get_microbatch(),
+                        (int)ceil((float)to_add / (float)op_model.op_shape.outputs.at(0).volume_in_tiles()));
+                    int queue_size = (int)(ceil(to_add * tile_size));  // in bytes
+
+                    // if dests have more than one element that means that I want to add queue with source src but
+                    // more than 1 destination. Even though I make 2 instructions, later there won't be 2 queues but
+                    // one that feeds to 2 consumers if dests.size() is 2 for example.
+                    std::shared_ptr<InsertionInstruction> ins = std::make_shared<QueueInsertionInstruction>(
+                        src->name() /* src */,
+                        dest->name() /* dest */,
+                        false /* hoist_tms */,
+                        num_entries,
+                        queue_size,
+                        e.consumer_input_port_id /* input_id */,
+                        fork_id /* fork_id */);
+                    InsInstructionUniqueId key = ins->unique_id();
+                    insert_queue_ins_to_instructions(instructions, key, ins);
+                }
+            }
+        }
+    }
+    else
+    {
+        // Some heuristic to guess how many nops we need
+        float nop_buffering = usable_l1_size / (float)tile_size;
+        // std::cout << "Expect " << nop_buffering << " tiles per nop, need to add " << to_add << std::endl;
+        /*
+        add at most a third of nops needed, since disturbance of placement
+        will shift epochs and we might not need them any more
+        We don't add all necesarry nops in one step. On the contrary, we add fraction of needed nops in each pass of
+        pre-placer post-placer loop in compile.py. This is because adding nops can cause current fork-join to span
+        across two epochs, thus elliminating further need for adding new nops (because e2e queues act as buffers).
+        */
+        float nop_base_buffer = to_add / nop_buffering;
+
+        // In case buffering requirements are abysmal skip buffering.
+        //
+        if (nop_base_buffer < 0.1)
+            return false;
+
+        // If we are using inline buffering within epoch we can add all NOPs at once.
+        // Legacy post placer path is adding one third at a time due to op shifts accross epochs.
+        //
+        int buffering_step = op_models_post_placer != nullptr ? 3 : 1;
+        int buffering_scale = buffering_factor(op_model) * buffering_step;
+        std::uint32_t nop_count = (uint32_t)std::ceil(to_add / (nop_buffering * buffering_scale));
+
+        // Check if we are trying to add unreasonable amount of NOPs.
+        // Currently, unreasonable is defined as "more that can fit on grayskull (10x12 grid)".
+        if (nop_count > 120)
+        {
+            log_warning(LogGraphCompiler, "Trying to add large number of NOPs for buffering.");
+        }
+
+        log_trace(
+            LogGraphCompiler,
+            "Ask for {} nops from {}, to_add: {}, tile_size: {}",
+            nop_count,
+            src->name(),
+            to_add,
+            tile_size);
+
+        auto edges = graph->user_data_edges(src);
+        for (std::uint32_t fork_id = 0; fork_id < edges.size(); fork_id++)
+        {
+            for (Node *dest : dests)
+            {
+                graphlib::Edge e = edges[fork_id];
+                if (e.consumer_node_id == dest->id())
+                {
+                    InsInstructionUniqueId key = InsInstructionUniqueId(
+                        src->name(), dest->name(), e.consumer_input_port_id, fork_id, merge_nops);
+                    if (instructions.count(key) > 0)
+                    {
+                        if (NopInsertionInstruction *nop_instr =
+                                dynamic_cast<NopInsertionInstruction *>(instructions[key].get()))
+                        {
+                            if (nop_instr->nop_count < nop_count)
+                            {
+                                nop_instr->set_nop_count(nop_count);
+                                // we already added
+                                additional_available_buff +=
+                                    (nop_count - nop_instr->nop_count) * nop_buffering * buffering_factor(op_model);
+                            }
+                        }
+                    }
+                    else
+                    {
+                        // instruction doesn't exist in map of instructions
+                        additional_available_buff += nop_count * nop_buffering * buffering_factor(op_model);
+                        std::shared_ptr<InsertionInstruction> ins = std::make_shared<NopInsertionInstruction>(
+                            src->name() /* src */,
+                            dest->name() /* dest */,
+                            false /* hoist_tms */,
+                            nop_count /* nop_count */,
+                            e.consumer_input_port_id /* input_id */,
+                            fork_id /* fork_id */,
+                            merge_nops);
+                        instructions[key] = ins;
+                    }
+                }
+            }
+        }
+
+        fj_graph.add_nop_buffered_fj(&fj);
+    }
+    return true;
+}
+
 // This function is attempting to add buffering along a given path in a graph, with the goal of minimizing the number of
 // nops that need to be inserted. It does this by iterating over the nodes in the path and attempting to add as much
 // buffering as possible at each node, using available memory space and respecting certain environment variables and
@@ -1419,9 +1693,6 @@ void add_buffering_on_path(
     // this value reflects how many more tiles on input path will be able to buffer.
     std::uint32_t additional_available_buff = 0;
 
-    // If enabled we will add buffering queues instead of NOPs to buffer fork-joins.
-    const bool add_buffer_queues = env_as<int>("PYBUDA_FORK_JOIN_BUF_QUEUES", 0);
-
     // currently, we maximize input buffers by default.
     const bool maximize_buffers = env_as<bool>("PYBUDA_MAX_FORK_JOIN_BUF", 1);
 
@@ -1434,8 +1705,6 @@ void add_buffering_on_path(
     // If enabled we skip expanding buffers for regular ops, to force adding NOPs.
     const bool skip_expanding_buffers = env_as<bool>("PYBUDA_FORK_JOIN_SKIP_EXPANDING_BUFFERS");
 
-    const int max_queue_mem =
-        1024 * 1024 * 1024;  // 1GB, this is ad hoc limit for maximum memory buffering queues can consume on one chip.
     const float scale_usable_l1_size = 0.95;
 
     Node *prev_node = nullptr;
@@ -1618,161 +1887,21 @@ void add_buffering_on_path(
     {
         log_debug(
             LogGraphCompiler, "Fork join long path requires additional buffering of shorter path {} tiles", to_add);
-        // insert NOPs or queue if number of tiles exceeds threshold
-        balancer::OpModel &op_model = get_op_model(op_models_post_placer, op_models, path[0]);
-
-        std::uint32_t tile_size = balancer::tile_size_bytes(op_model.output_buffers.at(0).data_format);
-
-        int buff_mem_consumption = buffering_queues_mem_consumption(instructions) +
-                                   buffering_queues_mem_consumption(previous_ins_instructions);
-        Node *src = path[0];
-        std::vector<Node*> dests;
-        // currently if src is recompute, we skip adding queue
-        // because of possible graph change (reconnecting consumers from recompute node)
-        // that results in hang.
-        bool src_is_recompute = is_recompute(graph, src);
-
-        // if there is sub fork-join from fork of current fj (fj) on path, we have to add nop effectivaly before sub
-        // fork-join. we do that by adding instructions for mergeable nops on both paths of sub fork-join. Nops with
-        // mergeable tag will be merged in one nop if they have same source (in method merge_tagged_nops_with_same_src)
-        auto [join, req, avail, sub_fj] = fj_graph.find_sub_fork_join_from_node(fj, path, src);
-        if (join != nullptr)
-        {
-            dests.push_back(sub_fj->first[1]);
-            dests.push_back(sub_fj->second[1]);
-        }
-        else
-        {
-            dests.push_back(path[1]);
-        }
-        bool merge_nops = dests.size() > 1;
-
-        if (add_buffer_queues && (int)to_add > (int)fork_join_tiles_treshold && buff_mem_consumption < max_queue_mem &&
-            !src_is_recompute)
-        {
-            // number of tiles to add (to_add) is greater than threshold config.fork_join_tiles_treshold => use queues
-            // instead of nops
-            auto edges = graph->user_data_edges(src);
-            for (std::uint32_t fork_id = 0; fork_id < edges.size(); fork_id++)
-            {
-                for (Node *dest : dests)
-                {
-                    graphlib::Edge e = edges[fork_id];
-                    if (e.consumer_node_id == dest->id())
-                    {
-                        // number if entries in queue is 2 * microbatch_size at maximum. We take the minimum of that
-                        // upper limit and estimation we get from padding requirement to_add (which is number of tiles
-                        // we have to padd on path) When one path of fork join is much longer than other this to_add
-                        // becomes large. That would increase number of tensors we have to buffer. Luckily for us,
-                        // maximum number of tensors that can be inside one queue ,that is inside one epoch, is
-                        // microbatch_size.
-                        int num_entries = std::min(
-                            2 * graph->get_microbatch(),
-                            (int)ceil((float)to_add / (float)op_model.op_shape.outputs.at(0).volume_in_tiles()));
-                        int queue_size = (int)(ceil(to_add * tile_size));  // in bytes
-
-                        // if dests have more than one element that means that I want to add queue with source src but
-                        // more than 1 destination. Even though I make 2 instructions, later there won't be 2 queues but
-                        // one that feeds to 2 consumers if dests.size() is 2 for example.
-                        std::shared_ptr<InsertionInstruction> ins = std::make_shared<QueueInsertionInstruction>(
-                            src->name() /* src */,
-                            dest->name() /* dest */,
-                            false /* hoist_tms */,
-                            num_entries,
-                            queue_size,
-                            e.consumer_input_port_id /* input_id */,
-                            fork_id /* fork_id */);
-                        InsInstructionUniqueId key = ins->unique_id();
-                        insert_queue_ins_to_instructions(instructions, key, ins);
-                    }
-                }
-            }
-        }
-        else
-        {
-            // Some heuristic to guess how many nops we need
-            float nop_buffering = usable_l1_size / (float)tile_size;
-            // std::cout << "Expect " << nop_buffering << " tiles per nop, need to add " << to_add << std::endl;
-            /*
-            add at most a third of nops needed, since disturbance of placement
-            will shift epochs and we might not need them any more
-            We don't add all necesarry nops in one step. On the contrary, we add fraction of needed nops in each pass of
-            pre-placer post-placer loop in compile.py. This is because adding nops can cause current fork-join to span
-            across two epochs, thus elliminating further need for adding new nops (because e2e queues act as buffers).
-            */
-            float nop_base_buffer = to_add / nop_buffering;
-
-            // In case buffering requirements are abysmal skip buffering.
-            //
-            if (nop_base_buffer < 0.1)
-                return;
-
-            // If we are using inline buffering within epoch we can add all NOPs at once.
-            // Legacy post placer path is adding one third at a time due to op shifts accross epochs.
-            //
-            int buffering_step = op_models_post_placer != nullptr ? 3 : 1;
-            int buffering_scale = buffering_factor(op_model) * buffering_step;
-            std::uint32_t nop_count = (uint32_t)std::ceil(to_add / (nop_buffering * buffering_scale));
-
-            // Check if we are trying to add unreasonable amount of NOPs.
-            // Currently, unreasonable is defined as "more that can fit on grayskull (10x12 grid)".
-            if (nop_count > 120)
-            {
-                log_warning(LogGraphCompiler, "Trying to add large number of NOPs for buffering.");
-            }
-
-            log_trace(
-                LogGraphCompiler,
-                "Ask for {} nops from {}, to_add: {}, tile_size: {}",
-                nop_count,
-                src->name(),
+        if (not add_buffering_instructions_at_fork(
+                graph,
+                path,
                 to_add,
-                tile_size);
-
-            auto edges = graph->user_data_edges(src);
-            for (std::uint32_t fork_id = 0; fork_id < edges.size(); fork_id++)
-            {
-                for (Node *dest : dests)
-                {
-                    graphlib::Edge e = edges[fork_id];
-                    if (e.consumer_node_id == dest->id())
-                    {
-                        InsInstructionUniqueId key = InsInstructionUniqueId(
-                            src->name(), dest->name(), e.consumer_input_port_id, fork_id, merge_nops);
-                        if (instructions.count(key) > 0)
-                        {
-                            if (NopInsertionInstruction *nop_instr =
-                                    dynamic_cast<NopInsertionInstruction *>(instructions[key].get()))
-                            {
-                                if (nop_instr->nop_count < nop_count)
-                                {
-                                    nop_instr->set_nop_count(nop_count);
-                                    // we already added
-                                    additional_available_buff +=
-                                        (nop_count - nop_instr->nop_count) * nop_buffering * buffering_factor(op_model);
-                                }
-                            }
-                        }
-                        else
-                        {
-                            // instruction doesn't exist in map of instructions
-                            additional_available_buff += nop_count * nop_buffering * buffering_factor(op_model);
-                            std::shared_ptr<InsertionInstruction> ins = std::make_shared<NopInsertionInstruction>(
-                                src->name() /* src */,
-                                dest->name() /* dest */,
-                                false /* hoist_tms */,
-                                nop_count /* nop_count */,
-                                e.consumer_input_port_id /* input_id */,
-                                fork_id /* fork_id */,
-                                merge_nops);
-                            instructions[key] = ins;
-                        }
-                    }
-                }
-            }
-
-            fj_graph.add_nop_buffered_fj(&fj);
-        }
+                additional_available_buff,
+                instructions,
+                previous_ins_instructions,
+                op_models_post_placer,
+                op_models,
+                usable_l1_size,
+                fork_join_tiles_treshold,
+                buffering_factor,
+                fj,
+                fj_graph))
+            return;
     }
 
     FJBufferingInfo fj_buff_info =
@@ -2071,6 +2200,299 @@ generate_graph_buffering(
     return append_prev_instr(instructions, previous_ins_instructions);
 }
 
+namespace
+{
+// Buffering one fork-join still needs on its short path
+struct FJBufferingDemand
+{
+    const ForkJoin *fj;
+    const std::vector<Node *> *short_path;
+    std::uint32_t long_path_required;
+    std::uint32_t short_path_available;
+    std::uint32_t remaining;
+};
+
+// One op input buffer that can be grown to buffer every fork-join whose short path goes through it
+struct FJBufferingSlot
+{
+    Node *node;
+    graphlib::PortId port;
+    balancer::OpModel *op_model;
+    std::uint32_t grid_size;
+    std::uint32_t block_tiles;
+    std::uint32_t tile_size;
+    std::uint32_t added_tiles = 0;                                 // per core
+    std::vector<std::pair<std::size_t, float>> demand_multipliers;  // demand index, input multiplier
+};
+}  // namespace
+
+// Global counterpart of generate_graph_buffering. Instead of buffering fork-joins one at a time and maximizing every
+// input buffer on each short path, all buffering requirements of the graph are collected first and then covered
+// together, as a min-cost covering problem:
+//  - L1 input buffer growth is the cheap resource. It's shared: tiles added to an op on the short path of several
+//    fork-joins count towards all of them. Buffers are grown greedily by the best ratio of buffering provided per
+//    byte of L1, and only by as much as the remaining requirements need.
+//  - Whatever L1 can't cover is buffered at the fork with nops (one core each) or, past fork_join_tiles_treshold,
+//    with buffering queues, exactly like the greedy path does.
+// The greedy ratio rule is the usual logarithmic approximation of weighted set multicover; nested fork-joins are
+// accounted for the same way the greedy path does it, by assuming they are buffered to their requirement.
+tt::ordered_map<InsInstructionUniqueId, std::shared_ptr<InsertionInstruction>, InsInstructionUniqueIdHash>
+generate_graph_buffering_global(
+    Graph *graph,
+    FJGraph &fj_graph,
+    balancer::OpModelMap *op_models_post_placer,
+    balancer::OpModels *op_models,
+    const std::uint32_t usable_l1_size,
+    const tt::ordered_map<InsInstructionUniqueId, std::shared_ptr<InsertionInstruction>, InsInstructionUniqueIdHash>
+        previous_ins_instructions,
+    const int fork_join_tiles_treshold,
+    std::function<int(const tt::balancer::OpModel &)> buffering_factor)
+{
+    tt::ordered_map<InsInstructionUniqueId, std::shared_ptr<InsertionInstruction>, InsInstructionUniqueIdHash>
+        instructions;
+
+    const bool expand_fork_output_buffer = env_as<bool>("PYBUDA_FORK_JOIN_EXPAND_FORK_OUTPUT_BUF", 1);
+    const bool skip_expanding_buffers = env_as<bool>("PYBUDA_FORK_JOIN_SKIP_EXPANDING_BUFFERS");
+    const float scale_usable_l1_size = 0.95;
+
+    //
+    // Collect requirements, inner fork-joins first
+    //
+    std::vector<FJBufferingDemand> demands;
+    for (const ForkJoin *fj_ptr : fj_graph.get_topo_sorted_fjs())
+    {
+        const ForkJoin &fj = *fj_ptr;
+        auto [path0_req, path0_has_buff_queue, path0_buf_queue_num_entries] =
+            get_buffering_requirement(graph, op_models_post_placer, op_models, fj.first, fj, fj_graph);
+        auto [path1_req, path1_has_buff_queue, path1_buf_queue_num_entries] =
+            get_buffering_requirement(graph, op_models_post_placer, op_models, fj.second, fj, fj_graph);
+
+        if (path0_has_buff_queue or path1_has_buff_queue)
+        {
+            // A buffering queue on one path balances the fork-join on its own, see generate_graph_buffering
+            if (not path0_has_buff_queue)
+                add_queue_instr_based_on_queues_on_other_path(
+                    graph, fj.first, path1_buf_queue_num_entries, op_models_post_placer, op_models, instructions);
+            else if (not path1_has_buff_queue)
+                add_queue_instr_based_on_queues_on_other_path(
+                    graph, fj.second, path0_buf_queue_num_entries, op_models_post_placer, op_models, instructions);
+            continue;
+        }
+
+        if (path0_req == path1_req)
+            continue;
+
+        const std::vector<Node *> &short_path = path0_req < path1_req ? fj.first : fj.second;
+        std::uint32_t long_path_required = std::max(path0_req, path1_req);
+        std::uint32_t short_path_available = std::get<0>(
+            get_available_buffering(graph, op_models_post_placer, op_models, short_path, fj, fj_graph));
+        if (long_path_required <= short_path_available)
+            continue;
+
+        demands.push_back(FJBufferingDemand{
+            &fj, &short_path, long_path_required, short_path_available, long_path_required - short_path_available});
+
+        // Outer fork-joins see this one as buffered to its requirement; the allocation below always gets it there
+        fj_graph.update_buffered_fj_map(
+            fj, FJBufferingInfo(fj.second.back(), long_path_required, long_path_required, &fj));
+    }
+
+    if (demands.empty())
+        return append_prev_instr(instructions, previous_ins_instructions);
+
+    // Backend can't use all of the input buffers on the short path when more than a macro block has to be buffered
+    // (see add_buffering_on_path), so fork output buffers are expanded up front, before L1 is handed out
+    if (expand_fork_output_buffer)
+    {
+        for (const FJBufferingDemand &demand : demands)
+        {
+            balancer::OpModel &op_model = get_op_model(op_models_post_placer, op_models, demand.short_path->at(0));
+            if (demand.remaining > (std::uint32_t)op_model.block_shape().volume_no_t())
+                expand_output_buffer(op_model, scale_usable_l1_size, usable_l1_size);
+        }
+    }
+
+    //
+    // Find the input buffers each requirement can be covered with
+    //
+    std::vector<FJBufferingSlot> slots;
+    std::unordered_map<std::uint64_t, std::size_t> slot_index;  // (node id, input port) -> slot
+    std::unordered_map<Node *, std::int64_t> free_l1;           // bytes per core
+    for (std::size_t d = 0; d < demands.size(); d++)
+    {
+        const ForkJoin &fj = *demands[d].fj;
+        const std::vector<Node *> &path = *demands[d].short_path;
+
+        // Ops inside of already buffered inner fork-joins are skipped, like in add_buffering_on_path
+        Node *join = fj_graph.find_sub_fork_join_from_node(fj, path, path[0]).join;
+        float current_output_multiplier = 1.0;
+        for (std::size_t path_index = 1; path_index < path.size(); path_index++)
+        {
+            Node *prev_node = path[path_index - 1];
+            Node *node = path[path_index];
+            bool curr_node_is_join = (join == node);
+            bool outside_fj = (join == nullptr);
+            if (join == nullptr || curr_node_is_join)
+                join = fj_graph.find_sub_fork_join_from_node(fj, path, node).join;
+
+            if (skip_expanding_buffers && !node->as<graphlib::BudaOpNode>()->is_buffering_op())
+                continue;
+
+            balancer::OpModel &op_model = get_op_model(op_models_post_placer, op_models, node);
+            if (free_l1.count(node) == 0)
+                free_l1[node] = (std::int64_t)(scale_usable_l1_size * usable_l1_size) -
+                                (std::int64_t)op_model.get_l1_memory_usage();
+
+            float next_output_multiplier = 1.0;
+            for (Edge e : graph->get_edges(prev_node, node))
+            {
+                if (e.edge_type != graphlib::EdgeType::kData)
+                    continue;
+
+                float input_multiplier = current_output_multiplier;
+                for (auto tm : graph->get_edge_attributes(e)->get_tms())
+                {
+                    if (tm.op == "broadcast")
+                        input_multiplier /= (float)std::get<int>(tm.attr[1]);
+                }
+                next_output_multiplier =
+                    get_output_multiplier(node, input_multiplier, op_model, e.consumer_input_port_id);
+
+                if (not outside_fj)
+                    continue;
+
+                std::uint64_t key = (std::uint64_t(node->id()) << 16) | e.consumer_input_port_id;
+                auto [it, inserted] = slot_index.emplace(key, slots.size());
+                if (inserted)
+                {
+                    const balancer::BufferModel &input_buffer = op_model.input_buffers.at(e.consumer_input_port_id);
+                    slots.push_back(FJBufferingSlot{
+                        node,
+                        e.consumer_input_port_id,
+                        &op_model,
+                        (std::uint32_t)op_model.grid_shape.volume(),
+                        (std::uint32_t)input_buffer.block_shape.volume_no_t(),
+                        (std::uint32_t)balancer::tile_size_bytes(input_buffer.data_format)});
+                }
+                slots[it->second].demand_multipliers.emplace_back(d, input_multiplier);
+            }
+            current_output_multiplier = next_output_multiplier;
+        }
+    }
+
+    //
+    // Grow the input buffers that cover the most outstanding buffering per byte of L1, by just enough to satisfy
+    // the first requirement they cover (or until they're full), and repeat
+    //
+    auto capacity_tiles = [&free_l1](const FJBufferingSlot &slot) -> std::uint32_t
+    {
+        std::int64_t free_bytes = free_l1.at(slot.node);
+        if (free_bytes <= 0)
+            return 0;
+        std::uint32_t tiles = free_bytes / slot.tile_size;
+        return tiles - tiles % slot.block_tiles;
+    };
+
+    while (true)
+    {
+        std::size_t best = slots.size();
+        float best_ratio = 0.0;
+        for (std::size_t s = 0; s < slots.size(); s++)
+        {
+            const FJBufferingSlot &slot = slots[s];
+            if (capacity_tiles(slot) == 0)
+                continue;
+
+            float covered_per_tile = 0.0;
+            for (auto const &[d, input_multiplier] : slot.demand_multipliers)
+                if (demands[d].remaining > 0)
+                    covered_per_tile += input_multiplier;
+
+            float ratio = covered_per_tile / slot.tile_size;
+            if (ratio > best_ratio)
+            {
+                best = s;
+                best_ratio = ratio;
+            }
+        }
+
+        if (best == slots.size())
+            break;
+
+        FJBufferingSlot &slot = slots[best];
+        const std::uint32_t capacity = capacity_tiles(slot);
+        std::uint32_t step = capacity;
+        for (auto const &[d, input_multiplier] : slot.demand_multipliers)
+        {
+            if (demands[d].remaining == 0 or input_multiplier <= 0.0)
+                continue;
+            float needed = std::ceil(demands[d].remaining / (input_multiplier * slot.grid_size));
+            if (needed < step)
+                step = needed;
+        }
+        step = std::min(step + (slot.block_tiles - step % slot.block_tiles) % slot.block_tiles, capacity);
+
+        slot.added_tiles += step;
+        free_l1.at(slot.node) -= (std::int64_t)step * slot.tile_size;
+        for (auto const &[d, input_multiplier] : slot.demand_multipliers)
+        {
+            std::uint32_t covered = step * input_multiplier * slot.grid_size;
+            demands[d].remaining -= std::min(demands[d].remaining, covered);
+        }
+    }
+
+    std::uint32_t total_added_tiles = 0;
+    for (const FJBufferingSlot &slot : slots)
+    {
+        if (slot.added_tiles == 0)
+            continue;
+        balancer::BufferModel &input_buffer = slot.op_model->input_buffers.at(slot.port);
+        input_buffer.l1_size_tiles += slot.added_tiles;
+        input_buffer.size_tiles_override = true;
+        total_added_tiles += slot.added_tiles * slot.grid_size;
+        log_trace(LogGraphCompiler, "Grow input buffer {} of {} by {} tiles", slot.port, slot.node->name(), slot.added_tiles);
+    }
+
+    //
+    // Whatever is left is buffered at the forks
+    //
+    std::size_t num_buffered_at_fork = 0;
+    for (const FJBufferingDemand &demand : demands)
+    {
+        if (demand.remaining == 0)
+            continue;
+
+        std::uint32_t additional_available_buff = 0;
+        log_debug(
+            LogGraphCompiler,
+            "Fork join long path requires additional buffering of shorter path {} tiles",
+            demand.remaining);
+        num_buffered_at_fork += add_buffering_instructions_at_fork(
+            graph,
+            *demand.short_path,
+            demand.remaining,
+            additional_available_buff,
+            instructions,
+            previous_ins_instructions,
+            op_models_post_placer,
+            op_models,
+            usable_l1_size,
+            fork_join_tiles_treshold,
+            buffering_factor,
+            *demand.fj,
+            fj_graph);
+    }
+
+    log_debug(
+        LogGraphCompiler,
+        "Global fork-join buffering: {} fork-joins to buffer, {} tiles of input buffers added, {} buffered at the fork",
+        demands.size(),
+        total_added_tiles,
+        num_buffered_at_fork);
+
+    return append_prev_instr(instructions, previous_ins_instructions);
+}
+
 // Generate buffering instructions for fork-join buffering.
 // op_models_post_placer is passed in if we are in the post-placer phase - legacy path.
 // op_models is passed in balancing phase for "inline" buffering - new path.
@@ -2105,8 +2527,12 @@ FJBufferingResult insert_fork_join_buffering(
     //
     // Find buffering locations due to mismatched paths, and adjust buffers
     //
+    // Output buffer expansion along the path isn't modelled by the global allocation, keep that on the greedy path
+    const bool global_buffering = env_as<bool>("PYBUDA_FORK_JOIN_GLOBAL_BUFFERING") and
+                                  not env_as<bool>("PYBUDA_FORK_JOIN_EXPAND_OUTPUT_BUFFERS");
+    auto generate = global_buffering ? generate_graph_buffering_global : generate_graph_buffering;
     tt::ordered_map<InsInstructionUniqueId, std::shared_ptr<InsertionInstruction>, InsInstructionUniqueIdHash>
-        instructions = generate_graph_buffering(
+        instructions = generate(
             graph,
             fj_graph,
             op_models_post_placer,
@@ -1654,8 +1654,11 @@ void fuse_ops(
         }
     }
 
+    // Removals of fused away ops are batched, the node list is compacted once after the cleanup below
+    graphlib::GraphMutation mutation(graph);
+
     // Remove nodes marked for deletion by tile replace algorithm.
-    for (auto op : to_delete_nodes) graph->remove_node(op);
+    mutation.remove_nodes(std::vector<Node *>(to_delete_nodes.begin(), to_delete_nodes.end()));
 
     // Make fusing graph changes
     bool reuse_dest_on_srcA_only = device_config.is_grayskull();
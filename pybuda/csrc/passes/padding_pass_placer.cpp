@@ -274,6 +274,7 @@ void remove_buda_pad(Graph *graph, Node *node)
 
 void remove_buda_unpad(Graph *graph, Node *node)
 {
+    graphlib::GraphMutation mutation(graph);
     std::vector<Edge> outgoing_edges = graph->user_data_edges(node);
     for (Edge outgoing_edge : outgoing_edges)
     {
@@ -5,6 +5,7 @@
 
 #include "balancer/balancer_utils.hpp"
 #include "graph_lib/node_types.hpp"
+#include "graph_lib/op_registry.hpp"
 #include "graph_lib/utils.hpp"
 #include "utils/logger.hpp"
 
@@ -314,8 +315,12 @@ bool check_unsupported_hw_ops(Graph *graph, bool should_throw)
             continue;
 
         graphlib::BudaOpNode *op = node->as<graphlib::BudaOpNode>();
+        balancer::OpShape op_shape = balancer::get_op_shape(graph, node);
+        if (graphlib::get_builtin_op_parallelization(op->op_type(), op_shape.outputs[0].rt, op_shape.outputs[0].ct, 1))
+            continue;
+
         py::function pybuda_parallelization = eval_module.attr("get_f_pybuda_parallelization")(op->op_type_ptr());
-        py::object parallelization = pybuda_parallelization(balancer::get_op_shape(graph, node), 1);
+        py::object parallelization = pybuda_parallelization(op_shape, 1);
 
         if (parallelization.is_none())
         {
@@ -12,6 +12,7 @@
 #include "placer/lower_to_placer.hpp"
 #include "placer/placer.hpp"
 #include "reportify/reportify.hpp"
+#include "shared_utils/instrumentation.hpp"
 #include "utils/env.hpp"
 
 namespace tt::passes
@@ -377,12 +378,79 @@ void insert_queues(
     for (auto op_node : fixed) nodes_without_legal_op_model.erase(op_node);
 }
 
+// Apply the graph fixup for a balancer error, or for each of them if several were found in the same pass.
+// Returns whether any of the errors was a major one (counted against max_balancer_attempts); rethrows errors that
+// can't be fixed.
+//
+static bool handle_balancer_error(
+    graphlib::Graph* graph,
+    balancer::BalancerConfig& balancer_config,
+    std::shared_ptr<balancer::BalancerCacheCollection> balancer_cache_collection,
+    balancer::BalancerError const& e,
+    int attempt)
+{
+    if (balancer::BalancerError::Multiple const* type = std::get_if<balancer::BalancerError::Multiple>(&e.type))
+    {
+        bool major = false;
+        for (balancer::BalancerError const& error : type->errors)
+            major |= handle_balancer_error(graph, balancer_config, balancer_cache_collection, error, attempt);
+        return major;
+    }
+    else if (
+        balancer::BalancerError::NodeExceedsMaxOpForks const* type =
+            std::get_if<balancer::BalancerError::NodeExceedsMaxOpForks>(&e.type))
+    {
+        handle_node_exceeds_max_op_forks(graph, *type, attempt);
+    }
+    else if (
+        balancer::BalancerError::InputBroadcastExceedsMaxGridForks const* type =
+            std::get_if<balancer::BalancerError::InputBroadcastExceedsMaxGridForks>(&e.type))
+    {
+        handle_input_exceeds_max_grid_forks(graph, *type);
+    }
+    else if (
+        balancer::BalancerError::DRAMWriterNOPNeeded const* type =
+            std::get_if<balancer::BalancerError::DRAMWriterNOPNeeded>(&e.type))
+    {
+        handle_dram_writer_needs_nop(graph, balancer_config, *type);
+        return false;
+    }
+    else if (
+        balancer::BalancerError::NoValidGrid const* type = std::get_if<balancer::BalancerError::NoValidGrid>(&e.type))
+    {
+        auto nodes_without_legal_op_model = type->nodes_without_legal_op_model;
+
+        if (not nodes_without_legal_op_model.empty())
+            handle_no_valid_grid(graph, nodes_without_legal_op_model);
+
+        if (not nodes_without_legal_op_model.empty())
+            graph_padding_pass(graph, nodes_without_legal_op_model, balancer_config, balancer_cache_collection);
+
+        if (not nodes_without_legal_op_model.empty())
+            insert_queues(graph, nodes_without_legal_op_model);
+
+        if (not nodes_without_legal_op_model.empty())
+            throw e;
+    }
+    else if (balancer::BalancerError::Fatal const* type = std::get_if<balancer::BalancerError::Fatal>(&e.type))
+    {
+        log_fatal(LogGraphCompiler, "Fatal balancer error: {}", type->message);
+    }
+    else
+    {
+        throw e;
+    }
+
+    return true;
+}
+
 std::pair<std::shared_ptr<balancer::BalancerSolution>, bool> run_placer_buda_passes(
     graphlib::Graph* graph,
     balancer::BalancerConfig balancer_config,
     FractureChipIdAssignments const& fracture_chip_id_assignments,
     const py::dict& paddings_dict)
 {
+    INSTRUMENT_SCOPE("run_placer_buda_passes", "balancer");
     int max_balancer_attempts = 30;
     int attempt = 0;
     int max_minor_attempts = 200;  // we expect a lot of these... really need to not have a limit, but a forward
@@ -441,70 +509,40 @@ std::pair<std::shared_ptr<balancer::BalancerSolution>, bool> run_placer_buda_pas
         {
             log_debug(LogGraphCompiler, "Handle BalancerError: {}", e.what());
 
-            attempt++;
-            if (balancer::BalancerError::NodeExceedsMaxOpForks const* type =
-                    std::get_if<balancer::BalancerError::NodeExceedsMaxOpForks>(&e.type))
-            {
-                handle_node_exceeds_max_op_forks(graph, *type, attempt);
-            }
-            else if (
-                balancer::BalancerError::InputBroadcastExceedsMaxGridForks const* type =
-                    std::get_if<balancer::BalancerError::InputBroadcastExceedsMaxGridForks>(&e.type))
+            // All errors found in one balancer pass are fixed together, and count as a single attempt
+            if (handle_balancer_error(graph, balancer_config, balancer_cache_collection, e, attempt + 1))
             {
-                handle_input_exceeds_max_grid_forks(graph, *type);
+                INSTRUMENT_COUNTER_ADD("balancer.retries", 1);
+                attempt++;
             }
-            else if (
-                balancer::BalancerError::DRAMWriterNOPNeeded const* type =
-                    std::get_if<balancer::BalancerError::DRAMWriterNOPNeeded>(&e.type))
+            else
             {
-                handle_dram_writer_needs_nop(graph, balancer_config, *type);
-                attempt--;
+                INSTRUMENT_COUNTER_ADD("balancer.minor_retries", 1);
                 minor_attempt++;
                 if (minor_attempt > max_minor_attempts)
                     break;
             }
-            else if (
-                balancer::BalancerError::NoValidGrid const* type =
-                    std::get_if<balancer::BalancerError::NoValidGrid>(&e.type))
-            {
-                auto nodes_without_legal_op_model = type->nodes_without_legal_op_model;
-
-                if (not nodes_without_legal_op_model.empty())
-                    handle_no_valid_grid(graph, nodes_without_legal_op_model);
-
-                if (not nodes_without_legal_op_model.empty())
-                    graph_padding_pass(graph, nodes_without_legal_op_model, balancer_config, balancer_cache_collection);
-
-                if (not nodes_without_legal_op_model.empty())
-                    insert_queues(graph, nodes_without_legal_op_model);
-
-                if (not nodes_without_legal_op_model.empty())
-                    throw;
-            }
-            else if (balancer::BalancerError::Fatal const* type = std::get_if<balancer::BalancerError::Fatal>(&e.type))
-            {
-                log_fatal(LogGraphCompiler, "Fatal balancer error: {}", type->message);
-            }
-            else
-            {
-                throw;
-            }
         }
 
         reportify::dump_graph(graph->name(), "balancer_error_handler_attempt" + std::to_string(attempt), graph);
 
-        // We have to rerun the scheduler + some pre_placer graph passes after editing the graph
+        // We have to rerun the scheduler + some pre_placer graph passes after editing the graph. Only user-given chip
+        // breaks are passed in, so the chip placement policy splits the edited graph again.
+        if (not balancer_config.user_op_names_to_chip_break.has_value())
+            balancer_config.user_op_names_to_chip_break = balancer_config.op_names_to_chip_break;
         placer::PlacerConfigUpdate updated_config = schedule_pre_placer_graph(
             graph,
             balancer_config.device_config,
             balancer_config.scheduler_config,
             balancer_config.chip_ids,
-            balancer_config.op_names_to_chip_break,
+            balancer_config.user_op_names_to_chip_break.value(),
             balancer_config.op_names_to_epoch_break,
             fracture_chip_id_assignments,
             "_attempt" + std::to_string(attempt) /* nops_remote_devices_postfix */,
-            balancer_config.use_interactive_placer);
+            balancer_config.use_interactive_placer,
+            balancer_config.chip_placement_policy);
         balancer_config.op_to_chip_id_assignment = updated_config.op_to_chip_id_assignment;
+        balancer_config.op_names_to_chip_break = updated_config.op_names_to_chip_break;
     }
 
     log_fatal("Error: We failed to balance/place after {} attempts", max_balancer_attempts);
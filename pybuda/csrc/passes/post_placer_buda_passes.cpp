@@ -426,15 +426,15 @@ void replace_recompute_with_checkpoint(graphlib::Graph *graph, const placer::Pla
 }
 
 static bool feeds_remote_chips(
-    const placer::PlacerSolution &placer_solution, graphlib::Graph *graph, graphlib::Node *producer)
+    const placer::NodePlacements &node_placements, graphlib::Graph *graph, graphlib::Node *producer)
 {
-    std::uint32_t producer_chip_id = placer_solution.chip_id(producer->name());
+    std::uint32_t producer_chip_id = node_placements.chip_id(producer);
     for (const Edge &e : graph->user_data_edges(producer))
     {
         graphlib::Node *dest_node = graph->node_by_id(e.consumer_node_id);
         if (dest_node->node_type() == graphlib::NodeType::kBudaOp)
         {
-            if (producer_chip_id != placer_solution.chip_id(dest_node->name()))
+            if (producer_chip_id != node_placements.chip_id(dest_node))
             {
                 return true;
             }
@@ -471,7 +471,7 @@ void validate_subgraph_placement(Graph *graph, placer::PlacerSolution &placer_so
 }
 
 static bool feeds_multiple_remote_consumers(
-    const placer::PlacerSolution &placer_solution, graphlib::Graph *graph, graphlib::Node *producer)
+    const placer::NodePlacements &node_placements, graphlib::Graph *graph, graphlib::Node *producer)
 {
     std::set<std::uint32_t> consumer_chip_ids;
     for (const Edge &e : graph->user_data_edges(producer))
@@ -479,7 +479,7 @@ static bool feeds_multiple_remote_consumers(
         graphlib::Node *dest_node = graph->node_by_id(e.consumer_node_id);
         if (dest_node->node_type() == graphlib::NodeType::kBudaOp)
         {
-            consumer_chip_ids.insert(placer_solution.chip_id(dest_node->name()));
+            consumer_chip_ids.insert(node_placements.chip_id(dest_node));
         }
     }
     return consumer_chip_ids.size() > 1;
@@ -500,6 +500,7 @@ bool any_consumers_cross_epoch(graphlib::Graph *graph, graphlib::Node *producer)
 void remove_buffering_queues_from_cross_epoch_edges(
     graphlib::Graph *graph, const placer::PlacerSolution &placer_solution)
 {
+    const placer::NodePlacements &node_placements = placer_solution.node_placements(graph);
     for (graphlib::Node *node : graphlib::topological_sort(*graph))
     {
         if (node->node_type() != graphlib::NodeType::kQueue)
@@ -513,7 +514,7 @@ void remove_buffering_queues_from_cross_epoch_edges(
 
             if (source_node->node_type() == graphlib::NodeType::kBudaOp)
             {
-                std::uint32_t src_temporal_epoch = placer_solution.temporal_epoch_id(source_node->name());
+                std::uint32_t src_temporal_epoch = node_placements.temporal_epoch_id(source_node);
                 auto user_edges = graph->user_data_edges(queue);
                 bool no_users_in_src_epoch = true;
                 for (std::size_t i = 0; i < user_edges.size(); i++)
@@ -521,7 +522,7 @@ void remove_buffering_queues_from_cross_epoch_edges(
                     Node *dest_node = graph->node_by_id(user_edges[i].consumer_node_id);
                     if (dest_node->node_type() == graphlib::NodeType::kBudaOp)
                     {
-                        std::uint32_t dest_temporal_epoch = placer_solution.temporal_epoch_id(dest_node->name());
+                        std::uint32_t dest_temporal_epoch = node_placements.temporal_epoch_id(dest_node);
                         if (src_temporal_epoch != dest_temporal_epoch)
                         {
                             // if this is the last user of the queue and none of the previous users were in the same
@@ -549,6 +550,7 @@ void insert_epoch_to_epoch_queues(
     const balancer::CutEdges &graph_solver_cut_edges)
 {
     bool firmware_looping_enabled = env_as<int>("NUM_EXEC_LOOP_ITERATIONS", 0) > 1;
+    const placer::NodePlacements &node_placements = placer_solution.node_placements(graph);
     for (graphlib::Node *node : graphlib::topological_sort(*graph))
     {
         if (node->node_type() != graphlib::NodeType::kBudaOp)
@@ -562,7 +564,7 @@ void insert_epoch_to_epoch_queues(
 
         try
         {
-            std::uint32_t src_temporal_epoch = placer_solution.temporal_epoch_id(node->name());
+            std::uint32_t src_temporal_epoch = node_placements.temporal_epoch_id(node);
 
             // Only create one e2e queue for each destination epoch
             std::unordered_map<std::uint32_t, graphlib::QueueNode *> e2e_queues;
@@ -570,9 +572,9 @@ void insert_epoch_to_epoch_queues(
             graphlib::QueueNode *buf_q = nullptr;
 
             const bool producer_feeds_multiple_remote_consumers =
-                feeds_multiple_remote_consumers(placer_solution, graph, node);
+                feeds_multiple_remote_consumers(node_placements, graph, node);
             const bool producer_feeds_cross_epoch_consumer = any_consumers_cross_epoch(graph, node);
-            const bool producer_feeds_remote_chip = feeds_remote_chips(placer_solution, graph, node);
+            const bool producer_feeds_remote_chip = feeds_remote_chips(node_placements, graph, node);
 
             for (Edge e : graph->user_data_edges(node))
             {
@@ -585,7 +587,7 @@ void insert_epoch_to_epoch_queues(
 
                 try
                 {
-                    std::uint32_t dest_temporal_epoch = placer_solution.temporal_epoch_id(dest_node->name());
+                    std::uint32_t dest_temporal_epoch = node_placements.temporal_epoch_id(dest_node);
                     TT_ASSERT(placer_solution.epoch_id_to_subgraph_index.at(src_temporal_epoch) == placer_solution.epoch_id_to_subgraph_index.at(dest_temporal_epoch), "e2e queues across subgraphs not allowed");
                     if (src_temporal_epoch > dest_temporal_epoch)
                     {
@@ -7,7 +7,9 @@
 #include "passes/fuse_ops.hpp"
 #include "passes/lowering_context.hpp"
 #include "passes/passes_utils.hpp"
+#include "placer/eth_topology.hpp"
 #include "placer/lower_to_placer.hpp"
+#include "shared_utils/instrumentation.hpp"
 #include "utils/logger.hpp"
 
 namespace tt {
@@ -498,8 +500,10 @@ placer::PlacerConfigUpdate schedule_pre_placer_graph(
     std::vector<std::vector<std::string>> const &op_names_to_epoch_break,
     passes::FractureChipIdAssignments const &fracture_chip_id_assignments,
     std::string const &nops_remote_devices_postfix,
-    bool use_interactive_placer)
+    bool use_interactive_placer,
+    placer::ChipPlacementPolicy chip_placement_policy)
 {
+    INSTRUMENT_SCOPE("schedule_pre_placer_graph");
     scheduler::Schedule scheduled_ops = run_scheduler(scheduler_config, graph);
     placer::ChipPlacerConfig chip_placer_config = {
         .chip_ids = chip_ids,
@@ -523,6 +527,32 @@ placer::PlacerConfigUpdate schedule_pre_placer_graph(
     placer::OpToChipIdAssignment op_to_chip_id_assignment =
         get_op_to_chip_id_assignment(chip_placer_config, scheduled_ops);
 
+    // Split the schedule across chips by traffic, unless the user placed the chip breaks. The placers walk the chips in
+    // the same order, and a chip break at the first op of each chip keeps the chips' ops out of each other's epochs.
+    std::vector<std::vector<std::string>> updated_op_names_to_chip_break = op_names_to_chip_break;
+    if (chip_placement_policy == placer::ChipPlacementPolicy::MIN_TRAFFIC and not device_config.is_grayskull() and
+        chip_ids.size() > 1 and op_names_to_chip_break.empty())
+    {
+        chip_placer_config.chip_ids = placer::lowering::apply_chip_placement_policy(
+            device_config, chip_placement_policy, chip_ids);
+        op_to_chip_id_assignment = placer::get_min_traffic_op_to_chip_id_assignment(
+            chip_placer_config,
+            scheduled_ops,
+            placer::lowering::get_chip_traffic_model(graph, scheduled_ops),
+            placer::EthLinkTopology(device_config));
+
+        std::optional<std::uint32_t> previous_chip_id;
+        for (const std::string &op_name : scheduled_ops)
+        {
+            if (chip_placer_config.op_to_epoch_type.at(op_name) != graphlib::NodeEpochType::Forward)
+                continue;
+            std::uint32_t chip_id = op_to_chip_id_assignment.at(op_name);
+            if (previous_chip_id.has_value() and previous_chip_id.value() != chip_id)
+                updated_op_names_to_chip_break.push_back({op_name});
+            previous_chip_id = chip_id;
+        }
+    }
+
     // update chip-id assignment, epoch breaking to accommodate fractured ops
     std::vector<std::vector<std::string>> updated_op_names_to_epoch_break = op_names_to_epoch_break;
     if (not fracture_chip_id_assignments.empty())
@@ -548,7 +578,10 @@ placer::PlacerConfigUpdate schedule_pre_placer_graph(
     validate_buffering_queues(graph);
 
     return placer::PlacerConfigUpdate(
-        op_to_chip_id_assignment, op_names_to_chip_break, updated_op_names_to_epoch_break);
+        op_to_chip_id_assignment,
+        updated_op_names_to_chip_break,
+        updated_op_names_to_epoch_break,
+        op_names_to_chip_break);
 }
 
 static void insert_nop_fork(
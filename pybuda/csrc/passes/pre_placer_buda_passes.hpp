@@ -58,7 +58,8 @@ placer::PlacerConfigUpdate schedule_pre_placer_graph(
     std::vector<std::vector<std::string>> const &op_names_to_epoch_break,
     passes::FractureChipIdAssignments const &fracture_chip_id_assignments,
     std::string const &nops_remote_devices_postfix = "",
-    bool use_interactive_placer = true);
+    bool use_interactive_placer = true,
+    placer::ChipPlacementPolicy chip_placement_policy = placer::ChipPlacementPolicy::MMIO_LAST);
 
 std::pair<placer::OpToChipIdAssignment, std::vector<std::vector<std::string>>>
 update_config_for_fractured_ops(
@@ -207,6 +207,7 @@ void reproduce_subgraph(
         placer_solution->epoch_id_to_epoch_info.erase(i);
     }
     placer_solution->num_epochs = 1;
+    placer_solution->invalidate_node_placements();
 
     for (auto node : graphlib::topological_sort(*graph))
     {
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <map>
+
+#include "passes/fork_join.hpp"
+#include "test/common.hpp"
+
+namespace tt::test
+{
+
+// Stack of residual blocks, each with an attention-like inner fork
+struct ResidualForkJoinGraph : public BudaGraphTest
+{
+   protected:
+    static constexpr int kNumBlocks = 4;
+
+    virtual std::vector<OpType *> create_graph() override
+    {
+        auto act = create_activation(1, 1, 32, 32);
+        graphlib::Node *x = create_op("gelu", {act});
+        for (int i = 0; i < kNumBlocks; i++)
+        {
+            auto q = create_op("exp", {x});
+            auto k = create_op("sqrt", {x});
+            auto qk = create_op("add", {q, k});
+            auto v = create_op("gelu", {qk});
+            x = create_op("add", {x, v});
+        }
+        return {x->as<OpType>()};
+    }
+};
+
+TEST_F(ResidualForkJoinGraph, finds_all_fork_joins)
+{
+    FJGraph fj_graph(get_graph());
+    const std::vector<ForkJoin> &fork_joins = fj_graph.get_fjs();
+
+    // Each block forks three ways: residual, q and k. q and k join at qk, and each of them joins the residual
+    // again at the block's final add.
+    std::map<std::pair<graphlib::Node *, graphlib::Node *>, int> fork_join_count;
+    for (const ForkJoin &fj : fork_joins) fork_join_count[{fj.first.front(), fj.first.back()}]++;
+
+    EXPECT_EQ(fork_joins.size(), 3u * kNumBlocks);
+    EXPECT_EQ(fork_join_count.size(), 2u * kNumBlocks);
+    for (auto const &[fork_and_join, count] : fork_join_count)
+        EXPECT_TRUE(count == 1 or count == 2) << fork_and_join.first->name() << " -> " << fork_and_join.second->name();
+
+    // Inner fork-joins are contained by the outer ones of the same block
+    EXPECT_EQ(fj_graph.get_topo_sorted_fjs().size(), fork_joins.size());
+    for (const ForkJoin *fj : fj_graph.get_topo_sorted_fjs())
+    {
+        const ForkJoin *parent = fj_graph.get_parent_fj_map().at(fj);
+        EXPECT_EQ(parent->first.front(), fj->first.front());
+    }
+}
+
+}  // namespace tt::test
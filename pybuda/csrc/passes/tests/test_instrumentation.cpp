@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "gtest/gtest.h"
+#include "shared_utils/instrumentation.hpp"
+#include "third_party/json/json.hpp"
+
+namespace tt::test
+{
+
+struct Instrumentation : testing::Test
+{
+    void SetUp() override { instrumentation::reset(); }
+};
+
+TEST_F(Instrumentation, scopes_record_counter_deltas)
+{
+    {
+        INSTRUMENT_SCOPE("outer_pass");
+        INSTRUMENT_COUNTER_ADD("test.hits", 2);
+        {
+            INSTRUMENT_SCOPE("inner_phase", "balancer");
+            INSTRUMENT_COUNTER_ADD("test.hits", 3);
+            INSTRUMENT_COUNTER_SET("test.nodes", 42);
+        }
+    }
+    EXPECT_EQ(instrumentation::counter_value("test.hits"), 5);
+
+    auto trace = nlohmann::json::parse(instrumentation::chrome_trace_json());
+    std::map<std::string, nlohmann::json> scopes;
+    for (auto const &event : trace["traceEvents"])
+        if (event["ph"] == "X")
+            scopes[event["name"]] = event;
+
+    ASSERT_EQ(scopes.size(), 2);
+    EXPECT_EQ(scopes["outer_pass"]["cat"], "pass");
+    EXPECT_EQ(scopes["outer_pass"]["args"]["test.hits"], 5);
+    EXPECT_EQ(scopes["inner_phase"]["cat"], "balancer");
+    EXPECT_EQ(scopes["inner_phase"]["args"]["test.hits"], 3);
+    EXPECT_EQ(scopes["inner_phase"]["args"]["test.nodes"], 42);
+    EXPECT_GE(scopes["outer_pass"]["dur"].get<std::int64_t>(), scopes["inner_phase"]["dur"].get<std::int64_t>());
+    EXPECT_GT(scopes["inner_phase"]["args"]["rss_end_kb"].get<std::int64_t>(), 0);
+
+    std::string summary = instrumentation::summary_table();
+    EXPECT_NE(summary.find("inner_phase"), std::string::npos);
+    EXPECT_NE(summary.find("test.hits"), std::string::npos);
+}
+
+TEST_F(Instrumentation, reset_drops_open_events)
+{
+    std::uint64_t event_id = instrumentation::begin_event("stale", "compile");
+    INSTRUMENT_COUNTER_ADD("test.resets", 1);
+    instrumentation::reset();
+
+    // Closing an event recorded before the reset is a no-op
+    instrumentation::end_event(event_id);
+    EXPECT_EQ(instrumentation::counter_value("test.resets"), 0);
+    EXPECT_TRUE(nlohmann::json::parse(instrumentation::chrome_trace_json())["traceEvents"].empty());
+}
+
+}  // namespace tt::test
@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "graph_lib/defines.hpp"
+#include "graph_lib/node_types.hpp"
+#include "gtest/gtest.h"
+#include "scheduler/memory_pressure.hpp"
+#include "scheduler/scheduler.hpp"
+#include "test/common.hpp"
+
+using namespace tt;
+namespace tt::test
+{
+
+// Independent chains of unary ops hanging off one activation, summed up at the end. Ops are created layer by layer,
+// so the topological reference runs the chains side by side and keeps the outputs of every chain alive at once.
+struct WideAndDeepChains : public BudaGraphTest
+{
+   protected:
+    static constexpr int num_chains = 8;
+    static constexpr int chain_depth = 6;
+
+    virtual std::vector<OpType*> create_graph() override
+    {
+        auto in0 = create_activation(1, 1, 64, 64);
+
+        std::vector<OpType*> chains(num_chains);
+        for (int depth = 0; depth < chain_depth; depth++)
+            for (int chain = 0; chain < num_chains; chain++)
+                chains[chain] = create_op("exp", {depth == 0 ? static_cast<graphlib::Node*>(in0) : chains[chain]});
+
+        OpType* sum = create_op("add", {chains[0], chains[1]});
+        for (int chain = 2; chain < num_chains; chain++) sum = create_op("add", {sum, chains[chain]});
+
+        return {sum};
+    }
+};
+
+TEST_F(WideAndDeepChains, lower_peak_than_reference)
+{
+    graphlib::Graph* graph = get_graph();
+
+    scheduler::Schedule reference = scheduler::run_topological_scheduler(graph);
+    scheduler::Schedule schedule =
+        scheduler::run_scheduler(scheduler::SchedulerConfig(scheduler::SchedulerPolicy::MemoryPressure), graph);
+    ASSERT_EQ(schedule.size(), reference.size());
+
+    // All ops produce the same shape and format
+    graphlib::Node* op = graph->get_node_by_name(reference.front());
+    std::uint64_t tensor_bytes = op->shape().volume() * data_format_byte_size(op->output_df());
+
+    std::uint64_t reference_peak = scheduler::get_peak_live_bytes(graph, reference);
+    std::uint64_t peak = scheduler::get_peak_live_bytes(graph, schedule);
+    EXPECT_EQ(reference_peak, (num_chains + 1) * tensor_bytes);
+    EXPECT_LT(peak, reference_peak);
+
+    // Chains run one after the other, at most the running sum, the previous chain's output and the current chain are
+    // alive
+    EXPECT_LE(peak, 3 * tensor_bytes);
+}
+
+}  // namespace tt::test
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <experimental/filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "lower_to_buda/netlist.hpp"
+
+namespace tt::test
+{
+
+static BudaOp create_buda_op(std::string const& name, std::vector<std::string> const& inputs)
+{
+    BudaOp op;
+    op.name = name;
+    op.type = "add";
+    op.grid = BudaOpGrid{1, 2, 2, 4};
+    for (std::string const& input : inputs) op.inputs.push_back(BudaName(input));
+    op.input_data_formats = std::vector<DataFormat>(inputs.size(), DataFormat::Float16_b);
+    op.output_data_format = DataFormat::Float16_b;
+    op.intermediate_data_format = DataFormat::Float16_b;
+    op.accumulate_data_format = DataFormat::Float16_b;
+    op.fidelity = MathFidelity::HiFi3;
+    op.untilize_output = false;
+    op.blocks = BudaBlocks{1, 2, 2, 1, 1};
+    op.buf_size_mb = 2;
+    op.gradient_op = false;
+    op.grid_transpose = false;
+    op.tile_dim = TileDim::Dim32x32;
+    return op;
+}
+
+static BudaQueue create_buda_queue(std::string const& name, std::string const& type)
+{
+    BudaQueue q(name, type, "FIFO", 0, TileDim::Dim32x32);
+    q.input_name = "HOST";
+    q.entries = 4;
+    q.microbatch = 4;
+    q.dims = BudaQueueDimensions{2, 4};
+    q.data_format = DataFormat::Float16_b;
+    q.loc = BudaQueueLocation::DRAM;
+    q.blocks = BudaBlocks{1, 2, 2, 1, 1};
+    for (std::uint32_t i = 0; i < 8; i++) q.dram_loc.push_back(BudaQueueDramLoc{i % 6, 0x30000000 + i * 0x1000});
+    return q;
+}
+
+// Enough epochs to go through several windows of parallel formatting, and enough output to overflow the file buffer
+static BudaNetlist create_netlist()
+{
+    BudaNetlist netlist;
+    netlist.arch_string = "wormhole_b0";
+    netlist.append_comment("Netlist emission test");
+    netlist.append_comment("Second line");
+    netlist.debug_info = Comment(std::string(3 << 19, 'x'));  // larger than the file buffer, written past it
+
+    // Uncommon types come after the common ones, in order of first appearance
+    for (std::string type : {"custom_b", "epoch_to_epoch", "input", "custom_a", "parameter", "custom_b", "output"})
+        netlist.queues.push_back(create_buda_queue(type + std::to_string(netlist.queues.size()), type));
+
+    for (std::string arch : {"wormhole_b0", "grayskull"})
+    {
+        BudaGraph graph(arch + "_graph", arch, 4);
+        for (std::uint32_t epoch = 0; epoch < 300; epoch++)
+        {
+            graph.epoch_types.push_back(
+                epoch % 3 == 0 ? graphlib::NodeEpochType::Forward : graphlib::NodeEpochType::Backward);
+            graph.epoch_target_devices.push_back(BudaDevice(epoch % 2));
+            graph.epoch_to_temporal_epoch_id.push_back(epoch / 2);
+            graph.epoch_to_subgraph_index.push_back(0);
+
+            // Empty epochs are skipped on grayskull only
+            std::vector<BudaOp> ops;
+            for (int i = 0; epoch % 7 != 0 and i < 10; i++)
+            {
+                std::string prefix = "op_" + std::to_string(epoch) + "_";
+                std::string name = prefix + std::to_string(i);
+                ops.push_back(create_buda_op(name, {i == 0 ? "input2" : prefix + std::to_string(i - 1), "parameter4"}));
+                if (i == 5)
+                    ops.back().debug_info = Comment("Debug info of " + name);
+            }
+            graph.ops.push_back(ops);
+        }
+        netlist.graphs.push_back(graph);
+    }
+
+    netlist.programs.push_back(program::Program("run_fwd"));
+    return netlist;
+}
+
+TEST(NetlistEmission, stream_and_file_match_yaml)
+{
+    BudaNetlist netlist = create_netlist();
+    std::string yaml = netlist.dump_to_yaml();
+    ASSERT_GT(yaml.size(), std::size_t(1) << 20);
+
+    std::string path = (std::experimental::filesystem::temp_directory_path() / "netlist_emission_test.yaml").string();
+    for (bool parallel_graphs : {false, true})
+    {
+        std::ostringstream ss;
+        netlist.dump_to_stream(ss, parallel_graphs);
+        EXPECT_EQ(ss.str(), yaml) << "parallel_graphs: " << parallel_graphs;
+
+        netlist.dump_to_file(path, parallel_graphs);
+        std::ifstream file(path);
+        std::string written((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        EXPECT_EQ(written, yaml) << "parallel_graphs: " << parallel_graphs;
+    }
+    std::experimental::filesystem::remove(path);
+
+    std::vector<std::string> groups = {"input", "output", "parameter", "epoch_to_epoch", "custom_b", "custom_a"};
+    for (std::size_t i = 1; i < groups.size(); i++)
+        EXPECT_LT(yaml.find("# " + groups[i - 1] + "\n"), yaml.find("# " + groups[i] + "\n")) << groups[i];
+
+    EXPECT_THROW(netlist.dump_to_file("/nonexistent/netlist.yaml"), std::runtime_error);
+}
+
+}  // namespace tt::test
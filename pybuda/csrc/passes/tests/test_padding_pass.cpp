@@ -1,9 +1,11 @@
 // SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
 //
 // SPDX-License-Identifier: Apache-2.0
+#include "balancer/tests/test_balancer_utils.hpp"
 #include "graph_lib/shape.hpp"
 #include "gtest/gtest.h"
 #include "passes/padding_pass_placer.hpp"
+#include "test/common.hpp"
 
 using namespace tt;
 
@@ -23,3 +25,38 @@ TEST_F(PaddingFunctionTests, test_biggest_prime_factor_10_increment)
         tt::graphlib::Shape::BUDA_TILE_DIM,
         tt::padding_placer::compute_pad(shape_r_size, tt::padding_placer::PaddingCriterion::BIGGEST_FACTOR_PRIME_10_INCREMENT));
 }
+
+namespace tt::test
+{
+
+struct PaddingPass : public BudaGraphTest
+{
+   protected:
+    virtual std::vector<OpType *> create_graph() override
+    {
+        // 13 tiles in R is irregular
+        auto act = create_activation(1, 1, 13 * 32, 64);
+        gelu = create_op("gelu", {act});
+        return {create_op("exp", {gelu})};
+    }
+
+    OpType *gelu;
+};
+
+TEST_F(PaddingPass, pass_pads_irregular_node)
+{
+    graphlib::Graph *graph = get_graph();
+    balancer::BalancerConfig balancer_config = create_balancer_config();
+
+    balancer::BudaOpNodeLegalizerFailureInfo failure_info;
+    failure_info.recordOpModelFailure(balancer::OpModelFailureReason::InputBufferAllocationFailure);
+    std::unordered_map<graphlib::Node *, const balancer::BudaOpNodeLegalizerFailureInfo> nodes_to_pad = {
+        {gelu, failure_info}};
+
+    EXPECT_TRUE(padding_placer::pad_pass_placer(
+        graph, nodes_to_pad, balancer_config, create_balancer_cache_collection()));
+    EXPECT_EQ(gelu->shape(), graphlib::Shape::create_buda(1, 1, 14 * 32, 64));
+    EXPECT_TRUE(gelu->as<graphlib::TaggedNode>()->has_tag("padding"));
+}
+
+}  // namespace tt::test
@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <stdlib.h>
+
+#include <algorithm>
+#include <experimental/filesystem>
+#include <fstream>
+
+#include "gtest/gtest.h"
+#include "json.hpp"
+#include "reportify/reportify.hpp"
+#include "test/common.hpp"
+
+namespace tt::test
+{
+
+struct ReportifyDumps : public BudaGraphTest
+{
+   protected:
+    std::string dump_dir;
+
+    virtual std::vector<OpType*> create_graph() override
+    {
+        auto in0 = create_activation(1, 1, 32, 32);
+        auto exp = create_op("exp", {in0});
+        return {create_op("gelu", {exp})};
+    }
+
+    void SetUp() override
+    {
+        BudaGraphTest::SetUp();
+        dump_dir = (std::experimental::filesystem::temp_directory_path() / ("reportify_" + get_current_test_name())).string();
+        std::experimental::filesystem::remove_all(dump_dir);
+    }
+
+    void TearDown() override
+    {
+        std::experimental::filesystem::remove_all(dump_dir);
+        BudaGraphTest::TearDown();
+    }
+
+    void dump(std::string const& graph_prefix) { reportify::dump_graph(dump_dir, "", graph_prefix, get_graph()); }
+
+    std::string read_dump(std::string const& file_name) const
+    {
+        std::ifstream file(reportify::build_report_path(dump_dir, "", reportify::get_pass_reports_relative_directory()) + file_name);
+        EXPECT_TRUE(file.is_open()) << file_name;
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+};
+
+TEST_F(ReportifyDumps, written_in_order_from_snapshot)
+{
+    graphlib::Graph* graph = get_graph();
+
+    dump("first");
+    dump("latest");
+
+    // Changing the graph right away doesn't change the dumps already submitted
+    create_op("exp", {graph->get_node_by_name("gelu0")});
+    dump("second");
+    dump("latest");
+    reportify::flush_dumps();
+
+    auto first = nlohmann::json::parse(read_dump("first.buda"));
+    auto second = nlohmann::json::parse(read_dump("second.buda"));
+    EXPECT_FALSE(first["nodes"].contains("exp1"));
+    EXPECT_TRUE(second["nodes"].contains("exp1"));
+    EXPECT_EQ(second["topological_sorted_nodes"].size(), first["topological_sorted_nodes"].size() + 1);
+    EXPECT_EQ(first["nodes"]["exp0"]["output_nodes"], nlohmann::json::array({"gelu0"}));
+
+    // Last dump to a path wins, and it's compact unless asked otherwise
+    std::string latest = read_dump("latest.buda");
+    EXPECT_EQ(nlohmann::json::parse(latest), second);
+    EXPECT_EQ(latest.find('\n'), std::string::npos);
+
+    setenv("PYBUDA_REPORTIFY_PRETTY_JSON", "1", 0);
+    dump("pretty");
+    reportify::flush_dumps();
+    unsetenv("PYBUDA_REPORTIFY_PRETTY_JSON");
+    std::string pretty = read_dump("pretty.buda");
+    EXPECT_NE(pretty.find("\n    \""), std::string::npos);
+    EXPECT_EQ(nlohmann::json::parse(pretty), second);
+}
+
+TEST_F(ReportifyDumps, delta_after_first_dump)
+{
+    graphlib::Graph* graph = get_graph();
+    setenv("PYBUDA_REPORTIFY_DUMP_DELTAS", "1", 0);
+
+    dump("graph");
+
+    // Change one node, add one and remove one
+    graph->get_node_by_name("exp0")->as<graphlib::TaggedNode>()->tag("changed");
+    graphlib::Node* output = graph->get_node_by_name("output0");
+    graph->remove_node(output);
+    create_output(create_op("exp", {graph->get_node_by_name("gelu0")}));
+
+    dump("graph");
+    reportify::flush_dumps();
+    unsetenv("PYBUDA_REPORTIFY_DUMP_DELTAS");
+
+    auto full = nlohmann::json::parse(read_dump("graph.buda"));
+    auto delta = nlohmann::json::parse(read_dump("graph.buda.delta"));
+    EXPECT_TRUE(full["nodes"].contains("output0"));
+    EXPECT_FALSE(full["nodes"].contains("exp1"));
+
+    std::vector<std::string> changed;
+    for (auto const& [name, node] : delta["changed_nodes"].items()) changed.push_back(name);
+    std::sort(changed.begin(), changed.end());
+    EXPECT_EQ(changed, (std::vector<std::string>{"exp0", "exp1", "gelu0", "output1"}));
+    EXPECT_EQ(delta["removed_nodes"], nlohmann::json::array({"output0"}));
+    EXPECT_EQ(delta["topological_sorted_nodes"].size(), full["topological_sorted_nodes"].size() + 1);
+}
+
+}  // namespace tt::test
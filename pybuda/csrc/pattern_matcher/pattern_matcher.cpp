@@ -4,7 +4,10 @@
 #include "pattern_matcher/pattern_matcher.hpp"
 #include "utils/logger.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
+#include <map>
 #include <string>
 #include <unordered_set>
 
@@ -26,8 +29,24 @@ using tt::LogPatternMatcher;
 
 namespace pattern_matcher {
 
-int num_subgraph_pattern_matches(graph_type& small_graph, graph_type& large_graph, int max_matches = INT_MAX) {
+// Op types of both graphs as ids into one table, so VF2 compares ints instead of strings. Wildcards map to -1.
+static std::pair<std::vector<int>, std::vector<int>> intern_op_types(const graph_type& small_graph, const graph_type& large_graph) {
+    std::unordered_map<std::string, int> op_type_ids;
+    auto intern = [&op_type_ids](const graph_type& graph) {
+        std::vector<int> ids(num_vertices(graph));
+        for (auto v : boost::make_iterator_range(vertices(graph))) {
+            const std::string& op_type = graph[v].op_type;
+            ids[v] = (op_type == "*") ? -1 : op_type_ids.emplace(op_type, op_type_ids.size()).first->second;
+        }
+        return ids;
+    };
+    std::vector<int> small_ids = intern(small_graph);
+    return std::make_pair(std::move(small_ids), intern(large_graph));
+}
+
+int num_subgraph_pattern_matches(graph_type& small_graph, graph_type& large_graph, int max_matches) {
     int total_matches = 0;
+    auto [small_op_types, large_op_types] = intern_op_types(small_graph, large_graph);
 
     std::unordered_map<NodeId, std::unordered_set<NodeId>> unique_matches;
 
@@ -52,12 +71,8 @@ int num_subgraph_pattern_matches(graph_type& small_graph, graph_type& large_grap
         return small_graph[edge_a].producer_output_edge_index == large_graph[edge_b].producer_output_edge_index
             and small_graph[edge_a].consumer_input_edge_index == large_graph[edge_b].consumer_input_edge_index ;
     };
-    auto vertex_predicate = [&](auto vertex_a, auto vertex_b) {
-        if (small_graph[vertex_a].op_type == "*") {
-            return true;
-        }
-
-        return small_graph[vertex_a].op_type == large_graph[vertex_b].op_type;
+    auto vertex_predicate = [&small_op_types = small_op_types, &large_op_types = large_op_types](auto vertex_a, auto vertex_b) {
+        return small_op_types[vertex_a] == -1 or small_op_types[vertex_a] == large_op_types[vertex_b];
     };
     boost::vf2_subgraph_iso(
         small_graph,
@@ -197,11 +212,138 @@ std::vector<std::pair<VertexId, VertexId>> get_subgraph_vertex_start_end_pairs(g
 }
 
 
+std::vector<std::uint32_t> get_vertex_colours(const graph_type& graph, int iterations) {
+    std::vector<std::uint32_t> colours(num_vertices(graph));
+    std::unordered_map<std::string, std::uint32_t> op_type_ids;
+    for (auto v : boost::make_iterator_range(vertices(graph))) {
+        colours[v] = op_type_ids.emplace(graph[v].op_type, op_type_ids.size()).first->second;
+    }
+
+    std::size_t num_colours = op_type_ids.size();
+    for (int iteration = 0; iteration < iterations; ++iteration) {
+        std::map<std::vector<std::uint64_t>, std::uint32_t> signature_ids;
+        std::vector<std::uint32_t> next_colours(colours.size());
+        std::vector<std::uint64_t> operands, users;
+        for (auto v : boost::make_iterator_range(vertices(graph))) {
+            operands.clear();
+            users.clear();
+            for (auto e : boost::make_iterator_range(in_edges(v, graph))) {
+                operands.push_back((std::uint64_t(graph[e].consumer_input_edge_index) << 32) | colours[source(e, graph)]);
+            }
+            for (auto e : boost::make_iterator_range(out_edges(v, graph))) {
+                users.push_back((std::uint64_t(graph[e].producer_output_edge_index) << 32) | colours[target(e, graph)]);
+            }
+            std::sort(operands.begin(), operands.end());
+            std::sort(users.begin(), users.end());
+
+            std::vector<std::uint64_t> signature;
+            signature.reserve(operands.size() + users.size() + 2);
+            signature.push_back(colours[v]);
+            signature.insert(signature.end(), operands.begin(), operands.end());
+            signature.push_back(~std::uint64_t(0)); // separates operands from users
+            signature.insert(signature.end(), users.begin(), users.end());
+            next_colours[v] = signature_ids.emplace(std::move(signature), signature_ids.size()).first->second;
+        }
+
+        colours = std::move(next_colours);
+        if (signature_ids.size() == num_colours) {
+            break; // stable, further rounds won't split any more classes
+        }
+        num_colours = signature_ids.size();
+    }
+    return colours;
+}
+
+std::vector<std::pair<VertexId, VertexId>> propose_repeated_block_ranges(const graph_type& graph, int num_expected_matches) {
+    // Enough rounds to tell blocks near the ends of the stack apart by their neighbourhood, without making every
+    // vertex unique
+    const int refinement_iterations = 3;
+    std::vector<std::uint32_t> colours = get_vertex_colours(graph, refinement_iterations);
+
+    std::unordered_map<std::uint32_t, std::vector<VertexId>> colour_classes;
+    for (auto v : boost::make_iterator_range(vertices(graph))) {
+        if (graph[v].op_type != "*") {
+            colour_classes[colours[v]].push_back(v);
+        }
+    }
+
+    // Vertices repeated exactly once per block. Vertex ids follow topological order and blocks follow each other,
+    // so the k-th vertex of every such class belongs to the k-th block, and the distances between the members of
+    // a class are the same for all of them. Classes that happen to have N members but a different stride (i.e.
+    // two identical ops within one block) are left out.
+    std::map<std::vector<VertexId>, int> stride_counts;
+    std::vector<std::pair<std::vector<VertexId>, const std::vector<VertexId>*>> repeated_classes;
+    for (const auto& [colour, class_vertices] : colour_classes) {
+        if ((int)class_vertices.size() != num_expected_matches) {
+            continue;
+        }
+        std::vector<VertexId> strides;
+        for (std::size_t k = 1; k < class_vertices.size(); ++k) {
+            strides.push_back(class_vertices[k] - class_vertices[k - 1]);
+        }
+        stride_counts[strides]++;
+        repeated_classes.emplace_back(std::move(strides), &class_vertices);
+    }
+
+    std::vector<std::pair<VertexId, VertexId>> ranges;
+    if (repeated_classes.empty()) {
+        return ranges;
+    }
+    const std::vector<VertexId>& block_strides = std::max_element(
+        stride_counts.begin(), stride_counts.end(), [](const auto& a, const auto& b) { return a.second < b.second; })->first;
+
+    std::vector<VertexId> block_start(num_expected_matches, std::numeric_limits<VertexId>::max());
+    std::vector<VertexId> block_end(num_expected_matches, 0);
+    for (const auto& [strides, class_vertices_ptr] : repeated_classes) {
+        if (strides != block_strides) {
+            continue;
+        }
+        const std::vector<VertexId>& class_vertices = *class_vertices_ptr;
+        for (int k = 0; k < num_expected_matches; ++k) {
+            block_start[k] = std::min(block_start[k], class_vertices[k]);
+            block_end[k] = std::max(block_end[k], class_vertices[k]);
+        }
+    }
+
+    // Both the repeated core of each block and its whole period, up to where the next block starts
+    VertexId max_vertices_to_include = (VertexId)get_max_vertices_to_include(graph, num_expected_matches);
+    for (int k = 0; k < num_expected_matches; ++k) {
+        ranges.emplace_back(block_start[k], block_end[k]);
+        if (k + 1 < num_expected_matches and block_start[k + 1] > block_start[k]) {
+            ranges.emplace_back(block_start[k], block_start[k + 1] - 1);
+        }
+    }
+    ranges.erase(
+        std::remove_if(ranges.begin(), ranges.end(), [max_vertices_to_include](const auto& range) {
+            return range.second < range.first or range.second - range.first + 1 > max_vertices_to_include;
+        }),
+        ranges.end());
+
+    std::sort(ranges.begin(), ranges.end(), [](const auto& a, const auto& b) {
+        if ((a.second - a.first) == (b.second - b.first)) {
+            return a.first < b.first;
+        }
+        return (a.second - a.first) > (b.second - b.first);
+    });
+    ranges.erase(std::unique(ranges.begin(), ranges.end()), ranges.end());
+    return ranges;
+}
+
+static bool has_exactly_n_matches(graph_type& graph, VertexId start, VertexId end, int num_expected_matches) {
+    graph_type subgraph_pattern = generate_pattern_subgraph(graph, start, end);
+    return num_subgraph_pattern_matches(subgraph_pattern, graph, num_expected_matches) == num_expected_matches;
+}
+
 bool contains_exactly_n_subgraph_matches(graph_type& graph, int num_expected_matches) {
+    // Any confirmed proposal answers the question, the exhaustive window is only built when none is
+    for (const auto& [start_vertex_id, end_vertex_id] : propose_repeated_block_ranges(graph, num_expected_matches)) {
+        if (has_exactly_n_matches(graph, start_vertex_id, end_vertex_id, num_expected_matches)) {
+            return true;
+        }
+    }
+
     for (const auto& [start_vertex_id, end_vertex_id] : get_subgraph_vertex_start_end_pairs(graph, num_expected_matches)) {
-        graph_type subgraph_pattern = generate_pattern_subgraph(graph, start_vertex_id, end_vertex_id);
-        int matches = num_subgraph_pattern_matches(subgraph_pattern, graph, num_expected_matches);
-        if (matches == num_expected_matches) {
+        if (has_exactly_n_matches(graph, start_vertex_id, end_vertex_id, num_expected_matches)) {
             return true;
         }
     }
@@ -363,10 +505,32 @@ std::vector<NodeId> get_unmatched_node_ids(graph_type& graph, const SubgraphPatt
 graph_type discover_largest_subgraph_pattern(graph_type& graph, int num_expected_matches)
 {
     log_debug(LogPatternMatcher, "discover_largest_subgraph_pattern(num_expected_matches={}).", num_expected_matches);
+
+    // Colour refinement proposes the repeated blocks, VF2 only confirms them. Pattern sizes don't follow the range
+    // sizes exactly, so proposals are ordered by pattern size and the first confirmed one is the final pattern.
+    std::vector<graph_type> proposed_patterns;
+    for (const auto& [start_vertex_id, end_vertex_id] : propose_repeated_block_ranges(graph, num_expected_matches)) {
+        proposed_patterns.push_back(generate_pattern_subgraph(graph, start_vertex_id, end_vertex_id));
+    }
+    std::stable_sort(
+        proposed_patterns.begin(),
+        proposed_patterns.end(),
+        [](const graph_type& a, const graph_type& b) { return boost::num_vertices(a) > boost::num_vertices(b); });
+
+    for (graph_type& subgraph_pattern : proposed_patterns) {
+        if (num_subgraph_pattern_matches(subgraph_pattern, graph, num_expected_matches) == num_expected_matches) {
+            log_debug(LogPatternMatcher, "Found exactly {} matches of proposed repeated block with {} vertices.", num_expected_matches, boost::num_vertices(subgraph_pattern));
+            return subgraph_pattern;
+        }
+    }
+
+    // No proposal confirmed, fall back to the window search
     graph_type best_subgraph_pattern;
     int max_num_subgraph_vertices = 0;
     bool is_subgraph_match_found = false;
 
+    log_debug(LogPatternMatcher, "No proposed repeated block confirmed, searching the window.");
+
     for (const auto& [start_vertex_id, end_vertex_id] : get_subgraph_vertex_start_end_pairs(graph, num_expected_matches)) {
         log_trace(LogPatternMatcher, "start_vertex: {}, end_vertex: {}", start_vertex_id, end_vertex_id);
         graph_type subgraph_pattern = generate_pattern_subgraph(graph, start_vertex_id, end_vertex_id);
@@ -413,11 +577,9 @@ SubgraphPatternMatchMappings subgraph_pattern_match(graph_type& subgraph, graph_
         return subgraph[edge_a].producer_output_edge_index == graph[edge_b].producer_output_edge_index
             and subgraph[edge_a].consumer_input_edge_index == graph[edge_b].consumer_input_edge_index;
     };
-    auto vertex_predicate = [&](auto vertex_a, auto vertex_b) {
-        if (subgraph[vertex_a].op_type == "*") {
-            return true;
-        }
-        return subgraph[vertex_a].op_type == graph[vertex_b].op_type;
+    auto [subgraph_op_types, graph_op_types] = intern_op_types(subgraph, graph);
+    auto vertex_predicate = [&subgraph_op_types = subgraph_op_types, &graph_op_types = graph_op_types](auto vertex_a, auto vertex_b) {
+        return subgraph_op_types[vertex_a] == -1 or subgraph_op_types[vertex_a] == graph_op_types[vertex_b];
     };
 
     boost::vf2_subgraph_iso(
@@ -5,6 +5,8 @@
 
 #include "graph_lib/defines.hpp"
 
+#include <climits>
+#include <cstdint>
 #include <string>
 #include <iostream>
 #include <vector>
@@ -97,9 +99,20 @@ void save_graph_to_file(std::string filename, graph_type& graph);
 graph_type load_graph_from_file(std::string filename);
 
 // Helper query methods
-int num_subgraph_pattern_matches(graph_type& subgraph, graph_type& graph, int num_matches);
+int num_subgraph_pattern_matches(graph_type& subgraph, graph_type& graph, int num_matches = INT_MAX);
 bool contains_exactly_n_subgraph_matches(graph_type& graph, int num_matches);
 
+// Weisfeiler-Lehman colour refinement over op types and edge indices. Vertices share a colour iff their
+// neighbourhoods, up to `iterations` hops, look the same.
+std::vector<std::uint32_t> get_vertex_colours(const graph_type& graph, int iterations);
+
+// Vertex ranges likely to hold one instance of a block repeated `num_expected_matches` times, largest first.
+// Near-linear; candidates still have to be confirmed with VF2.
+std::vector<std::pair<VertexId, VertexId>> propose_repeated_block_ranges(const graph_type& graph, int num_expected_matches);
+
+// Pattern made of the vertices in [start, end] that are connected to another vertex in that range
+graph_type generate_pattern_subgraph(graph_type& graph, VertexId start, VertexId end);
+
 //
 // Main Subgraph Pattern Matcher APIs
 //
@@ -111,7 +124,8 @@ std::vector<NodeId> get_output_node_ids(graph_type& graph, const SubgraphPattern
 std::vector<NodeId> get_unmatched_node_ids(graph_type& graph, const SubgraphPatternMatchMappings& subgraph_matches);
 
 // Given a graph, return the largest discovered subgraph which yields exactly
-// `num_expected_matches` instances in the input `graph`.
+// `num_expected_matches` instances in the input `graph`. The largest confirmed repeated block proposal is returned
+// as-is, the window search only runs if no proposal is confirmed.
 // If subgraph was not discovered, return empty graph.
 graph_type discover_largest_subgraph_pattern(graph_type& graph, int num_expected_matches);
 
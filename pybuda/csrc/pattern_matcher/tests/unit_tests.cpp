@@ -128,3 +128,30 @@ TEST(PatternMatcher, encoders_12_discovery)
     EXPECT_TRUE(pass);
 }
 
+
+TEST(PatternMatcher, encoders_12_proposed_blocks)
+{
+    std::string graph_file_path =
+        std::experimental::filesystem::path(__FILE__).parent_path().string() +
+        "/boost_test_graphs/12encoder_boost_graph.txt";
+    auto large_graph = load_graph_from_file(graph_file_path);
+
+    // Colour refinement alone should find the repeated encoder ops, VF2 only confirms them. The largest proposal
+    // (a whole period of the first block) isn't one of them, the last block has no period after it.
+    auto ranges = propose_repeated_block_ranges(large_graph, 12);
+    ASSERT_FALSE(ranges.empty());
+    std::size_t largest_confirmed = 0;
+    for (auto [start_vertex_id, end_vertex_id] : ranges) {
+        auto pattern = generate_pattern_subgraph(large_graph, start_vertex_id, end_vertex_id);
+        if (num_subgraph_pattern_matches(pattern, large_graph, 12) == 12) {
+            largest_confirmed = std::max(largest_confirmed, num_vertices(pattern));
+        }
+    }
+    EXPECT_GT(largest_confirmed, 0);
+
+    // The largest confirmed proposal is the discovered pattern, no window search needed
+    auto discovered = discover_largest_subgraph_pattern(large_graph, 12);
+    EXPECT_EQ(num_vertices(discovered), largest_confirmed);
+    EXPECT_EQ(num_subgraph_pattern_matches(discovered, large_graph, 12), 12);
+    EXPECT_TRUE(contains_exactly_n_subgraph_matches(large_graph, 12));
+}
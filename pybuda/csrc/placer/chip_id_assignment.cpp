@@ -3,6 +3,11 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "placer/chip_id_assignment.hpp"
 
+#include <algorithm>
+#include <deque>
+#include <limits>
+
+#include "placer/eth_topology.hpp"
 #include "utils/assert.hpp"
 #include "utils/logger.hpp"
 
@@ -79,6 +84,11 @@ unordered_map<string, uint32_t> get_grayskull_fwd_op_to_chip_id_placement(
     return fwd_op_to_chip_id_placement;
 }
 
+static void assign_bwd_and_opt_ops_to_fwd_chip(
+    const ChipPlacerConfig& config,
+    const vector<string>& scheduled_ops,
+    unordered_map<string, uint32_t>& op_to_chip_id_assignment);
+
 unordered_map<string, uint32_t> get_op_to_chip_id_assignment(
     const ChipPlacerConfig& config,
     const vector<string>& scheduled_ops)
@@ -90,7 +100,15 @@ unordered_map<string, uint32_t> get_op_to_chip_id_assignment(
         return {};
     }
     unordered_map<string, uint32_t> op_to_chip_id_assignment = get_grayskull_fwd_op_to_chip_id_placement(config, scheduled_ops);
+    assign_bwd_and_opt_ops_to_fwd_chip(config, scheduled_ops, op_to_chip_id_assignment);
+    return op_to_chip_id_assignment;
+}
 
+static void assign_bwd_and_opt_ops_to_fwd_chip(
+    const ChipPlacerConfig& config,
+    const vector<string>& scheduled_ops,
+    unordered_map<string, uint32_t>& op_to_chip_id_assignment)
+{
     // chip-id assignment for BWD nodes
     for (int i = scheduled_ops.size() - 1; i >= 0; --i)
     {
@@ -131,6 +149,186 @@ unordered_map<string, uint32_t> get_op_to_chip_id_assignment(
             }
         }
     }
+}
+
+vector<uint32_t> get_min_traffic_chip_order(
+    const EthLinkTopology& topology,
+    const vector<uint32_t>& chip_ids,
+    const vector<int>& chips_with_mmio)
+{
+    auto is_mmio = [&chips_with_mmio](uint32_t chip_id)
+    { return std::find(chips_with_mmio.begin(), chips_with_mmio.end(), (int)chip_id) != chips_with_mmio.end(); };
+
+    vector<uint32_t> mmio_last = chip_ids;
+    std::stable_partition(mmio_last.begin(), mmio_last.end(), [&is_mmio](uint32_t chip_id) { return not is_mmio(chip_id); });
+    if (topology.empty() or mmio_last.size() <= 1)
+        return mmio_last;
+
+    // Walk outwards from the last mmio chip and reverse, so the pipeline ends next to the host
+    vector<uint32_t> order = topology.chain_order(vector<uint32_t>(mmio_last.rbegin(), mmio_last.rend()));
+    std::reverse(order.begin(), order.end());
+    std::stable_partition(order.begin(), order.end(), [&is_mmio](uint32_t chip_id) { return not is_mmio(chip_id); });
+    return order;
+}
+
+OpToChipIdAssignment get_min_traffic_op_to_chip_id_assignment(
+    const ChipPlacerConfig& config,
+    const vector<string>& scheduled_ops,
+    const ChipTrafficModel& traffic,
+    const EthLinkTopology& topology)
+{
+    TT_ASSERT(not config.chip_ids.empty());
+    constexpr std::uint64_t INF = std::numeric_limits<std::uint64_t>::max();
+
+    vector<string> fwd_ops;
+    unordered_map<string, int> fwd_op_index;
+    for (const string& op_name : scheduled_ops)
+    {
+        if (config.op_to_epoch_type.at(op_name) != NodeEpochType::Forward)
+            continue;
+        fwd_op_index[op_name] = fwd_ops.size();
+        fwd_ops.push_back(op_name);
+    }
+    const int num_ops = fwd_ops.size();
+    const int num_chips = config.chip_ids.size();
+
+    // A cut at position p puts fwd_ops[0, p) on earlier chips and fwd_ops[p, num_ops) on later ones.
+    // cut_bytes[p] = bytes crossing the cut at p, an edge skipping chips crosses (and pays for) every cut in between.
+    vector<std::uint64_t> cut_bytes(num_ops + 1, 0);
+    {
+        vector<std::int64_t> delta(num_ops + 2, 0);
+        for (const auto& [ops, bytes] : traffic.op_to_op_bytes)
+        {
+            auto producer = fwd_op_index.find(ops.first);
+            auto consumer = fwd_op_index.find(ops.second);
+            if (producer == fwd_op_index.end() or consumer == fwd_op_index.end())
+                continue;
+            int first = std::min(producer->second, consumer->second) + 1;
+            int last = std::max(producer->second, consumer->second);
+            delta[first] += bytes;
+            delta[last + 1] -= bytes;
+        }
+        std::int64_t running = 0;
+        for (int p = 0; p <= num_ops; p++)
+        {
+            running += delta[p];
+            cut_bytes[p] = running;
+        }
+    }
+
+    vector<std::uint64_t> cycles_prefix(num_ops + 1, 0);
+    std::uint64_t max_op_cycles = 0;
+    for (int i = 0; i < num_ops; i++)
+    {
+        auto it = traffic.op_cycles.find(fwd_ops[i]);
+        std::uint64_t cycles = it != traffic.op_cycles.end() ? it->second : 0;
+        cycles_prefix[i + 1] = cycles_prefix[i] + cycles;
+        max_op_cycles = std::max(max_op_cycles, cycles);
+    }
+
+    // Cost of the cut after chip k, a chip pair that isn't directly connected pays for every hop
+    vector<std::uint64_t> cut_hops(num_chips, 1);
+    for (int k = 0; k + 1 < num_chips; k++)
+    {
+        uint32_t chip_a = config.chip_ids[k];
+        uint32_t chip_b = config.chip_ids[k + 1];
+        if (topology.contains(chip_a) and topology.contains(chip_b) and not topology.route(chip_a, chip_b).empty())
+            cut_hops[k] = topology.num_hops(chip_a, chip_b);
+    }
+
+    // Fractured ops pin the cuts around them: the cut after chip k has to be past every op pinned to chips <= k,
+    // and before every op pinned to chips > k
+    vector<int> cut_lo(num_chips, 0);
+    vector<int> cut_hi(num_chips, num_ops);
+    for (const auto& [op_name, chip_id] : config.fracture_chip_id_assignments)
+    {
+        auto op = fwd_op_index.find(op_name);
+        if (op == fwd_op_index.end())
+            continue;
+        auto chip = std::find(config.chip_ids.begin(), config.chip_ids.end(), (uint32_t)chip_id);
+        TT_ASSERT(chip != config.chip_ids.end(), "Fractured op assigned to a chip that isn't available", op_name, chip_id);
+        int k = chip - config.chip_ids.begin();
+        for (int j = k; j < num_chips; j++) cut_lo[j] = std::max(cut_lo[j], op->second + 1);
+        for (int j = 0; j < k; j++) cut_hi[j] = std::min(cut_hi[j], op->second);
+    }
+    for (int k = 0; k < num_chips; k++)
+        TT_ASSERT(cut_lo[k] <= cut_hi[k], "Fractured op chip assignments don't follow the schedule order");
+
+    // cost[k][p] = cheapest split of fwd_ops[0, p) over chips 0..k, with the cut after chip k at p.
+    // Windows of valid previous cuts only move forward with p, so each row is a sliding window minimum.
+    auto split = [&](std::uint64_t max_chip_cycles, vector<int>& cuts) -> bool
+    {
+        vector<vector<std::uint64_t>> cost(num_chips, vector<std::uint64_t>(num_ops + 1, INF));
+        vector<vector<int>> prev_cut(num_chips, vector<int>(num_ops + 1, -1));
+        for (int p = cut_lo[0]; p <= cut_hi[0]; p++)
+            if (cycles_prefix[p] <= max_chip_cycles)
+                cost[0][p] = 0;
+
+        for (int k = 1; k < num_chips; k++)
+        {
+            std::deque<int> window;
+            int next_q = 0;
+            int first_q = 0;
+            for (int p = cut_lo[k]; p <= cut_hi[k]; p++)
+            {
+                for (; next_q <= p; next_q++)
+                {
+                    if (cost[k - 1][next_q] == INF)
+                        continue;
+                    std::uint64_t c = cost[k - 1][next_q] + cut_bytes[next_q] * cut_hops[k - 1];
+                    while (not window.empty() and
+                           cost[k - 1][window.back()] + cut_bytes[window.back()] * cut_hops[k - 1] >= c)
+                        window.pop_back();
+                    window.push_back(next_q);
+                }
+                while (cycles_prefix[p] - cycles_prefix[first_q] > max_chip_cycles) first_q++;
+                while (not window.empty() and window.front() < first_q) window.pop_front();
+                if (window.empty())
+                    continue;
+
+                int q = window.front();
+                cost[k][p] = cost[k - 1][q] + cut_bytes[q] * cut_hops[k - 1];
+                prev_cut[k][p] = q;
+            }
+        }
+
+        if (cost[num_chips - 1][num_ops] == INF)
+            return false;
+
+        cuts.assign(num_chips, num_ops);
+        for (int k = num_chips - 1; k > 0; k--) cuts[k - 1] = prev_cut[k][cuts[k]];
+        return true;
+    };
+
+    // Relax the balance constraint until the pinned ops fit, the last attempt is unconstrained
+    int imbalance_percent = env_as<int>("PYBUDA_MIN_TRAFFIC_CHIP_IMBALANCE", 10);
+    std::uint64_t average_chip_cycles = (cycles_prefix[num_ops] + num_chips - 1) / num_chips;
+    vector<int> cuts;
+    bool found = false;
+    for (int attempt = 0; attempt < 8 and not found; attempt++, imbalance_percent *= 2)
+    {
+        std::uint64_t max_chip_cycles =
+            std::max(max_op_cycles, average_chip_cycles + average_chip_cycles * imbalance_percent / 100);
+        found = split(max_chip_cycles, cuts);
+    }
+    if (not found)
+        found = split(INF, cuts);
+    TT_ASSERT(found);
+
+    OpToChipIdAssignment op_to_chip_id_assignment;
+    for (int k = 0, first = 0; k < num_chips; first = cuts[k++])
+    {
+        for (int i = first; i < cuts[k]; i++) op_to_chip_id_assignment[fwd_ops[i]] = config.chip_ids[k];
+        log_debug(
+            LogPlacer,
+            "Min-traffic chip placement: chip {} gets {} ops, {} cycles, {} bytes to the next chip",
+            config.chip_ids[k],
+            cuts[k] - first,
+            cycles_prefix[cuts[k]] - cycles_prefix[first],
+            k + 1 < num_chips ? cut_bytes[cuts[k]] : 0);
+    }
+
+    assign_bwd_and_opt_ops_to_fwd_chip(config, scheduled_ops, op_to_chip_id_assignment);
     return op_to_chip_id_assignment;
 }
 
@@ -7,6 +7,28 @@
 
 namespace tt::placer {
 
+class EthLinkTopology;
+
+enum class ChipPlacementPolicy
+{
+    MMIO_LAST = 0,   // use chip id order as given by the user, use mmio chips last
+    SNAKE = 1,       // sort chip ids in a snake pattern
+    MIN_TRAFFIC = 2, // chain chips along ethernet links, split the schedule to minimize traffic between chips
+};
+
+inline ChipPlacementPolicy chip_placement_policy_from_string(std::string const& s)
+{
+    if (s == "MMIO_LAST") {
+        return ChipPlacementPolicy::MMIO_LAST;
+    } else if (s == "SNAKE") {
+        return ChipPlacementPolicy::SNAKE;
+    } else if (s == "MIN_TRAFFIC") {
+        return ChipPlacementPolicy::MIN_TRAFFIC;
+    }
+    TT_ASSERT(false);
+    return ChipPlacementPolicy::MMIO_LAST;
+}
+
 struct ChipPlacerConfig
 {
     // Arch config
@@ -34,21 +56,31 @@ unordered_map<string, uint32_t> get_op_to_chip_id_assignment(
     const ChipPlacerConfig& config,
     const vector<string>& scheduled_ops);
 
-enum class ChipPlacementPolicy
+// Estimated cost of the scheduled ops, used to split them across chips
+struct ChipTrafficModel
 {
-    MMIO_LAST = 0, // use chip id order as given by the user, use mmio chips last
-    SNAKE = 1,     // sort chip ids in a snake pattern
+    // compute cycles of each op, ops without an entry are free
+    unordered_map<string, std::uint64_t> op_cycles;
+    // (producer op, consumer op) -> bytes the producer sends to the consumer per input
+    map<std::pair<string, string>, std::uint64_t> op_to_op_bytes;
 };
 
-inline ChipPlacementPolicy chip_placement_policy_from_string(std::string const& s)
-{
-    if (s == "MMIO_LAST") {
-        return ChipPlacementPolicy::MMIO_LAST;
-    } else if (s == "SNAKE") {
-        return ChipPlacementPolicy::SNAKE;
-    }
-    TT_ASSERT(false);
-    return ChipPlacementPolicy::MMIO_LAST;
-}
+// Chip order for ChipPlacementPolicy::MIN_TRAFFIC: a walk along the ethernet links, so that consecutive pipeline
+// stages land on adjacent chips, ending on an mmio chip. Falls back to MMIO_LAST order without a topology.
+vector<uint32_t> get_min_traffic_chip_order(
+    const EthLinkTopology& topology,
+    const vector<uint32_t>& chip_ids,
+    const vector<int>& chips_with_mmio);
+
+// Splits the forward ops into one contiguous range of the schedule per chip of config.chip_ids (in pipeline order),
+// minimizing the bytes crossing chip boundaries weighted by the hops between the chips, while keeping the compute
+// cycles of each chip within PYBUDA_MIN_TRAFFIC_CHIP_IMBALANCE percent (default 10) of the average.
+// Ops in config.fracture_chip_id_assignments stay on their chips. Backward and optimizer ops follow their forward op.
+OpToChipIdAssignment get_min_traffic_op_to_chip_id_assignment(
+    const ChipPlacerConfig& config,
+    const vector<string>& scheduled_ops,
+    const ChipTrafficModel& traffic,
+    const EthLinkTopology& topology);
+
 
 } // namespace tt::placer
@@ -590,6 +590,7 @@ void place_dram_queues(
         placer_solution.name_to_queue_placement[val].read_only = true;
         placer_solution.name_to_queue_placement[key].chip_id = placer_solution.name_to_queue_placement[val].chip_id;
     }
+    placer_solution.invalidate_node_placements();
     log_epoch_to_epoch_queue_info(graph, placer_solution);
 }
 
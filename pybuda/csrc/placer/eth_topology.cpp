@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "placer/eth_topology.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+
+#include "backend_api/device_config.hpp"
+#include "utils/assert.hpp"
+
+namespace tt::placer
+{
+
+EthLinkTopology::EthLinkTopology(DeviceConfig const &device_config) :
+    EthLinkTopology(device_config.chip_to_chip_connections)
+{
+}
+
+EthLinkTopology::EthLinkTopology(
+    std::map<ChipId, std::map<ChipId, std::set<std::uint32_t>>> const &chip_to_chip_connections)
+{
+    for (auto const &[chip_a, connections] : chip_to_chip_connections)
+    {
+        for (auto const &[chip_b, channels] : connections)
+        {
+            if (chip_a == chip_b or channels.empty())
+                continue;
+
+            // Links are bidirectional, the descriptor may list a connection from one side only
+            int num_links = std::max<int>(channels.size(), links[chip_b][chip_a]);
+            links[chip_a][chip_b] = num_links;
+            links[chip_b][chip_a] = num_links;
+        }
+    }
+    compute_routes();
+}
+
+void EthLinkTopology::compute_routes()
+{
+    // BFS from every destination, neighbours are visited in chip id order so the lowest chip id wins ties
+    for (auto const &[dst, _] : links)
+    {
+        std::deque<ChipId> to_visit = {dst};
+        next_hop[dst][dst] = dst;
+        while (not to_visit.empty())
+        {
+            ChipId chip = to_visit.front();
+            to_visit.pop_front();
+            for (auto const &[neighbour, num_links] : links.at(chip))
+            {
+                if (next_hop[neighbour].count(dst) > 0)
+                    continue;
+                next_hop[neighbour][dst] = chip;
+                to_visit.push_back(neighbour);
+            }
+        }
+    }
+}
+
+int EthLinkTopology::num_links(ChipId chip_a, ChipId chip_b) const
+{
+    auto connections = links.find(chip_a);
+    if (connections == links.end())
+        return 0;
+    auto link = connections->second.find(chip_b);
+    return link == connections->second.end() ? 0 : link->second;
+}
+
+std::vector<EthLinkTopology::ChipId> EthLinkTopology::route(ChipId src, ChipId dst) const
+{
+    auto hops = next_hop.find(src);
+    if (hops == next_hop.end() or hops->second.count(dst) == 0)
+        return {};
+
+    std::vector<ChipId> chips = {src};
+    while (chips.back() != dst)
+    {
+        chips.push_back(next_hop.at(chips.back()).at(dst));
+        TT_ASSERT(chips.size() <= links.size(), "Routing loop between chips", src, dst);
+    }
+    return chips;
+}
+
+int EthLinkTopology::num_hops(ChipId src, ChipId dst) const
+{
+    std::vector<ChipId> chips = route(src, dst);
+    TT_ASSERT(not chips.empty(), "No ethernet route between chips", src, dst);
+    return chips.size() - 1;
+}
+
+std::vector<EthLinkTopology::ChipId> EthLinkTopology::chain_order(std::vector<ChipId> const &chip_ids) const
+{
+    if (chip_ids.empty() or
+        not std::all_of(chip_ids.begin(), chip_ids.end(), [this](ChipId chip) { return contains(chip); }))
+        return chip_ids;
+
+    // Greedy walk, always moving to the closest remaining chip, preferring more links and then the given order
+    std::vector<ChipId> order = {chip_ids.front()};
+    std::vector<ChipId> remaining(chip_ids.begin() + 1, chip_ids.end());
+    while (not remaining.empty())
+    {
+        ChipId current = order.back();
+        auto closest = remaining.end();
+        int closest_hops = std::numeric_limits<int>::max();
+        int closest_links = 0;
+        for (auto it = remaining.begin(); it != remaining.end(); ++it)
+        {
+            std::vector<ChipId> chips = route(current, *it);
+            int hops = chips.empty() ? std::numeric_limits<int>::max() : static_cast<int>(chips.size()) - 1;
+            int first_hop_links = chips.empty() ? 0 : num_links(current, chips[1]);
+            if (hops < closest_hops or (hops == closest_hops and first_hop_links > closest_links))
+            {
+                closest = it;
+                closest_hops = hops;
+                closest_links = first_hop_links;
+            }
+        }
+        if (closest == remaining.end())
+            closest = remaining.begin();  // disconnected, keep the given order
+        order.push_back(*closest);
+        remaining.erase(closest);
+    }
+    return order;
+}
+
+}  // namespace tt::placer
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace tt
+{
+struct DeviceConfig;
+}
+
+namespace tt::placer
+{
+
+//
+// Ethernet link topology of the cluster the device config was created for. Built from the ethernet connections of
+// the cluster descriptor, so it's empty for single-chip and non-silicon configs without one.
+//
+// Gives the number of links between adjacent chips, and the shortest (fewest hops) route between any two chips.
+// Among equally short routes the one through the lowest chip ids is picked, so routes are deterministic.
+//
+class EthLinkTopology
+{
+   public:
+    using ChipId = std::uint32_t;
+
+    EthLinkTopology() = default;
+    EthLinkTopology(DeviceConfig const &device_config);
+    // chip_to_chip_connections[chip_a][chip_b] = ethernet channels on chip_a connected to chip_b
+    EthLinkTopology(std::map<ChipId, std::map<ChipId, std::set<std::uint32_t>>> const &chip_to_chip_connections);
+
+    bool empty() const { return links.empty(); }
+    bool contains(ChipId chip) const { return links.find(chip) != links.end(); }
+
+    // Number of links directly connecting the two chips, 0 if they are not adjacent
+    int num_links(ChipId chip_a, ChipId chip_b) const;
+
+    // Chips on the route from src to dst, including both, empty if dst can't be reached
+    std::vector<ChipId> route(ChipId src, ChipId dst) const;
+    int num_hops(ChipId src, ChipId dst) const;
+
+    // Orders the chips so that consecutive chips are as close as possible, starting from the first one
+    std::vector<ChipId> chain_order(std::vector<ChipId> const &chip_ids) const;
+
+   private:
+    std::map<ChipId, std::map<ChipId, int>> links;
+    // next_hop[src][dst] = the chip after src on the route to dst
+    std::map<ChipId, std::map<ChipId, ChipId>> next_hop;
+
+    void compute_routes();
+};
+
+}  // namespace tt::placer
@@ -11,6 +11,7 @@
 #include "utils/logger.hpp"
 #include "utils/assert.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include <set>
@@ -22,141 +23,144 @@ using tt::LogPlacer;
 namespace tt {
 namespace placer {
 
-namespace device_grid
+DeviceGrid::DeviceGrid(uint32_t rows, uint32_t columns) : rows_(rows), columns_(columns), occupied_rows_(rows, 0)
 {
-DeviceGrid create_empty_device_grid(uint32_t rows, uint32_t columns)
+    TT_LOG_ASSERT(columns <= MAX_COLUMNS, "Device grid has {} columns, more than fit in a row mask", columns);
+}
+
+DeviceGrid::RowMask DeviceGrid::span_mask(uint32_t start, uint32_t size) const
 {
-    return vector<vector<uint32_t>>(rows, vector<uint32_t>(columns, 0));
+    RowMask mask = size >= MAX_COLUMNS ? ~RowMask(0) : ((RowMask(1) << size) - 1);
+    return start >= MAX_COLUMNS ? 0 : mask << start;
 }
-DeviceGrid superposition(const DeviceGrid& a, const DeviceGrid& b)
+
+bool DeviceGrid::is_occupied(uint32_t row, uint32_t column) const
 {
-    const uint32_t a_rows = a.size();
-    const uint32_t a_cols = a.at(0).size(); 
-    const uint32_t b_rows = a.size();
-    const uint32_t b_cols = a.at(0).size(); 
-    TT_ASSERT(a_rows == b_rows);
-    TT_ASSERT(a_cols == b_cols);
-
-    DeviceGrid new_device_grid = create_empty_device_grid(a_rows, a_cols);
-    for (uint32_t i = 0; i < a_rows; ++i) {
-        for (uint32_t j = 0; j < a_cols; ++j) {
-            if (a[i][j])
-            {
-                new_device_grid[i][j] = a[i][j];
-            }
-            else if (b[i][j])
-            {
-                new_device_grid[i][j] = b[i][j];
-            }
-            else
-            {
-                new_device_grid[i][j] = 0;
-            }
-        }
-    }
-    return new_device_grid;
+    TT_ASSERT(row < rows_ and column < columns_);
+    return (occupied_rows_[row] >> column) & 1;
 }
 
-bool can_place_on_device_grid(const DeviceGrid& device_grid, const Coord& start, const GridShape& shape)
+bool DeviceGrid::is_free() const
 {
-    const uint32_t available_rows_on_grid = device_grid.size();
-    const uint32_t available_columns_on_grid = device_grid.at(0).size(); 
+    return std::all_of(occupied_rows_.begin(), occupied_rows_.end(), [](RowMask row) { return row == 0; });
+}
 
-    if (start.row + shape.rows > available_rows_on_grid)
-    {
-        return false;
-    }
-    else if (start.col + shape.columns > available_columns_on_grid)
+bool DeviceGrid::is_free(const Coord& start, const GridShape& shape) const
+{
+    if (start.row + shape.rows > rows_ or start.col + shape.columns > columns_)
     {
         return false;
     }
 
-    for (uint32_t i = start.row; i < start.row + shape.rows; ++i) {
-        for (uint32_t j = start.col; j < start.col + shape.columns; ++j) {
-            if (device_grid.at(i).at(j) != 0) {
-                return false;
-            }
+    RowMask span = span_mask(start.col, shape.columns);
+    for (uint32_t i = start.row; i < start.row + shape.rows; ++i)
+    {
+        if (occupied_rows_[i] & span)
+        {
+            return false;
         }
     }
     return true;
 }
 
-bool contains_empty_device_grid(const DeviceGrid& device_grid)
+void DeviceGrid::occupy(const Coord& start, const GridShape& shape)
 {
-    if (device_grid.empty())
+    TT_ASSERT(start.row + shape.rows <= rows_ and start.col + shape.columns <= columns_);
+    RowMask span = span_mask(start.col, shape.columns);
+    for (uint32_t i = start.row; i < start.row + shape.rows; ++i)
     {
-        return true;
+        occupied_rows_[i] |= span;
     }
-    if (device_grid[0].empty())
+}
+
+std::optional<Coord> DeviceGrid::first_fit(const GridShape& shape) const
+{
+    if (empty() or shape.rows > rows_ or shape.columns > columns_)
     {
-        return true;
+        return std::nullopt;
+    }
+    if (shape.rows == 0 or shape.columns == 0)
+    {
+        return Coord{.row = 0, .col = 0};
     }
 
-    for (uint32_t i = 0; i < device_grid.size(); ++i) {
-        for (uint32_t j = 0; j < device_grid.at(0).size(); ++j) {
-            if (device_grid[i][j] != 0) {
-                return false;
-            }
+    const RowMask all_columns = span_mask(0, columns_);
+    for (uint32_t i = 0; i + shape.rows <= rows_; ++i)
+    {
+        RowMask occupied = 0;
+        for (uint32_t op_i = i; op_i < i + shape.rows; ++op_i)
+        {
+            occupied |= occupied_rows_[op_i];
+        }
+
+        // Bit j stays set only if columns [j, j + shape.columns) are free in all of the rows
+        RowMask free = ~occupied & all_columns;
+        RowMask fits = free;
+        for (uint32_t op_j = 1; op_j < shape.columns and fits; ++op_j)
+        {
+            fits &= free >> op_j;
+        }
+
+        if (fits)
+        {
+            return Coord{.row = i, .col = (uint32_t)__builtin_ctzll(fits)};
         }
     }
-    return true;
+    return std::nullopt;
 }
 
-void fill_device_grid_with_placement(DeviceGrid& device_grid, const Coord& op_start, const GridShape& op_grid_shape)
-{ 
-    for (uint32_t i = op_start.row; i < op_start.row + op_grid_shape.rows; ++i) {
-        for (uint32_t j = op_start.col; j < op_start.col + op_grid_shape.columns; ++j) {
-            device_grid.at(i).at(j) = 1;
-        }
+DeviceGrid& DeviceGrid::operator|=(const DeviceGrid& other)
+{
+    TT_ASSERT(rows_ == other.rows_);
+    TT_ASSERT(columns_ == other.columns_);
+    for (uint32_t i = 0; i < rows_; ++i)
+    {
+        occupied_rows_[i] |= other.occupied_rows_[i];
     }
+    return *this;
+}
+
+namespace device_grid
+{
+DeviceGrid create_empty_device_grid(uint32_t rows, uint32_t columns)
+{
+    return DeviceGrid(rows, columns);
+}
+DeviceGrid superposition(const DeviceGrid& a, const DeviceGrid& b)
+{
+    DeviceGrid new_device_grid = a;
+    new_device_grid |= b;
+    return new_device_grid;
+}
+
+bool can_place_on_device_grid(const DeviceGrid& device_grid, const Coord& start, const GridShape& shape)
+{
+    return device_grid.is_free(start, shape);
+}
+
+bool contains_empty_device_grid(const DeviceGrid& device_grid)
+{
+    return device_grid.empty() or device_grid.is_free();
+}
+
+void fill_device_grid_with_placement(DeviceGrid& device_grid, const Coord& op_start, const GridShape& op_grid_shape)
+{
+    device_grid.occupy(op_start, op_grid_shape);
 }
 
 void print_device_grid(const DeviceGrid& device_grid)
 { 
-    for (uint32_t i = 0; i < device_grid.size(); ++i) {
-        for (uint32_t j = 0; j < device_grid.at(0).size(); ++j) {
-            std::cout << " " << device_grid.at(i).at(j);
+    for (uint32_t i = 0; i < device_grid.rows(); ++i) {
+        for (uint32_t j = 0; j < device_grid.columns(); ++j) {
+            std::cout << " " << device_grid.is_occupied(i, j);
         }
         std::cout << std::endl;
     }
 }
-std::optional<Coord> get_first_free_location(const DeviceGrid& device_grid, const GridShape& op_grid_shape)
-{
-    const uint32_t rows = device_grid.size();
-    const uint32_t columns = device_grid.at(0).size(); 
-    for (uint32_t i = 0; i < rows; ++i)
-    { 
-        for (uint32_t j = 0; j < columns; ++j)
-        { 
-            if (i + op_grid_shape.rows > rows or j + op_grid_shape.columns > columns)
-            {
-                continue;
-            } 
-             
-            bool is_valid = true;
-            for (uint32_t op_i = i; op_i < i + op_grid_shape.rows; ++ op_i)
-            {
-                for (uint32_t op_j = j; op_j < j + op_grid_shape.columns; ++ op_j)
-                {
-                    if (device_grid[op_i][op_j] != 0)
-                    { 
-                        is_valid = false;  
-                        break;
-                    }
-                }
-            }
-            if (is_valid)
-            {  
-                return Coord{.row = i, .col = j};
-            }
-        } 
-    }
-    return std::nullopt;
-}
 
 std::optional<Coord> get_next_grid_coordinate(const DeviceGrid& device_grid, const GridShape& op_grid_shape)
 {
-    return get_first_free_location(device_grid, op_grid_shape);
+    return device_grid.first_fit(op_grid_shape);
 }
 } // namespace device_grid
 
@@ -179,8 +183,8 @@ uint32_t get_active_placement_row_height(const DeviceGrid& device_grid, const st
         return 0;
     }
 
-    const uint32_t device_grid_rows = device_grid.size(); 
-    const uint32_t device_grid_columns = device_grid[0].size();
+    const uint32_t device_grid_rows = device_grid.rows();
+    const uint32_t device_grid_columns = device_grid.columns();
     bool device_R_larger_than_C = (device_grid_rows > device_grid_columns);
     uint32_t row_height = 0; 
     uint32_t i = candidate.value().row;
@@ -188,11 +192,11 @@ uint32_t get_active_placement_row_height(const DeviceGrid& device_grid, const st
     
     for (int op_j = j-1; i+row_height < device_grid_rows && op_j >= 0; --op_j) 
     {
-        if(device_grid[i+row_height][op_j] != 0)
+        if(device_grid.is_occupied(i+row_height, op_j))
         { 
             for (uint32_t op_i = i+row_height; op_i < device_grid_rows; ++op_i) 
             {
-                if (device_grid[op_i][op_j] == 0) 
+                if (not device_grid.is_occupied(op_i, op_j)) 
                 {
                     break;
                 }
@@ -248,8 +252,8 @@ bool should_try_auto_transpose_op(
     const bool enable_auto_transposing, 
     const bool manually_transpose_this_op)
 {
-    const uint32_t device_grid_r = device_grid.size();
-    const uint32_t device_grid_c = device_grid[0].size();
+    const uint32_t device_grid_r = device_grid.rows();
+    const uint32_t device_grid_c = device_grid.columns();
     bool is_transposable = op_grid_shape.columns <= device_grid_r and op_grid_shape.rows <= device_grid_c;
     TT_LOG_ASSERT((not manually_transpose_this_op) or (manually_transpose_this_op and is_transposable), 
                   "Manually passed op is not transposable, op-grid-shape: {}x{}, device-grid: {}x{}", 
@@ -394,7 +398,7 @@ std::tuple<vector<DeviceGridPlacement>, Coord> place_on_grid_helper(
         starting_coordinate = Coord{.row=0, .col=0};
     }
 
-    auto e_copy = EpochIdToDeviceGrid(device_grid.size(), device_grid.at(0).size());
+    auto e_copy = EpochIdToDeviceGrid(device_grid.rows(), device_grid.columns());
     e_copy.initialize_device_grid(current_epoch_id, device_grid);
     e_copy.add_constraints(constraints);
 
@@ -9,10 +9,6 @@
 
 namespace tt::placer {
 
-// In the future, refactor this into a class..
-// if DeviceGrid[i][j] == 0, then we consider the core at location (i,j) to be free/available
-using DeviceGrid = vector<vector<uint32_t>>;
-
 // Functions on Device Grid
 namespace device_grid
 {
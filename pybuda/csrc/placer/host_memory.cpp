@@ -196,6 +196,7 @@ void place_host_queues(
                     balancer_solution)));
         }
     }
+    placer_solution.invalidate_node_placements();
 }
 
 }  // namespace tt::placer
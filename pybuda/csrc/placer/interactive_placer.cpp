@@ -16,8 +16,9 @@ namespace tt::placer
 {
 
 InteractivePlacer::InteractivePlacer(const graphlib::Graph *graph, const balancer::BalancerConfig &config) :
-    valid(true), config(config)
+    graph(graph), valid(true), config(config)
 {
+    TT_ASSERT(graph != nullptr, "Interactive placer needs the graph of the ops it places");
     epoch_id_to_device_grid.rows = config.device_config.grid_size.r;  // TODO: get harvested rows
     epoch_id_to_device_grid.columns = config.device_config.grid_size.c;
     chips_with_mmio = std::unordered_set<ChipId>(
@@ -48,9 +49,9 @@ InteractivePlacer::InteractivePlacer(const graphlib::Graph *graph, const balance
 
     log_debug(tt::LogPlacer, "sorted_chip_ids: {}", sorted_chip_ids);
 
-    if (graph)
+    for (const std::string &output_op : placer::lowering::get_output_nodes(graph))
     {
-        output_ops = placer::lowering::get_output_nodes(graph);
+        output_ops.insert(graph->get_node_by_name(output_op)->id());
     }
 
     current_epoch_index = 0;
@@ -171,9 +172,10 @@ void InteractivePlacer::next_chip_id(bool start_temporal_epoch, bool new_tempora
 }
 
 // returns true if the op can be placed on current_chip_id
-bool InteractivePlacer::can_place_op_onto_chip(const std::string &op_name, bool chip_break, std::vector<ChipId>& requested_chip_ids)
+bool InteractivePlacer::can_place_op_onto_chip(const graphlib::Node *op, bool chip_break, std::vector<ChipId>& requested_chip_ids)
 {
-    bool output_op = config.output_queues_on_host && output_ops.find(op_name) != output_ops.end();
+    const std::string &op_name = op->name();
+    bool output_op = config.output_queues_on_host && output_ops.find(op->id()) != output_ops.end();
     if (output_op)
     {
         log_debug(tt::LogPlacer, "epoch {} contains output_op: {}", current_epoch_index, op_name);
@@ -187,11 +189,11 @@ bool InteractivePlacer::can_place_op_onto_chip(const std::string &op_name, bool
     bool skip_due_to_output_op = output_op && is_current_chip_id_mmio == false;
     // skip a spatial epoch if a chip break is requested
     bool skip_due_to_chip_break = chip_break && placed_ops_in_current_epoch.size() &&
-                                  visited_ops_in_current_epoch.find(op_name) == visited_ops_in_current_epoch.end();
+                                  visited_ops_in_current_epoch.find(op->id()) == visited_ops_in_current_epoch.end();
+    auto op_override = config.op_name_to_placer_overrides.find(op_name);
     ChipId override_chip_id =
-        config.op_name_to_placer_overrides.find(op_name) != config.op_name_to_placer_overrides.end() &&
-                config.op_name_to_placer_overrides.at(op_name).chip_id.has_value()
-            ? config.op_name_to_placer_overrides.at(op_name).chip_id.value()
+        op_override != config.op_name_to_placer_overrides.end() && op_override->second.chip_id.has_value()
+            ? op_override->second.chip_id.value()
             : INVALID_CHIP_ID;
     // skip if op has a chip id override which is not current_chip_id
     bool skip_due_to_chip_id_override = override_chip_id != INVALID_CHIP_ID && override_chip_id != current_chip_id;
@@ -207,7 +209,7 @@ bool InteractivePlacer::can_place_op_onto_chip(const std::string &op_name, bool
     bool skip_due_to_epoch_break_for_output_op =
         env_as<bool>("PYBUDA_NEBULA_GALAXY_PLACER") && env_as<bool>("PYBUDA_WORMHOLE_PIPELINED_PLACER") && output_op &&
         placed_ops_in_current_epoch.size() &&
-        visited_ops_in_current_epoch.find(op_name) == visited_ops_in_current_epoch.end();
+        visited_ops_in_current_epoch.find(op->id()) == visited_ops_in_current_epoch.end();
 
     // request a chip id from the chip_id assignment for the next epoch
     if(skip_due_to_chip_id_override) {
@@ -277,16 +279,17 @@ void InteractivePlacer::init_epoch(bool start_temporal_epoch, bool new_temporal_
 
 // Place single op on current epoch. Returns nullopt if it doesn't fit.
 std::optional<placer::CoordRange> InteractivePlacer::place_op(
-    const std::string &op_name, const balancer::GridShape &shape, bool enable_transpose, bool chip_break)
+    const graphlib::Node *op, const balancer::GridShape &shape, bool enable_transpose, bool chip_break)
 {
     return place_op(
-        op_name, placer::GridShape({(std::uint32_t)shape.r, (std::uint32_t)shape.c}), enable_transpose, chip_break);
+        op, placer::GridShape({(std::uint32_t)shape.r, (std::uint32_t)shape.c}), enable_transpose, chip_break);
 }
 
 std::optional<placer::CoordRange> InteractivePlacer::place_op(
-    const std::string &op_name, const placer::GridShape &shape, bool enable_transpose, bool chip_break)
+    const graphlib::Node *op, const placer::GridShape &shape, bool enable_transpose, bool chip_break)
 {
     TT_ASSERT(valid);
+    const std::string &op_name = op->name();
     std::unordered_map<std::string, placer::GridShape> to_place;
     to_place[op_name] = shape;
 
@@ -295,7 +298,7 @@ std::optional<placer::CoordRange> InteractivePlacer::place_op(
         "Interactive placer start for op {}, grid ({}, {})", op_name, shape.rows, shape.columns);
 
     std::optional<placer::DeviceGridPlacement> placement = place_one_op(
-        op_name,
+        op,
         config.enable_auto_transposing_placement && enable_transpose,
         chip_break,
         to_place);
@@ -307,7 +310,8 @@ std::optional<placer::CoordRange> InteractivePlacer::place_op(
     }
 
     // Placed, update structures
-    placed_ops_in_current_epoch.push_back(op_name);
+    placed_ops_in_current_epoch.push_back(op);
+    placed_op_ids.insert(op->id());
 
     auto device_grid_placement = placement.value();
     OpPlacement op_placement = OpPlacement{
@@ -344,7 +348,7 @@ std::optional<placer::CoordRange> InteractivePlacer::place_op(
 }
 
 std::optional<placer::DeviceGridPlacement> InteractivePlacer::place_one_op(
-    const std::string &op_name, bool enable_transpose, bool chip_break, const std::unordered_map<std::string, placer::GridShape>& to_place)
+    const graphlib::Node *op, bool enable_transpose, bool chip_break, const std::unordered_map<std::string, placer::GridShape>& to_place)
 {
     std::optional<placer::DeviceGridPlacement> placement;
 
@@ -354,10 +358,10 @@ std::optional<placer::DeviceGridPlacement> InteractivePlacer::place_one_op(
     while (!placement.has_value())
     {
         std::vector<ChipId> requested_chip_ids;
-        if (can_place_op_onto_chip(op_name, chip_break, requested_chip_ids))
+        if (can_place_op_onto_chip(op, chip_break, requested_chip_ids))
         {
             placement = placer::place_one_op(
-                op_name,
+                op->name(),
                 to_place,
                 epoch_id_to_device_grid.get_device_grid(current_epoch_index),
                 config.op_name_to_placer_overrides,
@@ -377,7 +381,7 @@ std::optional<placer::DeviceGridPlacement> InteractivePlacer::place_one_op(
 
             // for whatever reason, we did not place this op on this spatial epoch, no need to consider it for chip
             // break again
-            visited_ops_in_current_epoch.insert(op_name);
+            visited_ops_in_current_epoch.insert(op->id());
 
             // initialize the next spatial epoch within the current temporal epoch (with a new chip id) and try again
             current_spatial_epoch_id++;
@@ -410,7 +414,7 @@ std::optional<placer::DeviceGridPlacement> InteractivePlacer::place_one_op(
         // Also Nebula is not necessarily the mmio chip when we have more than one nebula chips
         TT_ASSERT(
             env_as<bool>("PYBUDA_NEBULA_GALAXY_PLACER") == false || config.output_queues_on_host == false ||
-            output_ops.find(op_name) == output_ops.end() || placement.has_value() == false ||
+            output_ops.find(op->id()) == output_ops.end() || placement.has_value() == false ||
             placement.value().placed_cores.end.row <= 8);
     }
 
@@ -421,31 +425,33 @@ std::optional<placer::DeviceGridPlacement> InteractivePlacer::place_one_op(
 // Row dimension must match.
 //
 std::optional<placer::CoordRange> InteractivePlacer::place_two_ops_rowwise(
-    const std::string &op_name_1,
+    const graphlib::Node *op_1,
     const balancer::GridShape &shape_1,
-    const std::string &op_name_2,
+    const graphlib::Node *op_2,
     const balancer::GridShape &shape_2,
     bool enable_transpose,
     bool chip_break)
 {
     return place_two_ops_rowwise(
-        op_name_1,
+        op_1,
         placer::GridShape((std::uint32_t)shape_1.r, (std::uint32_t)shape_1.c),
-        op_name_2,
+        op_2,
         placer::GridShape((std::uint32_t)shape_2.r, (std::uint32_t)shape_2.c),
         enable_transpose,
         chip_break);
 }
 
 std::optional<placer::CoordRange> InteractivePlacer::place_two_ops_rowwise(
-    const std::string &op_name_1,
+    const graphlib::Node *op_1,
     const placer::GridShape &shape_1,
-    const std::string &op_name_2,
+    const graphlib::Node *op_2,
     const placer::GridShape &shape_2,
     bool enable_transpose,
     bool chip_break)
 {
     TT_ASSERT(valid);
+    const std::string &op_name_1 = op_1->name();
+    const std::string &op_name_2 = op_2->name();
     TT_ASSERT(shape_1.rows == shape_2.rows);
     std::unordered_map<std::string, placer::GridShape> to_place;
     to_place[op_name_1] =
@@ -453,7 +459,7 @@ std::optional<placer::CoordRange> InteractivePlacer::place_two_ops_rowwise(
     TT_ASSERT(can_fit_on_single_epoch(to_place[op_name_1].rows, to_place[op_name_1].columns, enable_transpose));
 
     std::optional<placer::DeviceGridPlacement> placement = place_one_op(
-        op_name_1,
+        op_1,
         config.enable_auto_transposing_placement && enable_transpose,
         chip_break,
         to_place);
@@ -468,7 +474,8 @@ std::optional<placer::CoordRange> InteractivePlacer::place_two_ops_rowwise(
     // Calculate grid bounds of both ops and uptate the structures accordingly.
     // First OP needs to have grid end updated, second OP needs to have grid start updated.
     //
-    placed_ops_in_current_epoch.push_back(op_name_1);
+    placed_ops_in_current_epoch.push_back(op_1);
+    placed_op_ids.insert(op_1->id());
 
     auto device_grid_placement = placement.value();
     auto device_grid_placement_1 = device_grid_placement;
@@ -519,7 +526,8 @@ std::optional<placer::CoordRange> InteractivePlacer::place_two_ops_rowwise(
     auto device_grid_placement_2 = device_grid_placement;
     device_grid_placement_2.placed_cores.start.row = device_grid_placement.placed_cores.end.row - op_shape_2.rows;
     device_grid_placement_2.placed_cores.start.col = device_grid_placement.placed_cores.end.col - op_shape_2.columns;
-    placed_ops_in_current_epoch.push_back(op_name_2);
+    placed_ops_in_current_epoch.push_back(op_2);
+    placed_op_ids.insert(op_2->id());
 
     OpPlacement op_placement_2 = OpPlacement{
         .id = 0,
@@ -562,19 +570,20 @@ std::uint32_t InteractivePlacer::next_epoch(graphlib::NodeEpochType epoch_type)
 }
 
 // Clear current epoch and start over. Returns the list of ops that were undone, in placed order.
-std::vector<std::pair<std::string, OpPlacement>> InteractivePlacer::rewind_epoch_logged()
+std::vector<std::pair<const graphlib::Node *, OpPlacement>> InteractivePlacer::rewind_epoch_logged()
 {
-    std::vector<std::pair<std::string, OpPlacement>> ret;
+    std::vector<std::pair<const graphlib::Node *, OpPlacement>> ret;
 
     log_debug(tt::LogPlacer, "InteractivePlacer::rewind_epoch");
 
-    for (const std::string &name : placed_ops_in_current_epoch)
+    for (const graphlib::Node *op : placed_ops_in_current_epoch)
     {
-        const OpPlacement &p = name_to_op_placement.at(name);
-        log_trace(LogPlacer, "Unplacing: {}", name);
+        const OpPlacement &p = name_to_op_placement.at(op->name());
+        log_trace(LogPlacer, "Unplacing: {}", op->name());
 
-        ret.push_back(std::make_pair(name, p));
-        name_to_op_placement.erase(name);
+        ret.push_back(std::make_pair(op, p));
+        name_to_op_placement.erase(op->name());
+        placed_op_ids.erase(op->id());
     }
 
     // rewind back to the first spatial epoch in the temporal epoch
@@ -589,9 +598,10 @@ std::vector<std::pair<std::string, OpPlacement>> InteractivePlacer::rewind_epoch
 //
 void InteractivePlacer::rewind_epoch()
 {
-    for (const std::string &name : placed_ops_in_current_epoch)
+    for (const graphlib::Node *op : placed_ops_in_current_epoch)
     {
-        name_to_op_placement.erase(name);
+        name_to_op_placement.erase(op->name());
+        placed_op_ids.erase(op->id());
     }
 
     // rewind back to the first spatial epoch in the temporal epoch
@@ -603,25 +613,26 @@ void InteractivePlacer::rewind_epoch()
 
 // Rewind current epoch to given op - i.e. place everything up to it, but not it. Returns the name
 // and shape of the last placed op.
-std::pair<std::string, OpPlacement> InteractivePlacer::rewind_to(const std::string &op_name)
+std::pair<const graphlib::Node *, OpPlacement> InteractivePlacer::rewind_to(const graphlib::Node *op)
 {
-    std::pair<std::string, OpPlacement> last;
-    last.first = "";
+    std::pair<const graphlib::Node *, OpPlacement> last;
+    last.first = nullptr;
 
-    log_trace(LogPlacer, "Rewind to: {}", op_name);
+    log_trace(LogPlacer, "Rewind to: {}", op->name());
     auto rew = rewind_epoch_logged();
 
     for (const auto &p : rew)
     {
-        if (p.first == op_name)
+        if (p.first == op)
             return last;
 
-        log_trace(LogPlacer, "Replacing: {}", p.first);
+        const std::string &op_name = p.first->name();
+        log_trace(LogPlacer, "Replacing: {}", op_name);
 
         std::unordered_map<std::string, tt::placer::PlacerOpOverride>::iterator existing_override;
         std::unordered_map<std::string, tt::placer::PlacerOpOverride>::iterator rewind_override;
         std::optional<tt::placer::PlacerOpOverride> user_override = std::nullopt;
-        existing_override = get_op_overrides().find(p.first);
+        existing_override = get_op_overrides().find(op_name);
         if (existing_override != get_op_overrides().end())
         {
             // Save the user override, if any, so we can restore it after rewinding the op.
@@ -632,7 +643,7 @@ std::pair<std::string, OpPlacement> InteractivePlacer::rewind_to(const std::stri
 
         bool rewind_override_set;
         std::tie(rewind_override, rewind_override_set) = get_op_overrides().emplace(
-            p.first,
+            op_name,
             tt::placer::PlacerOpOverride(p.second.placed_cores.start, p.second.grid_transpose, p.second.chip_id));
         TT_ASSERT(rewind_override_set);
 
@@ -647,12 +658,12 @@ std::pair<std::string, OpPlacement> InteractivePlacer::rewind_to(const std::stri
         get_op_overrides().erase(rewind_override);
         if (user_override.has_value())
         {
-            get_op_overrides().emplace(p.first, user_override.value());
+            get_op_overrides().emplace(op_name, user_override.value());
         }
 
         // Re-placing in same order, on the same epoch, same grid start and size -> it should always fit.
         //
-        TT_LOG_ASSERT(pl.has_value(), "Failed to re-place {} after rewinding.", p.first);
+        TT_LOG_ASSERT(pl.has_value(), "Failed to re-place {} after rewinding.", op_name);
         last = p;
     }
 
@@ -723,7 +734,9 @@ void InteractivePlacer::assign_chip_ids_for_pipelined_placement(
                 can_place_epoch_onto_chip =
                     can_place_epoch_onto_chip &&
                     can_place_op_onto_chip(
-                        placement.name, chip_break_ops.value().find(placement.name) != chip_break_ops.value().end(), requested_chip_ids);
+                        graph->get_node_by_name(placement.name),
+                        chip_break_ops.value().find(placement.name) != chip_break_ops.value().end(),
+                        requested_chip_ids);
                 if (!can_place_epoch_onto_chip)
                     break;
             }
@@ -755,7 +768,7 @@ void InteractivePlacer::assign_chip_ids_for_pipelined_placement(
                 // so we do not insert chip breaks for the first op on the chip
                 for (auto &placement : epoch_id_to_op_placement[epoch_index])
                 {
-                    placed_ops_in_current_epoch.push_back(placement.name);
+                    placed_ops_in_current_epoch.push_back(graph->get_node_by_name(placement.name));
                 }
 
                 num_epochs_placed_on_chip++;
@@ -785,7 +798,7 @@ void InteractivePlacer::assign_chip_ids_for_pipelined_placement(
             // so we insert exactly one chip break on the op
             for (auto &placement : epoch_id_to_op_placement[epoch_index])
             {
-                visited_ops_in_current_epoch.insert(placement.name);
+                visited_ops_in_current_epoch.insert(graph->get_node_by_name(placement.name)->id());
             }
 
             // moving to next chip after successfull placement
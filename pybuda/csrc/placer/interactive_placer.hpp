@@ -11,6 +11,7 @@
 #include "placer/grid_placer.hpp"
 
 // Interactive placer provides APIs for placing individual ops, reverting epochs back, checkpointing, etc.
+// Ops are passed as graph nodes, and per-op bookkeeping is keyed by node id.
 
 namespace tt
 {
@@ -20,6 +21,7 @@ namespace placer
 class InteractivePlacer
 {
    private:
+    const graphlib::Graph *graph;
     std::uint32_t current_epoch_index;  // global id of the current spatial epoch
     NodeEpochType current_epoch_type;
     bool valid;
@@ -35,17 +37,18 @@ class InteractivePlacer
 
     balancer::BalancerConfig config;
     unordered_map<string, OpPlacement> name_to_op_placement;
+    std::unordered_set<graphlib::NodeId> placed_op_ids;  // ops in name_to_op_placement
     map<PlacerSolution::EpochId, int> epoch_id_to_chip;
     map<PlacerSolution::EpochId, unsigned int> epoch_id_to_subgraph_index;
     unordered_map<int, vector<OpPlacement>> epoch_id_to_op_placement;
     EpochIdToDeviceGrid epoch_id_to_device_grid;
     unordered_map<int, EpochInfo> epoch_id_to_epoch_info;
-    std::vector<std::string> placed_ops_in_current_epoch;  // ordered list
-    std::set<std::string> visited_ops_in_current_epoch;
-    std::unordered_set<std::string> output_ops;
+    std::vector<const graphlib::Node *> placed_ops_in_current_epoch;  // ordered list
+    std::unordered_set<graphlib::NodeId> visited_ops_in_current_epoch;
+    std::unordered_set<graphlib::NodeId> output_ops;
 
     // returns true if the op can be placed on current_chip_id
-    bool can_place_op_onto_chip(const std::string &op_name, bool chip_break, std::vector<ChipId>& requested_chip_ids);
+    bool can_place_op_onto_chip(const graphlib::Node *op, bool chip_break, std::vector<ChipId>& requested_chip_ids);
 
     // utility function for picking a chip id for the epoch
     void next_chip_id(bool start_temporal_epoch, bool new_temporal_epoch, std::optional<std::vector<ChipId>> requested_chip_ids);
@@ -58,7 +61,7 @@ class InteractivePlacer
     void init_epoch(bool start_temporal_epoch = true, bool new_temporal_epoch = true, std::optional<std::vector<ChipId>> requested_chip_ids = std::nullopt);
 
     std::optional<placer::DeviceGridPlacement> place_one_op(
-        const std::string &op_name,
+        const graphlib::Node *op,
         bool enable_transpose,
         bool chip_break,
         const std::unordered_map<std::string, placer::GridShape>& to_place);
@@ -68,27 +71,27 @@ class InteractivePlacer
 
     // Place single op on current epoch. Returns nullopt if it doesn't fit.
     std::optional<placer::CoordRange> place_op(
-        const std::string &op_name,
+        const graphlib::Node *op,
         const placer::GridShape &shape,
         bool enable_transpose = false,
         bool chip_break = false);
     std::optional<placer::CoordRange> place_op(
-        const std::string &op_name,
+        const graphlib::Node *op,
         const balancer::GridShape &shape,
         bool enable_transpose = false,
         bool chip_break = false);
 
     std::optional<placer::CoordRange> place_two_ops_rowwise(
-        const std::string &op_name_1,
+        const graphlib::Node *op_1,
         const balancer::GridShape &shape_1,
-        const std::string &op_name_2,
+        const graphlib::Node *op_2,
         const balancer::GridShape &shape_2,
         bool enable_transpose = false,
         bool chip_break = false);
     std::optional<placer::CoordRange> place_two_ops_rowwise(
-        const std::string &op_name_1,
+        const graphlib::Node *op_1,
         const placer::GridShape &shape_1,
-        const std::string &op_name_2,
+        const graphlib::Node *op_2,
         const placer::GridShape &shape_2,
         bool enable_transpose = false,
         bool chip_break = false);
@@ -97,7 +100,7 @@ class InteractivePlacer
     std::uint32_t next_epoch(graphlib::NodeEpochType epoch_type);
 
     // Clear current epoch and start over. Returns the list of ops that were undone, in placed order.
-    std::vector<std::pair<std::string, OpPlacement>> rewind_epoch_logged();
+    std::vector<std::pair<const graphlib::Node *, OpPlacement>> rewind_epoch_logged();
 
     // Clear current epoch and start over. Non-logged fast version.
     //
@@ -106,14 +109,14 @@ class InteractivePlacer
     // Rewind current epoch to given op - i.e. place everything up to it, but not it.
     // Returns placement information about last placed op.
     //
-    std::pair<std::string, OpPlacement> rewind_to(const std::string &op_name);
+    std::pair<const graphlib::Node *, OpPlacement> rewind_to(const graphlib::Node *op);
 
     std::uint32_t get_current_epoch_index() const { return current_epoch_index; }
     bool current_epoch_empty() const { return placed_ops_in_current_epoch.empty(); }
     int current_epoch_size() const { return placed_ops_in_current_epoch.size(); }
-    std::vector<std::string> const &current_epoch_ops() const { return placed_ops_in_current_epoch; }
+    std::vector<const graphlib::Node *> const &current_epoch_ops() const { return placed_ops_in_current_epoch; }
 
-    bool op_placed(const std::string &op_name) const { return name_to_op_placement.count(op_name) > 0; }
+    bool op_placed(const graphlib::Node *op) const { return placed_op_ids.count(op->id()) > 0; }
 
     void insert_empty_graphs(std::uint32_t spatial_epoch_id, std::uint32_t temporal_epoch_id);
 
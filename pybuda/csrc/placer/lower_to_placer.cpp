@@ -11,6 +11,7 @@
 #include "graph_lib/graph.hpp"
 #include "graph_lib/node.hpp"
 #include "graph_lib/utils.hpp"
+#include "lower_to_buda/common.hpp"
 #include "scheduler/utils.hpp"
 #include "utils/assert.hpp"
 #include "utils/logger.hpp"
@@ -249,6 +250,34 @@ unordered_set<string> get_output_nodes(const graphlib::Graph *graph)
     return output_ops;
 }
 
+ChipTrafficModel get_chip_traffic_model(graphlib::Graph const* graph, const vector<string>& scheduled_ops)
+{
+    // Grids aren't picked yet, so cycles are estimated as tile operations: output tiles times inner dim tiles for
+    // matmuls, times the number of operands for everything else
+    ChipTrafficModel traffic;
+    unordered_set<string> scheduled(scheduled_ops.begin(), scheduled_ops.end());
+    for (const string& op_name : scheduled_ops)
+    {
+        Node* node = graph->get_node_by_name(op_name);
+        auto op = node->as<graphlib::OpNode>();
+        std::uint64_t output_tiles = (std::uint64_t)node->shape().z() * node->shape().rt() * node->shape().ct();
+
+        vector<Node*> operands = graph->data_operands(node);
+        std::uint64_t tiles_per_output = operands.size();
+        if (op->is_dense_matmul() and not operands.empty())
+            tiles_per_output = operands[0]->shape().ct();
+        traffic.op_cycles[op_name] = output_tiles * std::max<std::uint64_t>(tiles_per_output, 1);
+
+        std::uint64_t output_bytes = data_format_byte_size(node->output_df(), node->shape().volume());
+        for (Node* user : graph->data_users(node))
+        {
+            if (scheduled.find(user->name()) != scheduled.end())
+                traffic.op_to_op_bytes[{op_name, user->name()}] = output_bytes;
+        }
+    }
+    return traffic;
+}
+
 vector<string> generate_placer_schedule(tt_graph const* graph, PlacementScheduleOrder) {
     vector<string> scheduled_nodes;
     for (tt_node* node : tt::graphlib::topological_sort(*graph))
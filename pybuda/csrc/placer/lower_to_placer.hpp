@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
+#include "placer/chip_id_assignment.hpp"
 #include "placer/placer.hpp"
 #include "placer/lowering_utils.hpp"
 
@@ -40,6 +41,7 @@ get_op_to_grad_op_mapping(graphlib::Graph const* graph, const vector<string>& sc
 unordered_map<string, bool>
 get_op_to_recompute_mapping(graphlib::Graph const* graph, const vector<string>& scheduled_ops);
 unordered_set<string> get_output_nodes(const graphlib::Graph *graph);
+ChipTrafficModel get_chip_traffic_model(graphlib::Graph const* graph, const vector<string>& scheduled_ops);
 
 // Returns an ordered list of node names
 vector<string> generate_placer_schedule(graphlib::Graph const* graph, PlacementScheduleOrder schedule_type);
@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "placer/chip_id_assignment.hpp"
+#include "placer/eth_topology.hpp"
 #include "scheduler/scheduler.hpp"
 #include "utils/assert.hpp"
 #include "utils/logger.hpp"
@@ -97,6 +98,11 @@ vector<std::uint32_t> apply_chip_placement_policy(
         return sorted_chip_ids;
     }
 
+    if(chip_placement_policy == ChipPlacementPolicy::MIN_TRAFFIC)
+    {
+        return get_min_traffic_chip_order(EthLinkTopology(config), chip_ids, config.chips_with_mmio);
+    }
+
     // get chip id order based on the ChipPlacementPolicy
     std::map<ChipId, std::uint32_t> galaxy_chip_id_indices =
         chip_placement_policy == ChipPlacementPolicy::SNAKE ? get_galaxy_snake_chip_order(config) :
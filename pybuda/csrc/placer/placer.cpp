@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "placer/placer.hpp"
 #include "placer/utils.hpp"
+#include "placer/eth_topology.hpp"
 #include "placer/lowering_utils.hpp"
 #include "placer/dram.hpp"
 #include "placer/grid_placer.hpp"
@@ -285,11 +286,61 @@ uint32_t PlacerSolution::num_temporal_epochs(NodeEpochType type) const
     return temporal_epoch_ids.size();
 }
     
+const NodePlacements& PlacerSolution::node_placements(const graphlib::Graph* graph) const
+{
+    if (cached_node_placements == nullptr or cached_node_placements->graph() != graph)
+        cached_node_placements = std::make_shared<const NodePlacements>(graph, *this);
+    return *cached_node_placements;
+}
+
+NodePlacements::NodePlacements(const graphlib::Graph* graph, const PlacerSolution& placer_solution) : graph_(graph)
+{
+    placements.reserve(placer_solution.name_to_op_placement.size());
+    for (const auto& [name, op_placement] : placer_solution.name_to_op_placement)
+    {
+        if (not graph->has_node_with_name(name))
+            continue;
+        auto epoch_info = placer_solution.epoch_id_to_epoch_info.find(op_placement.global_epoch_id);
+        placements.emplace(
+            graph->get_node_by_name(name)->id(),
+            Placement{
+                .chip_id = op_placement.chip_id,
+                .global_epoch_id = op_placement.global_epoch_id,
+                .temporal_epoch_id = epoch_info != placer_solution.epoch_id_to_epoch_info.end()
+                                         ? std::optional<uint32_t>(epoch_info->second.temporal_epoch_id)
+                                         : std::nullopt});
+    }
+    for (const auto& [name, queue_placement] : placer_solution.name_to_queue_placement)
+    {
+        if (graph->has_node_with_name(name))
+            queue_chip_ids.emplace(graph->get_node_by_name(name)->id(), queue_placement.chip_id);
+    }
+}
+
+uint32_t NodePlacements::chip_id(const graphlib::Node* node) const
+{
+    if (auto it = placements.find(node->id()); it != placements.end())
+        return it->second.chip_id;
+    if (auto it = queue_chip_ids.find(node->id()); it != queue_chip_ids.end())
+        return it->second;
+    TT_LOG_ASSERT(false, "Error: NodePlacements::chip_id() invoked with unassigned op/queue: {}", node->name());
+    return 0;
+}
+
+uint32_t NodePlacements::temporal_epoch_id(const graphlib::Node* node) const
+{
+    const Placement& placement = placements.at(node->id());
+    if (not placement.temporal_epoch_id.has_value())
+        throw std::out_of_range("No epoch info for epoch " + std::to_string(placement.global_epoch_id));
+    return placement.temporal_epoch_id.value();
+}
+
 // Merge another placer solution into this one. Destroys the original!
 // Assumes that the 'other' contains new stand-alone epochs, this will likely not work 
 // for partial epoch merging.
 void PlacerSolution::merge(PlacerSolution &other)
 {
+    invalidate_node_placements();
     TT_ASSERT(is_pipelined == other.is_pipelined, "Incompatible placer solutions for merging (pipelined).");
     TT_ASSERT(epoch_id_to_device_grid.rows == other.epoch_id_to_device_grid.rows, 
             "Incompatible placer solutions for merging (grid rows).");
@@ -333,7 +384,7 @@ std::optional<Coord> EpochIdToDeviceGrid::get_next_grid_coordinate(const std::st
     {
         if (op_name != constraint_name)
         {
-            device_grid = device_grid::superposition(device_grid, constraint_grid);
+            device_grid |= constraint_grid;
         }
     }
 
@@ -394,19 +445,6 @@ void fill_in_device_grid(
     }
 }
 
-void fill_device_grid_with_placement(
-    DeviceGrid& device_grid_for_epoch,
-    const Coord& op_start,
-    const GridShape& op_grid_shape)
-{
-    for (uint32_t i = op_start.row; i < op_start.row + op_grid_shape.rows; ++i) {
-        for (uint32_t j = op_start.col; j < op_start.col + op_grid_shape.columns; ++j) {
-            device_grid_for_epoch.at(i).at(j) = 1;
-        }
-    }
-}
-
-
 void EpochIdToDeviceGrid::fill_device_grid_with_placement(
     int epoch_id,
     const Coord& op_start,
@@ -1196,6 +1234,9 @@ PlacerSolution galaxy_placer(const PlacerConfig &config, const std::vector<std::
     std::uint32_t current_epoch_id = 0;
     std::uint32_t current_temporal_epoch_id = 0;
 
+    // Consecutive spatial epochs go to consecutive chips, walk the chips so that those are connected to each other
+    std::vector<std::uint32_t> chip_ids = EthLinkTopology(config.device_config).chain_order(config.chip_ids);
+
     for (auto &type : std::vector<std::string>{"fwd", "rcmp", "bwd", "grad", "opt"})
     {
         if (op_megagroup[type].size() == 0)
@@ -1210,10 +1251,10 @@ PlacerSolution galaxy_placer(const PlacerConfig &config, const std::vector<std::
         current_epoch_id += chip_solution.num_epochs;
 
         // Everything's placed on one chip, but we need to split across available chips
-        std::uint32_t current_chip_index = chip_direction ? 0 : config.chip_ids.size() - 1;
+        std::uint32_t current_chip_index = chip_direction ? 0 : chip_ids.size() - 1;
         for (std::uint32_t epoch = starting_epoch_id; epoch < current_epoch_id; epoch++)
         {
-            std::uint32_t current_chip_id = config.chip_ids[current_chip_index];
+            std::uint32_t current_chip_id = chip_ids[current_chip_index];
             for (auto &placement : chip_solution.epoch_id_to_op_placement.at(epoch))
                 placement.chip_id = current_chip_id;
 
@@ -1240,7 +1281,7 @@ PlacerSolution galaxy_placer(const PlacerConfig &config, const std::vector<std::
             epoch_id_to_epoch_info[epoch] = EpochInfo{
                 .global_epoch_id = (uint32_t)epoch,
                 .temporal_epoch_id = (uint32_t)current_temporal_epoch_id,
-                .spatial_epoch_id = (uint32_t)(current_spatial_epoch_id % config.chip_ids.size()),
+                .spatial_epoch_id = (uint32_t)(current_spatial_epoch_id % chip_ids.size()),
                 .epoch_type = epoch_type
             };
 
@@ -1251,13 +1292,13 @@ PlacerSolution galaxy_placer(const PlacerConfig &config, const std::vector<std::
 
                 if (chip_direction) {
                     current_chip_index++;
-                    wrap = (current_chip_index >= config.chip_ids.size());
+                    wrap = (current_chip_index >= chip_ids.size());
                 } else {
                     wrap = (current_chip_index == 0);
                     if (!wrap) current_chip_index--;
                 }
                 if (wrap) {
-                    current_chip_index = chip_direction ? 0 : config.chip_ids.size() - 1;
+                    current_chip_index = chip_direction ? 0 : chip_ids.size() - 1;
                     current_spatial_epoch_id = 0;
                     current_temporal_epoch_id ++;
                 }
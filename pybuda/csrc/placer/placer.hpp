@@ -4,6 +4,7 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
@@ -210,13 +211,18 @@ struct PlacerConfigUpdate
     vector<vector<string>> op_names_to_chip_break;
     vector<vector<string>> op_names_to_epoch_break;
 
+    // Chip breaks given by the user, op_names_to_chip_break adds the ones placed by the chip placement policy
+    vector<vector<string>> user_op_names_to_chip_break;
+
     PlacerConfigUpdate(
         const unordered_map<string, uint32_t>& op_to_chip_id_assignment,
         const vector<vector<string>>& op_names_to_chip_break,
-        const vector<vector<string>>& op_names_to_epoch_break) :
+        const vector<vector<string>>& op_names_to_epoch_break,
+        const vector<vector<string>>& user_op_names_to_chip_break) :
         op_to_chip_id_assignment(op_to_chip_id_assignment),
         op_names_to_chip_break(op_names_to_chip_break),
-        op_names_to_epoch_break(op_names_to_epoch_break)
+        op_names_to_epoch_break(op_names_to_epoch_break),
+        user_op_names_to_chip_break(user_op_names_to_chip_break)
     {
     }
 };
@@ -331,8 +337,43 @@ struct QueuePlacement
     json to_json() const;
 };
 
+// Occupancy of the cores of one epoch. Each row is a bitmask of its occupied cores, so rectangle checks and
+// first-fit searches take a handful of word operations per row, instead of visiting every core.
+class DeviceGrid
+{
+   public:
+    static constexpr uint32_t MAX_COLUMNS = 64;
+
+    DeviceGrid() = default;
+    DeviceGrid(uint32_t rows, uint32_t columns);
+
+    uint32_t rows() const { return rows_; }
+    uint32_t columns() const { return columns_; }
+    bool empty() const { return rows_ == 0 or columns_ == 0; }
+
+    bool is_occupied(uint32_t row, uint32_t column) const;
+    bool is_free() const;
+    // The rectangle fits on the grid and none of its cores are occupied
+    bool is_free(const Coord& start, const GridShape& shape) const;
+    void occupy(const Coord& start, const GridShape& shape);
+
+    // Row-major first location where the rectangle is free
+    std::optional<Coord> first_fit(const GridShape& shape) const;
+
+    // Occupied in either of the grids
+    DeviceGrid& operator|=(const DeviceGrid& other);
+
+   private:
+    using RowMask = std::uint64_t;
+
+    uint32_t rows_ = 0;
+    uint32_t columns_ = 0;
+    vector<RowMask> occupied_rows_;
+
+    RowMask span_mask(uint32_t start, uint32_t size) const;
+};
+
 // The final returned struct out of the Placer module will have fully populated attributes
-using DeviceGrid = vector<vector<uint32_t>>;
 
 struct EpochIdToDeviceGrid
 {
@@ -358,6 +399,9 @@ struct EpochIdToDeviceGrid
 
     void add_constraints(const std::unordered_map<std::string, DeviceGrid>& constraints);
 };
+
+class NodePlacements;
+
 struct PlacerSolution
 {
     using EpochId = int;
@@ -394,6 +438,38 @@ struct PlacerSolution
     void merge(PlacerSolution &other);
     bool is_placed(const std::string& op_name) const;
 
+    // Placements keyed by node id, built from the maps above on the first call and reused by the passes after it.
+    // Passes editing the placements afterwards call invalidate_node_placements().
+    const NodePlacements& node_placements(const graphlib::Graph* graph) const;
+    void invalidate_node_placements() const { cached_node_placements.reset(); }
+
+    mutable std::shared_ptr<const NodePlacements> cached_node_placements;
+};
+
+// Placement of each placed op (and chip of each placed queue) keyed by node id instead of op name, for passes that
+// look placements up for every edge of the graph. Snapshot of the solution at construction time, get it through
+// PlacerSolution::node_placements; lookups of unplaced nodes throw std::out_of_range, same as the name-keyed maps.
+class NodePlacements
+{
+   public:
+    NodePlacements(const graphlib::Graph* graph, const PlacerSolution& placer_solution);
+
+    const graphlib::Graph* graph() const { return graph_; }
+    bool is_placed(const graphlib::Node* node) const { return placements.find(node->id()) != placements.end(); }
+    uint32_t chip_id(const graphlib::Node* node) const;
+    uint32_t epoch_id(const graphlib::Node* node) const { return placements.at(node->id()).global_epoch_id; }
+    uint32_t temporal_epoch_id(const graphlib::Node* node) const;
+
+   private:
+    struct Placement
+    {
+        uint32_t chip_id;
+        uint32_t global_epoch_id;
+        std::optional<uint32_t> temporal_epoch_id;  // not set if the epoch has no epoch info
+    };
+    const graphlib::Graph* graph_;
+    unordered_map<graphlib::NodeId, Placement> placements;
+    unordered_map<graphlib::NodeId, uint32_t> queue_chip_ids;
 };
 
 /*
@@ -61,7 +61,8 @@ void PlacerModule(py::module &m_placer) {
     py::class_<placer::PlacerConfigUpdate>(m_placer, "PlacerConfigUpdate")
         .def_readonly("op_to_chip_id_assignment", &placer::PlacerConfigUpdate::op_to_chip_id_assignment)
         .def_readonly("op_names_to_chip_break", &placer::PlacerConfigUpdate::op_names_to_chip_break)
-        .def_readonly("op_names_to_epoch_break", &placer::PlacerConfigUpdate::op_names_to_epoch_break);
+        .def_readonly("op_names_to_epoch_break", &placer::PlacerConfigUpdate::op_names_to_epoch_break)
+        .def_readonly("user_op_names_to_chip_break", &placer::PlacerConfigUpdate::user_op_names_to_chip_break);
 
     using OpOverrideTypes = std::variant<bool, std::optional<uint32_t>, std::optional<std::array<uint32_t, 2>>>;
     py::class_<placer::PlacerOpOverride>(m_placer, "OpOverride")
@@ -5,9 +5,11 @@
 
 #include "graph_lib/defines.hpp"
 #include "placer/placer.hpp"
+#include "placer/grid_placer.hpp"
 #include "placer/lowering_utils.hpp"
 #include "placer/best_fit_allocator.hpp"
 #include "placer/chip_id_assignment.hpp"
+#include "placer/eth_topology.hpp"
 #include "test/common.hpp"
 
 #include "third_party/json/json.hpp"
@@ -220,6 +222,80 @@ TEST(Placer, test_multichip_fwd)
     EXPECT_EQ(solution.num_epochs, 2);
 }
 
+TEST(Placer, node_placements_match_name_lookups)
+{
+    vector<string> scheduled_ops = {
+        "matmul0",
+        "matmul1",
+        "matmul2",
+    };
+
+    unordered_map<string, GridShape> op_to_grid_shape = {
+        {"matmul0", GridShape(10, 6)},
+        {"matmul1", GridShape(10, 6)},
+        {"matmul2", GridShape(10, 6)},
+    };
+
+    ChipPlacerConfig chip_placer_config = {
+        .chip_ids = std::vector<std::uint32_t>{0, 1},
+        .arch_name = "grayskull",
+        .op_to_epoch_type = test::map_ops_to_forward_epoch(scheduled_ops),
+        .ops_tagged_for_chip_id_break = {"matmul2"},
+        .ops_tagged_for_epoch_break = {},
+        .fwd_to_bwd_nodes = {},
+        .fwd_to_opt_nodes = {},
+    };
+    OpToChipIdAssignment op_to_chip_id_assignment = get_op_to_chip_id_assignment(chip_placer_config, scheduled_ops);
+
+    tt::DeviceConfig device_config = tt::test::create_device_config();
+    PlacerConfig placer_config = {
+        .chip_ids = std::vector<std::uint32_t>{0, 1},
+        .device_config = device_config,
+        .device_grid = {10, 12},
+        .op_to_grid_shape = op_to_grid_shape,
+        .op_to_epoch_type = test::map_ops_to_forward_epoch(scheduled_ops),
+        .ops_tagged_for_chip_id_break = {"matmul2"},
+        .ops_tagged_for_epoch_break = {},
+        .fwd_to_bwd_nodes = {},
+        .fwd_to_opt_nodes = {},
+        .op_to_chip_id_assignment = op_to_chip_id_assignment,
+    };
+    PlacerSolution solution = placer(placer_config, scheduled_ops);
+    solution.name_to_queue_placement.emplace("e2e_queue", QueuePlacement{.name = "e2e_queue", .chip_id = 1});
+
+    // Placed ops, a placed queue and an op the solution doesn't know about
+    tt::graphlib::Graph graph(tt::graphlib::IRLevel::IR_BUDA);
+    for (const string& op : scheduled_ops)
+        graph.add_node(tt::graphlib::create_node<tt::graphlib::BudaOpNode>(op, "matmul"), 0 /*subgraph_id*/);
+    graph.add_node(tt::graphlib::create_node<tt::graphlib::EpochToEpochQueueNode>("e2e_queue", false, true), 0);
+    graph.add_node(tt::graphlib::create_node<tt::graphlib::BudaOpNode>("unplaced", "nop"), 0);
+
+    const NodePlacements& node_placements = solution.node_placements(&graph);
+    for (const string& op : scheduled_ops)
+    {
+        tt::graphlib::Node* node = graph.get_node_by_name(op);
+        ASSERT_TRUE(node_placements.is_placed(node));
+        EXPECT_EQ(node_placements.chip_id(node), solution.chip_id(op));
+        EXPECT_EQ(node_placements.epoch_id(node), solution.epoch_id(op));
+        EXPECT_EQ(node_placements.temporal_epoch_id(node), solution.temporal_epoch_id(op));
+    }
+    EXPECT_NE(node_placements.chip_id(graph.get_node_by_name("matmul0")), node_placements.chip_id(graph.get_node_by_name("matmul2")));
+
+    tt::graphlib::Node* queue = graph.get_node_by_name("e2e_queue");
+    EXPECT_FALSE(node_placements.is_placed(queue));
+    EXPECT_EQ(node_placements.chip_id(queue), solution.chip_id("e2e_queue"));
+
+    tt::graphlib::Node* unplaced = graph.get_node_by_name("unplaced");
+    EXPECT_EQ(node_placements.is_placed(unplaced), solution.is_placed("unplaced"));
+    EXPECT_THROW(node_placements.epoch_id(unplaced), std::out_of_range);
+
+    // The view is built once, and rebuilt after the placements are edited
+    EXPECT_EQ(&solution.node_placements(&graph), &node_placements);
+    solution.name_to_queue_placement.at("e2e_queue").chip_id = 0;
+    solution.invalidate_node_placements();
+    EXPECT_EQ(solution.node_placements(&graph).chip_id(queue), 0);
+}
+
 
 TEST(Placer, test_multichip_fwd_and_bwd)
 {
@@ -543,6 +619,130 @@ TEST(Placer, test_auto_transpose_ops)
 
 
 
+TEST(Placer, device_grid_first_fit)
+{
+    DeviceGrid grid(10, 12);
+    EXPECT_TRUE(grid.is_free());
+    EXPECT_EQ(grid.first_fit(GridShape(10, 12)), (Coord{.row = 0, .col = 0}));
+    EXPECT_FALSE(grid.first_fit(GridShape(11, 1)).has_value());
+
+    grid.occupy(Coord{.row = 0, .col = 0}, GridShape(2, 5));
+    grid.occupy(Coord{.row = 0, .col = 8}, GridShape(1, 4));
+    EXPECT_TRUE(grid.is_occupied(1, 4));
+    EXPECT_FALSE(grid.is_occupied(1, 5));
+
+    EXPECT_EQ(grid.first_fit(GridShape(1, 3)), (Coord{.row = 0, .col = 5}));
+    EXPECT_EQ(grid.first_fit(GridShape(2, 4)), (Coord{.row = 1, .col = 8}));
+    EXPECT_EQ(grid.first_fit(GridShape(3, 8)), (Coord{.row = 2, .col = 0}));
+    EXPECT_FALSE(grid.is_free(Coord{.row = 0, .col = 4}, GridShape(1, 2)));
+    EXPECT_FALSE(grid.is_free(Coord{.row = 9, .col = 11}, GridShape(1, 2)));
+
+    // Same answers as checking every origin core by core
+    std::srand(0);
+    for (int trial = 0; trial < 100; trial++)
+    {
+        DeviceGrid random_grid(10, 12);
+        for (int i = 0; i < 6; i++)
+        {
+            Coord start{.row = (uint32_t)(std::rand() % 10), .col = (uint32_t)(std::rand() % 12)};
+            GridShape shape(1 + std::rand() % (10 - start.row), 1 + std::rand() % (12 - start.col));
+            random_grid.occupy(start, shape);
+        }
+
+        GridShape op_shape(1 + std::rand() % 4, 1 + std::rand() % 6);
+        std::optional<Coord> expected;
+        for (uint32_t r = 0; r < 10 and not expected; r++)
+            for (uint32_t c = 0; c < 12 and not expected; c++)
+            {
+                bool fits = r + op_shape.rows <= 10 and c + op_shape.columns <= 12;
+                for (uint32_t i = r; fits and i < r + op_shape.rows; i++)
+                    for (uint32_t j = c; fits and j < c + op_shape.columns; j++) fits = not random_grid.is_occupied(i, j);
+                if (fits)
+                    expected = Coord{.row = r, .col = c};
+            }
+        EXPECT_EQ(random_grid.first_fit(op_shape), expected);
+    }
+}
+
+
+TEST(Placer, eth_link_topology)
+{
+    // 2x2 mesh 0-1, 0-2, 1-3, 2-3 with a single link on 2-3, and a chip 4 hanging off chip 3
+    //   0 = 1
+    //   "   "
+    //   2 - 3 = 4
+    std::map<std::uint32_t, std::map<std::uint32_t, std::set<std::uint32_t>>> connections = {
+        {0, {{1, {0, 1}}, {2, {2, 3}}}},
+        {1, {{3, {0, 1}}}},
+        {2, {{3, {0}}}},
+        {3, {{4, {2, 3}}}},
+    };
+    EthLinkTopology topology(connections);
+
+    EXPECT_EQ(topology.num_links(0, 1), 2);
+    EXPECT_EQ(topology.num_links(3, 1), 2);
+    EXPECT_EQ(topology.num_links(2, 3), 1);
+    EXPECT_EQ(topology.num_links(0, 3), 0);
+
+    // Ties between equally short routes go through the lower chip id
+    EXPECT_EQ(topology.route(0, 3), std::vector<std::uint32_t>({0, 1, 3}));
+    EXPECT_EQ(topology.route(4, 0), std::vector<std::uint32_t>({4, 3, 1, 0}));
+    EXPECT_EQ(topology.num_hops(2, 4), 2);
+    EXPECT_TRUE(topology.route(0, 5).empty());
+
+    // Consecutive chips are kept adjacent, and not in chip id order
+    EXPECT_EQ(topology.chain_order({0, 1, 2, 3, 4}), std::vector<std::uint32_t>({0, 1, 3, 4, 2}));
+    EXPECT_EQ(topology.chain_order({2, 0, 1}), std::vector<std::uint32_t>({2, 0, 1}));
+
+    // Without a cluster descriptor the given order is kept
+    EXPECT_TRUE(EthLinkTopology().empty());
+    EXPECT_EQ(EthLinkTopology().chain_order({3, 1, 2}), std::vector<std::uint32_t>({3, 1, 2}));
+}
+
+TEST(Placer, min_traffic_chip_placement)
+{
+    // Linear 0 = 1 = 2, with the mmio chip at the end of the pipeline
+    std::map<std::uint32_t, std::map<std::uint32_t, std::set<std::uint32_t>>> connections = {
+        {0, {{1, {0, 1}}}},
+        {1, {{2, {0, 1}}}},
+    };
+    EthLinkTopology topology(connections);
+    EXPECT_EQ(get_min_traffic_chip_order(topology, {0, 1, 2}, {0}), std::vector<std::uint32_t>({2, 1, 0}));
+    EXPECT_EQ(get_min_traffic_chip_order(EthLinkTopology(), {0, 1, 2}, {0}), std::vector<std::uint32_t>({1, 2, 0}));
+
+    // Both splits after b and after c are within 10% of the average cycles, the one after c moves fewer bytes
+    vector<string> scheduled_ops = {"a", "b", "c", "d", "e", "c_bwd"};
+    ChipTrafficModel traffic = {
+        .op_cycles = {{"a", 10}, {"b", 10}, {"c", 1}, {"d", 10}, {"e", 10}},
+        .op_to_op_bytes = {{{"a", "b"}, 100}, {{"b", "c"}, 100}, {{"c", "d"}, 10}, {{"d", "e"}, 100}},
+    };
+    ChipPlacerConfig chip_placer_config = {
+        .chip_ids = std::vector<std::uint32_t>{1, 0},
+        .arch_name = "wormhole_b0",
+        .op_to_epoch_type = test::map_ops_to_forward_epoch(scheduled_ops),
+        .fwd_to_bwd_nodes = {{"c", {"c_bwd"}}},
+    };
+    chip_placer_config.op_to_epoch_type["c_bwd"] = NodeEpochType::Backward;
+
+    OpToChipIdAssignment assignment =
+        get_min_traffic_op_to_chip_id_assignment(chip_placer_config, scheduled_ops, traffic, topology);
+    OpToChipIdAssignment expected = {{"a", 1}, {"b", 1}, {"c", 1}, {"d", 0}, {"e", 0}, {"c_bwd", 1}};
+    EXPECT_EQ(assignment, expected);
+
+    // A fractured op pins its chip, even if that moves more bytes
+    chip_placer_config.fracture_chip_id_assignments = {{"c", 0}};
+    assignment = get_min_traffic_op_to_chip_id_assignment(chip_placer_config, scheduled_ops, traffic, topology);
+    expected = {{"a", 1}, {"b", 1}, {"c", 0}, {"d", 0}, {"e", 0}, {"c_bwd", 0}};
+    EXPECT_EQ(assignment, expected);
+
+    // Balance wins over traffic, the cheap cut after a would leave chip 1 with too few cycles
+    traffic.op_to_op_bytes = {{{"b", "c"}, 100}, {{"c", "d"}, 100}};
+    chip_placer_config.fracture_chip_id_assignments = {};
+    assignment = get_min_traffic_op_to_chip_id_assignment(chip_placer_config, scheduled_ops, traffic, topology);
+    EXPECT_EQ(assignment.at("b"), 1);
+    EXPECT_EQ(assignment.at("d"), 0);
+}
+
 /* Turn off until deallocate is back on
 TEST(Placer, best_fit_allocator)
 {
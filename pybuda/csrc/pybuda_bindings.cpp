@@ -31,6 +31,7 @@ namespace py = pybind11;
 #include "python_bindings_common.hpp"
 #include "reportify/reportify.hpp"
 #include "scheduler/python_bindings.hpp"
+#include "shared_utils/instrumentation.hpp"
 #include "shared_utils/sparse_matmul_utils.hpp"
 #include "utils/ordered_associative_containers/ordered_map.hpp"
 #include "tt_torch_device/python_bindings.hpp"
@@ -122,12 +123,36 @@ PYBIND11_MODULE(_C, m) {
     py::module_ m_torch_device = m.def_submodule("torch_device", "TT Torch Device");
     TorchDeviceModule(m_torch_device);
 
+    py::module_ m_instrumentation = m.def_submodule("instrumentation", "Compile-time scoped timers and counters");
+    m_instrumentation.def("begin_event", &instrumentation::begin_event, py::arg("name"), py::arg("category") = "pass");
+    m_instrumentation.def("end_event", &instrumentation::end_event);
+    m_instrumentation.def(
+        "counter_add",
+        [](std::string const &name, std::int64_t value) { instrumentation::counter(name).fetch_add(value); },
+        py::arg("name"),
+        py::arg("value") = 1);
+    m_instrumentation.def(
+        "counter_set",
+        [](std::string const &name, std::int64_t value) { instrumentation::counter(name).store(value); });
+    m_instrumentation.def("counter_value", &instrumentation::counter_value);
+    m_instrumentation.def("rss_kb", &instrumentation::rss_kb);
+    m_instrumentation.def("reset", &instrumentation::reset);
+    m_instrumentation.def("chrome_trace_json", &instrumentation::chrome_trace_json);
+    m_instrumentation.def("write_chrome_trace", &instrumentation::write_chrome_trace);
+    m_instrumentation.def("summary_table", &instrumentation::summary_table);
+
     py::class_<BudaNetlistConfig>(m, "BudaNetlistConfig")
         .def(py::init<>());
 
     py::class_<BudaNetlist>(m, "BudaNetlist")
         .def(py::init<>())
         .def("dump_to_yaml", &BudaNetlist::dump_to_yaml)
+        .def(
+            "dump_to_file",
+            &BudaNetlist::dump_to_file,
+            py::arg("filename"),
+            py::arg("parallel_graphs") = true,
+            py::call_guard<py::gil_scoped_release>())
         .def("append_comment", &BudaNetlist::append_comment);
 
     py::class_<DramQueueConfigOverride>(m, "DramQueueConfigOverride")
@@ -423,7 +448,8 @@ PYBIND11_MODULE(_C, m) {
         py::arg("amp_properties") = std::vector<AMPNodeProperties>{},
         py::arg("op_intermediates_to_save") = std::vector<std::string>{},
         py::arg("use_interactive_placer") = true,
-        py::arg("enable_device_tilize") = false);
+        py::arg("enable_device_tilize") = false,
+        py::arg("chip_placement_policy") = placer::ChipPlacementPolicy::MMIO_LAST);
     m.def(
         "is_subset_of_instructions",
         &is_subset_of_instructions,
@@ -460,6 +486,7 @@ PYBIND11_MODULE(_C, m) {
         py::arg("placer_solution") = nullptr,
         py::arg("balancer_solution") = nullptr
     );
+    m.def("flush_reportify_dumps", &tt::reportify::flush_dumps);
     m.def("dump_epoch_type_graphs", [](
         const tt::graphlib::Graph *graph, 
         std::string test_name, 
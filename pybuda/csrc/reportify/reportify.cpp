@@ -3,12 +3,17 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "reportify/reportify.hpp"
 
+#include <condition_variable>
+#include <deque>
 #include <experimental/filesystem>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
+#include <optional>
 #include <ostream>
 #include <sstream>
 #include <string>
+#include <thread>
 
 #include "balancer/balancer.hpp"
 #include "graph_lib/graph.hpp"
@@ -47,9 +52,6 @@ std::string stream_operator_to_string(T obj)
     return oss.str();
 }
 
-using JsonNamePair = std::pair<json, std::string>;
-using JsonNamePairs = std::vector<JsonNamePair>;
-
 std::vector<std::string> tt_nodes_to_name_strings(const std::vector<graphlib::Node*>& nodes)
 {
     std::vector<std::string> ret_vector;
@@ -63,21 +65,75 @@ std::vector<std::string> tt_nodes_to_name_strings(const std::vector<graphlib::No
     return ret_vector;
 }
 
-json node_to_json(
+// What the json of a node reads from the graph and the placer/balancer solutions. Copied on the compiling thread, so
+// the json itself is built on the dump writer thread while passes keep changing the graph.
+struct NodeSnapshot
+{
+    std::string name;
+    graphlib::NodeId id;
+    graphlib::NodeType node_type;
+    graphlib::NodeEpochType epoch_type;
+    std::vector<std::uint32_t> shape;
+    DataFormat output_df;
+
+    std::vector<std::string> input_nodes;
+    std::vector<std::string> incoming_edge_port_info;
+    std::unordered_map<std::string, std::string> input_node_to_edge_type;
+    std::vector<std::string> output_nodes;
+    std::vector<std::string> outgoing_edge_port_info;
+    std::vector<std::pair<graphlib::PortId, std::vector<graphlib::OpType>>> input_tms;
+
+    std::uint32_t epoch = 0;
+    std::optional<std::uint32_t> chip_id;
+    std::optional<placer::CoordRange> placed_cores;
+    std::optional<balancer::OpModel> op_model;
+    std::optional<balancer::TStreamFactor> t_stream_factor;  // of the op writing into a queue
+
+    // Type specific, only set for the node types that have them
+    std::optional<std::string> class_name;
+    std::optional<std::string> type;  // node type string if not set
+    std::optional<std::string> ir;
+    std::optional<graphlib::OpType> op_type;
+    std::optional<bool> gradient_op;
+    std::optional<std::string> intermediate_df;
+    std::optional<std::string> accumulate_df;
+    std::optional<std::string> fidelity;
+    std::optional<std::vector<std::vector<std::string>>> schedules;
+    std::optional<std::string> constant_value;
+    std::optional<json> constant_dims;
+    std::optional<std::vector<float>> constant_tile;
+    std::optional<std::string> queue_type;
+    std::optional<bool> is_cross_epoch_type;
+    std::optional<std::string> memory_access;
+    std::optional<std::vector<int>> tile_broadcast;
+    std::optional<bool> requires_grad;
+    std::optional<bool> is_saved_intermediate;
+    std::optional<graphlib::TagHints> tags;
+};
+
+using GraphSnapshot = std::vector<NodeSnapshot>;  // nodes in topological order
+
+static void snapshot_queue(NodeSnapshot& snapshot, const graphlib::Node* node)
+{
+    snapshot.queue_type = node->as<graphlib::QueueNode>()->queue_type_string();
+    snapshot.is_cross_epoch_type = node->as<graphlib::QueueNode>()->is_epoch_to_epoch() and
+                                   node->as<graphlib::EpochToEpochQueueNode>()->is_cross_epoch_type();
+    snapshot.memory_access = node->as<graphlib::QueueNode>()->memory_access_type_string();
+}
+
+NodeSnapshot snapshot_node(
     const graphlib::Node* node,
     const graphlib::Graph* graph,
     const placer::PlacerSolution* placer_solution,
     std::shared_ptr<balancer::BalancerSolution> balancer_solution)
 {
-    json ret_json;
-    ret_json["pybuda"] = 1;  // marker to reportify to use new colouring scheme
-    ret_json["name"] = node->name();
-    ret_json["unique_id"] = node->id();
-    std::vector<std::string> input_nodes;
-    std::vector<std::string> output_nodes;
-    std::vector<std::string> port_id_to_name_incoming;
-    std::vector<std::string> port_id_to_name_outgoing;
-    std::unordered_map<std::string, std::string> input_node_name_to_edge_type;
+    NodeSnapshot snapshot;
+    snapshot.name = node->name();
+    snapshot.id = node->id();
+    snapshot.node_type = node->node_type();
+    snapshot.epoch_type = node->get_epoch_type();
+    snapshot.shape = node->shape().as_vector();
+    snapshot.output_df = node->output_df();
 
     for (auto incoming_edge : graph->operand_edges(node))
     {
@@ -100,7 +156,7 @@ json node_to_json(
             }
         }
 
-        port_id_to_name_incoming.push_back(incoming_port_info);
+        snapshot.incoming_edge_port_info.push_back(incoming_port_info);
 
         if (incoming_edge.edge_type != graphlib::EdgeType::kData and
             incoming_edge.edge_type != graphlib::EdgeType::kDataLoopback and
@@ -111,31 +167,23 @@ json node_to_json(
             continue;  // don't display others for now
         }
 
-        input_nodes.push_back(incoming_node->name());
-        input_node_name_to_edge_type.insert({incoming_node->name(), edge_type_string});
+        snapshot.input_nodes.push_back(incoming_node->name());
+        snapshot.input_node_to_edge_type.insert({incoming_node->name(), edge_type_string});
     }
 
-    ret_json["input_nodes"] = input_nodes;
-    ret_json["incoming_edge_port_info"] = port_id_to_name_incoming;
-    ret_json["input_node_to_edge_type"] = input_node_name_to_edge_type;
-
     for (auto outgoing_edge : graph->user_edges(node))
     {
         graphlib::NodeId outgoing_node_id = outgoing_edge.consumer_node_id;
         graphlib::Node* outgoing_node = graph->node_by_id(outgoing_node_id);
-        output_nodes.push_back(outgoing_node->name());
+        snapshot.output_nodes.push_back(outgoing_node->name());
 
         std::string port_key_string = "port_" + std::to_string(outgoing_edge.producer_output_port_id);
         std::string edge_type_string = graphlib::edge_type_to_string(outgoing_edge.edge_type);
         std::string outgoing_port_info = edge_type_string + ": " + outgoing_node->name() + " (" + port_key_string + ")";
 
-        port_id_to_name_outgoing.push_back(outgoing_port_info);
+        snapshot.outgoing_edge_port_info.push_back(outgoing_port_info);
     }
 
-    ret_json["opcode"] = stream_operator_to_string(node->node_type());
-    ret_json["cache"]["shape"] = node->shape().as_vector();
-
-    ret_json["epoch"] = 0;
     if (placer_solution != nullptr)
     {
         try
@@ -143,20 +191,19 @@ json node_to_json(
             if (node->node_type() == graphlib::NodeType::kBudaOp)
             {
                 placer::OpPlacement placement = placer_solution->name_to_op_placement.at(node->name());
-                ret_json["grid_start"] = {placement.placed_cores.start.row, placement.placed_cores.start.col};
-                ret_json["grid_end"] = {placement.placed_cores.end.row, placement.placed_cores.end.col};
-                ret_json["epoch"] = placer_solution->temporal_epoch_id(node->name());
-                ret_json["chip_id"] = placer_solution->chip_id(node->name());
+                snapshot.placed_cores = placement.placed_cores;
+                snapshot.epoch = placer_solution->temporal_epoch_id(node->name());
+                snapshot.chip_id = placer_solution->chip_id(node->name());
             }
             else if (node->node_type() == graphlib::NodeType::kInput)
             {
-                ret_json["epoch"] = placer_solution->temporal_epoch_id(graph->data_users(node)[0]->name());
-                ret_json["chip_id"] = placer_solution->chip_id(graph->data_users(node)[0]->name());
+                snapshot.epoch = placer_solution->temporal_epoch_id(graph->data_users(node)[0]->name());
+                snapshot.chip_id = placer_solution->chip_id(graph->data_users(node)[0]->name());
             }
             else if (node->node_type() == graphlib::NodeType::kOutput)
             {
-                ret_json["epoch"] = placer_solution->temporal_epoch_id(graph->data_operands(node)[0]->name());
-                ret_json["chip_id"] = placer_solution->chip_id(graph->data_operands(node)[0]->name());
+                snapshot.epoch = placer_solution->temporal_epoch_id(graph->data_operands(node)[0]->name());
+                snapshot.chip_id = placer_solution->chip_id(graph->data_operands(node)[0]->name());
             }
         }
         catch (std::out_of_range& e)
@@ -167,96 +214,72 @@ json node_to_json(
 
     if (balancer_solution and balancer_solution->op_models.find(node->name()) != balancer_solution->op_models.end())
     {
-        balancer::OpModel const& op_model = balancer_solution->op_models.at(node->name());
-        ret_json["op_model"] = op_model;
+        snapshot.op_model = balancer_solution->op_models.at(node->name());
     }
 
-    ret_json["epoch_type"] = graphlib::node_epoch_type_to_string(node->get_epoch_type());
-    ret_json["output_nodes"] = output_nodes;
-    ret_json["outgoing_edge_port_info"] = port_id_to_name_outgoing;
-
-    ret_json["type"] = stream_operator_to_string(node->node_type());
     if (node->node_type() == graphlib::NodeType::kInput)
     {
         // Keep constants and accumulators inside the epoch to better visualize what's happening
         if (node->as<graphlib::InputNode>()->is_constant())
         {
-            ret_json["class"] = node->as<graphlib::InputNode>()->input_type_string();
-            ret_json["type"] = "Constant";
+            snapshot.class_name = node->as<graphlib::InputNode>()->input_type_string();
+            snapshot.type = "Constant";
 
             const graphlib::ConstantInputNode* cnode = node->as<graphlib::ConstantInputNode>();
             if (cnode->is_single_value())
             {
-                ret_json["constant_value"] = std::to_string(cnode->constant_value());
-                ret_json["constant_dims"] = cnode->constant_dims();
+                snapshot.constant_value = std::to_string(cnode->constant_value());
+                snapshot.constant_dims = cnode->constant_dims();
             }
             else if (cnode->is_single_tile())
             {
-                ret_json["constant_tile"] = cnode->tile_value();
+                snapshot.constant_tile = cnode->tile_value();
             }
             else if (cnode->is_tensor())
             {
-                ret_json["constant_dims"] = cnode->tensor_shape().as_vector();
+                snapshot.constant_dims = json(cnode->tensor_shape().as_vector());
             }
         }
         else if (node->as<graphlib::InputNode>()->is_accumulator())
         {
-            ret_json["class"] = "accumulator";
-            ret_json["type"] = "Accumulator";
+            snapshot.class_name = "accumulator";
+            snapshot.type = "Accumulator";
         }
         else
         {
-            ret_json["class"] = "Input::";
-            ret_json["type"] = "Input::" + node->as<graphlib::InputNode>()->input_type_string();
+            snapshot.class_name = "Input::";
+            snapshot.type = "Input::" + node->as<graphlib::InputNode>()->input_type_string();
         }
-        ret_json["queue_type"] = node->as<graphlib::QueueNode>()->queue_type_string();
-        ret_json["is_cross_epoch_type"] = node->as<graphlib::QueueNode>()->is_epoch_to_epoch() and
-                                          node->as<graphlib::EpochToEpochQueueNode>()->is_cross_epoch_type();
-        ret_json["memory_access"] = node->as<graphlib::QueueNode>()->memory_access_type_string();
-        ret_json["tile_broadcast"] = node->as<graphlib::InputNode>()->get_tile_broadcast_dims();
-        ret_json["requires_grad"] = node->as<graphlib::InputNode>()->requires_grad();
+        snapshot_queue(snapshot, node);
+        snapshot.tile_broadcast = node->as<graphlib::InputNode>()->get_tile_broadcast_dims();
+        snapshot.requires_grad = node->as<graphlib::InputNode>()->requires_grad();
     }
     else if (node->node_type() == graphlib::NodeType::kOutput)
     {
-        ret_json["class"] = "Output";
-        ret_json["queue_type"] = node->as<graphlib::QueueNode>()->queue_type_string();
-        ret_json["is_cross_epoch_type"] = node->as<graphlib::QueueNode>()->is_epoch_to_epoch() and
-                                          node->as<graphlib::EpochToEpochQueueNode>()->is_cross_epoch_type();
-        ret_json["memory_access"] = node->as<graphlib::QueueNode>()->memory_access_type_string();
-        ret_json["is_saved_intermediate"] = node->as<graphlib::OutputNode>()->is_saved_intermediate();
+        snapshot.class_name = "Output";
+        snapshot_queue(snapshot, node);
+        snapshot.is_saved_intermediate = node->as<graphlib::OutputNode>()->is_saved_intermediate();
     }
     else if (node->node_type() == graphlib::NodeType::kPyOp)
     {
         const graphlib::PyOpNode* opnode = node->as<graphlib::PyOpNode>();
-        ret_json["ir"] = "pybuda";
-        ret_json["class"] = opnode->op_type().as_string();
-        ret_json["type"] = opnode->op_type().op;
-        to_json(ret_json, opnode->op_type());
-        ret_json["gradient_op"] = opnode->is_gradient_op();
+        snapshot.ir = "pybuda";
+        snapshot.class_name = opnode->op_type().as_string();
+        snapshot.type = opnode->op_type().op;
+        snapshot.op_type = opnode->op_type();
+        snapshot.gradient_op = opnode->is_gradient_op();
     }
     else if (node->node_type() == graphlib::NodeType::kBudaOp)
     {
         const graphlib::BudaOpNode* opnode = node->as<graphlib::BudaOpNode>();
-        ret_json["ir"] = "buda";
-        ret_json["class"] = opnode->op_type().as_string();
-        ret_json["type"] = opnode->op_type().op;
-        to_json(ret_json, opnode->op_type());
-        ret_json["gradient_op"] = opnode->is_gradient_op();
-        {
-            std::stringstream ss;
-            ss << opnode->intermediate_df();
-            ret_json["intermediate_df"] = ss.str();
-        }
-        {
-            std::stringstream ss;
-            ss << opnode->accumulate_df();
-            ret_json["accumulate_df"] = ss.str();
-        }
-        {
-            std::stringstream ss;
-            ss << opnode->math_fidelity();
-            ret_json["fidelity"] = ss.str();
-        }
+        snapshot.ir = "buda";
+        snapshot.class_name = opnode->op_type().as_string();
+        snapshot.type = opnode->op_type().op;
+        snapshot.op_type = opnode->op_type();
+        snapshot.gradient_op = opnode->is_gradient_op();
+        snapshot.intermediate_df = stream_operator_to_string(opnode->intermediate_df());
+        snapshot.accumulate_df = stream_operator_to_string(opnode->accumulate_df());
+        snapshot.fidelity = stream_operator_to_string(opnode->math_fidelity());
 
         if (opnode->is_fused_op())
         {
@@ -277,79 +300,273 @@ json node_to_json(
                 schedules.push_back(sch);
             }
 
-            ret_json["schedules"] = schedules;
+            snapshot.schedules = schedules;
         }
     }
     else if (node->node_type() == graphlib::NodeType::kBudaNaryTM)
     {
         const graphlib::BudaNaryTMNode* tmnode = node->as<graphlib::BudaNaryTMNode>();
-        ret_json["ir"] = "buda";
-        ret_json["class"] = tmnode->op_type().as_string();
-        ret_json["type"] = tmnode->op_type().op;
-        to_json(ret_json, tmnode->op_type());
+        snapshot.ir = "buda";
+        snapshot.class_name = tmnode->op_type().as_string();
+        snapshot.type = tmnode->op_type().op;
+        snapshot.op_type = tmnode->op_type();
     }
     else if (node->node_type() == graphlib::NodeType::kQueue)
     {
-        ret_json["class"] = "BudaDramQueue::";
-        ret_json["queue_type"] = node->as<graphlib::QueueNode>()->queue_type_string();
-        ret_json["is_cross_epoch_type"] = node->as<graphlib::QueueNode>()->is_epoch_to_epoch() and
-                                          node->as<graphlib::EpochToEpochQueueNode>()->is_cross_epoch_type();
-        ret_json["memory_access"] = node->as<graphlib::QueueNode>()->memory_access_type_string();
+        snapshot.class_name = "BudaDramQueue::";
+        snapshot_queue(snapshot, node);
 
         if (balancer_solution)
         {
             auto operands = graph->data_operands(node);
             TT_ASSERT(operands.size() == 1);
             TT_ASSERT(operands[0]->node_type() == graphlib::NodeType::kBudaOp);
-            balancer::OpModel const& op_model = balancer_solution->op_models.at(operands[0]->name());
-            ret_json["op_model"] = {{"t_stream_factor", op_model.t_stream_factor}};
+            snapshot.t_stream_factor = balancer_solution->op_models.at(operands[0]->name()).t_stream_factor;
         }
     }
-    std::stringstream ss;
-    ss << node->output_df();
-    ret_json["output_df"] = ss.str();
 
     if (auto tagged_node = dynamic_cast<const graphlib::TaggedNode*>(node); tagged_node != nullptr)
     {
-        ret_json["tags"] = tagged_node->get_tags();
+        snapshot.tags = tagged_node->get_tags();
     }
 
     // Record input TMs, if any, on the input edges
     for (graphlib::Edge e : graph->operand_data_edges(node))
     {
-        std::vector<graphlib::OpType> tms = graph->get_edge_attributes(e)->get_tms();
-        ret_json["input_tms"][e.consumer_input_port_id] = json::array();
-        if (tms.size() > 0)
+        snapshot.input_tms.emplace_back(e.consumer_input_port_id, graph->get_edge_attributes(e)->get_tms());
+    }
+
+    return snapshot;
+}
+
+template <class T>
+static void set_if_present(json& j, const char* key, std::optional<T> const& value)
+{
+    if (value.has_value())
+        j[key] = *value;
+}
+
+json node_to_json(NodeSnapshot const& node)
+{
+    json ret_json;
+    ret_json["pybuda"] = 1;  // marker to reportify to use new colouring scheme
+    ret_json["name"] = node.name;
+    ret_json["unique_id"] = node.id;
+
+    ret_json["input_nodes"] = node.input_nodes;
+    ret_json["incoming_edge_port_info"] = node.incoming_edge_port_info;
+    ret_json["input_node_to_edge_type"] = node.input_node_to_edge_type;
+
+    ret_json["opcode"] = stream_operator_to_string(node.node_type);
+    ret_json["cache"]["shape"] = node.shape;
+
+    ret_json["epoch"] = node.epoch;
+    if (node.placed_cores.has_value())
+    {
+        ret_json["grid_start"] = {node.placed_cores->start.row, node.placed_cores->start.col};
+        ret_json["grid_end"] = {node.placed_cores->end.row, node.placed_cores->end.col};
+    }
+    set_if_present(ret_json, "chip_id", node.chip_id);
+    set_if_present(ret_json, "op_model", node.op_model);
+
+    ret_json["epoch_type"] = graphlib::node_epoch_type_to_string(node.epoch_type);
+    ret_json["output_nodes"] = node.output_nodes;
+    ret_json["outgoing_edge_port_info"] = node.outgoing_edge_port_info;
+
+    ret_json["type"] = node.type.has_value() ? *node.type : stream_operator_to_string(node.node_type);
+    set_if_present(ret_json, "class", node.class_name);
+    set_if_present(ret_json, "ir", node.ir);
+    if (node.op_type.has_value())
+        to_json(ret_json, *node.op_type);
+    set_if_present(ret_json, "gradient_op", node.gradient_op);
+    set_if_present(ret_json, "intermediate_df", node.intermediate_df);
+    set_if_present(ret_json, "accumulate_df", node.accumulate_df);
+    set_if_present(ret_json, "fidelity", node.fidelity);
+    set_if_present(ret_json, "schedules", node.schedules);
+    set_if_present(ret_json, "constant_value", node.constant_value);
+    set_if_present(ret_json, "constant_dims", node.constant_dims);
+    set_if_present(ret_json, "constant_tile", node.constant_tile);
+    set_if_present(ret_json, "queue_type", node.queue_type);
+    set_if_present(ret_json, "is_cross_epoch_type", node.is_cross_epoch_type);
+    set_if_present(ret_json, "memory_access", node.memory_access);
+    set_if_present(ret_json, "tile_broadcast", node.tile_broadcast);
+    set_if_present(ret_json, "requires_grad", node.requires_grad);
+    set_if_present(ret_json, "is_saved_intermediate", node.is_saved_intermediate);
+    if (node.t_stream_factor.has_value())
+        ret_json["op_model"] = {{"t_stream_factor", *node.t_stream_factor}};
+
+    ret_json["output_df"] = stream_operator_to_string(node.output_df);
+    set_if_present(ret_json, "tags", node.tags);
+
+    // Record input TMs, if any, on the input edges
+    for (auto const& [port_id, tms] : node.input_tms)
+    {
+        ret_json["input_tms"][port_id] = json::array();
+        for (const auto& tm : tms)
         {
-            for (const auto& tm : tms)
-            {
-                json j;
-                to_json(j, tm);
-                ret_json["input_tms"][e.consumer_input_port_id].push_back(j);
-            }
+            json j;
+            to_json(j, tm);
+            ret_json["input_tms"][port_id].push_back(j);
         }
     }
 
     return ret_json;
 }
-using JsonNamePair = std::pair<json, std::string>;
-using JsonNamePairs = std::vector<JsonNamePair>;
-
-void write_json_to_file(const std::string& path, json json_file, int width = 4)
+// Compact by default, PYBUDA_REPORTIFY_PRETTY_JSON indents graph dumps for reading them by hand
+void write_json_to_file(const std::string& path, json const& json_file, bool allow_pretty = true)
 {
     std::ofstream o(path);
-    if (width > 0)
+    if (allow_pretty and env_as<bool>("PYBUDA_REPORTIFY_PRETTY_JSON"))
         o << std::setw(4);
     o << json_file;
 }
 
-JsonNamePairs create_jsons_for_graph(
-    const std::string& graph_prefix,
+// Builds, serializes and writes dumps on a background thread, so the compile thread only pays for copying what the
+// json reads from the graph. Dumps are written one at a time, in submission order. Set PYBUDA_REPORTIFY_SYNC_DUMP to write them
+// on the calling thread instead, e.g. to keep the last dumps when debugging a crash.
+class DumpWriter
+{
+   public:
+    static DumpWriter& get()
+    {
+        static DumpWriter writer;
+        return writer;
+    }
+
+    void submit(std::function<void()> task)
+    {
+        if (env_as<bool>("PYBUDA_REPORTIFY_SYNC_DUMP"))
+        {
+            flush();
+            std::lock_guard<std::mutex> write_lock(write_mutex);
+            run_task(task);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (not worker.joinable())
+                worker = std::thread([this] { run(); });
+            tasks.push_back(std::move(task));
+        }
+        task_added.notify_one();
+    }
+
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        queue_drained.wait(lock, [this] { return tasks.empty() and not busy; });
+    }
+
+    void write_graph_json_or_delta(const std::string& path, const std::string& graph_key, json const& graph_json);
+
+    ~DumpWriter()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        task_added.notify_one();
+        if (worker.joinable())
+            worker.join();
+    }
+
+   private:
+    std::mutex mutex;
+    std::mutex write_mutex;
+    std::condition_variable task_added;
+    std::condition_variable queue_drained;
+    std::deque<std::function<void()>> tasks;
+    std::thread worker;
+    bool busy = false;
+    bool stop = false;
+
+    // Last full graph written per graph and report directory, the base of the next delta. Lives with the writer, so
+    // it's still around while the worker drains the queue on exit.
+    std::unordered_map<std::string, json> last_dumps;
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            task_added.wait(lock, [this] { return stop or not tasks.empty(); });
+            if (tasks.empty())
+                return;  // stopped, and everything submitted is written
+
+            std::function<void()> task = std::move(tasks.front());
+            tasks.pop_front();
+            busy = true;
+            lock.unlock();
+            {
+                std::lock_guard<std::mutex> write_lock(write_mutex);
+                run_task(task);
+            }
+            lock.lock();
+            busy = false;
+            if (tasks.empty())
+                queue_drained.notify_all();
+        }
+    }
+
+    static void run_task(std::function<void()> const& task)
+    {
+        try
+        {
+            task();
+        }
+        catch (std::exception const& e)
+        {
+            log_warning(tt::LogReportify, "Failed to write reportify dump: {}", e.what());
+        }
+    }
+};
+
+// With PYBUDA_REPORTIFY_DUMP_DELTAS set, only the first dump of a graph to a report directory is written in full.
+// Following dumps of the same graph are written next to it as <name>.delta, holding the nodes that changed or
+// were removed since the previous dump, and the new topological order. Only called from writer tasks.
+void DumpWriter::write_graph_json_or_delta(const std::string& path, const std::string& graph_key, json const& graph_json)
+{
+    auto last_dump = last_dumps.find(graph_key);
+    if (last_dump == last_dumps.end())
+    {
+        write_json_to_file(path, graph_json);
+        last_dumps.emplace(graph_key, graph_json);
+        return;
+    }
+
+    auto nodes_of = [](json const& j) { return j.contains("nodes") ? j.at("nodes") : json::object(); };
+    json const prev_nodes = nodes_of(last_dump->second);
+    json const curr_nodes = nodes_of(graph_json);
+
+    json delta;
+    delta["topological_sorted_nodes"] = graph_json.at("topological_sorted_nodes");
+    delta["changed_nodes"] = json::object();
+    delta["removed_nodes"] = json::array();
+    for (auto const& [name, node] : curr_nodes.items())
+    {
+        auto prev = prev_nodes.find(name);
+        if (prev == prev_nodes.end() or *prev != node)
+            delta["changed_nodes"][name] = node;
+    }
+    for (auto const& [name, node] : prev_nodes.items())
+    {
+        if (not curr_nodes.contains(name))
+            delta["removed_nodes"].push_back(name);
+    }
+
+    write_json_to_file(path + ".delta", delta);
+    last_dump->second = graph_json;
+}
+
+GraphSnapshot snapshot_graph(
     const graphlib::Graph* graph,
     const placer::PlacerSolution* placer_solution,
     std::shared_ptr<balancer::BalancerSolution> balancer_solution,
     std::function<bool(graphlib::Node*)> node_filter = [](graphlib::Node*) { return true; });
 
+json create_json_for_graph(GraphSnapshot const& snapshot);
+
 void dump_graph(
     const std::string& path,
     const std::string& test_name,
@@ -362,7 +579,7 @@ void dump_graph(
     if (env_as<bool>("PYBUDA_DISABLE_REPORTIFY_DUMP"))
         return;
 
-    JsonNamePairs json_pairs = create_jsons_for_graph(graph_prefix, graph, placer_solution, balancer_solution);
+    GraphSnapshot snapshot = snapshot_graph(graph, placer_solution, balancer_solution);
 
     initalize_reportify_directory(path, test_name);
 
@@ -373,11 +590,17 @@ void dump_graph(
 
     std::experimental::filesystem::create_directories(subgraph_path);
 
-    json root_json = json_pairs.back().first;
-    std::string root_json_name = json_pairs.back().second;
-
-    std::string root_json_path = sage_report_path + /*graph_prefix +*/ root_json_name;
-    write_json_to_file(root_json_path, root_json);
+    std::string root_json_path = sage_report_path + graph_prefix + ".buda";
+    std::string graph_key = sage_report_path + std::to_string(graph->id());
+    DumpWriter::get().submit(
+        [root_json_path, graph_key, snapshot = std::move(snapshot)]
+        {
+            json root_json = create_json_for_graph(snapshot);
+            if (env_as<bool>("PYBUDA_REPORTIFY_DUMP_DELTAS"))
+                DumpWriter::get().write_graph_json_or_delta(root_json_path, graph_key, root_json);
+            else
+                write_json_to_file(root_json_path, root_json);
+        });
 }
 
 void dump_consteval_graph(const std::string& test_name, const std::string& graph_prefix, const graphlib::Graph* graph)
@@ -443,18 +666,12 @@ void dump_epoch_type_graphs(
         }
 
         auto node_epoch_type_filter = std::bind(epoch_type_filter, std::placeholders::_1, epoch_type, graph);
-        JsonNamePairs new_json_pairs = create_jsons_for_graph(
-            graph_prefix + graphlib::node_epoch_type_to_string(epoch_type),
-            graph,
-            placer_solution,
-            balancer_solution,
-            node_epoch_type_filter);
-
-        for (const auto& [json, json_name] : new_json_pairs)
-        {
-            std::string root_json_path = sage_report_path + graph_prefix + json_name;
-            write_json_to_file(root_json_path, json);
-        }
+        GraphSnapshot snapshot = snapshot_graph(graph, placer_solution, balancer_solution, node_epoch_type_filter);
+
+        std::string root_json_path =
+            sage_report_path + graph_prefix + graph_prefix + graphlib::node_epoch_type_to_string(epoch_type) + ".buda";
+        DumpWriter::get().submit([root_json_path, snapshot = std::move(snapshot)]
+                                 { write_json_to_file(root_json_path, create_json_for_graph(snapshot)); });
     }
 }
 
@@ -528,56 +745,50 @@ void dump_epoch_id_graphs(
     for (uint32_t epoch_id = 0; epoch_id < placer_solution->num_epochs; ++epoch_id)
     {
         auto node_epoch_id_filter = std::bind(epoch_id_filter, std::placeholders::_1, epoch_id, graph, placer_solution);
-        JsonNamePairs new_json_pairs = create_jsons_for_graph(
-            graph_prefix + "_epoch_id_" + std::to_string(epoch_id),
-            graph,
-            placer_solution,
-            balancer_solution,
-            node_epoch_id_filter);
-
-        for (const auto& [json, json_name] : new_json_pairs)
-        {
-            std::string root_json_path = sage_report_path + graph_prefix + json_name;
-            write_json_to_file(root_json_path, json);
-        }
+        GraphSnapshot snapshot = snapshot_graph(graph, placer_solution, balancer_solution, node_epoch_id_filter);
+
+        std::string root_json_path =
+            sage_report_path + graph_prefix + graph_prefix + "_epoch_id_" + std::to_string(epoch_id) + ".buda";
+        DumpWriter::get().submit([root_json_path, snapshot = std::move(snapshot)]
+                                 { write_json_to_file(root_json_path, create_json_for_graph(snapshot)); });
     }
 }
 
-json create_json_for_graph(
+GraphSnapshot snapshot_graph(
     const graphlib::Graph* graph,
     const placer::PlacerSolution* placer_solution,
     std::shared_ptr<balancer::BalancerSolution> balancer_solution,
     std::function<bool(graphlib::Node*)> node_filter)
 {
-    json this_json;
-    this_json["topological_sorted_nodes"] = {};
+    GraphSnapshot snapshot;
     for (graphlib::Node* node : graphlib::topological_sort(*graph))
     {
         if (node_filter(node))
-        {
-            this_json["nodes"][node->name()] = node_to_json(node, graph, placer_solution, balancer_solution);
-            this_json["graph"] = std::unordered_map<std::string, std::string>();
-            this_json["topological_sorted_nodes"].push_back(node->name());
-        }
+            snapshot.push_back(snapshot_node(node, graph, placer_solution, balancer_solution));
+    }
+    return snapshot;
+}
+
+json create_json_for_graph(GraphSnapshot const& snapshot)
+{
+    json this_json;
+    this_json["topological_sorted_nodes"] = {};
+    for (NodeSnapshot const& node : snapshot)
+    {
+        this_json["nodes"][node.name] = node_to_json(node);
+        this_json["graph"] = std::unordered_map<std::string, std::string>();
+        this_json["topological_sorted_nodes"].push_back(node.name);
     }
     return this_json;
 }
 
-JsonNamePairs create_jsons_for_graph(
-    const std::string& graph_prefix,
+json create_json_for_graph(
     const graphlib::Graph* graph,
     const placer::PlacerSolution* placer_solution,
     std::shared_ptr<balancer::BalancerSolution> balancer_solution,
     std::function<bool(graphlib::Node*)> node_filter)
 {
-    JsonNamePairs this_json_name_pairs;
-
-    json this_json = create_json_for_graph(graph, placer_solution, balancer_solution, node_filter);
-    std::string this_name = graph_prefix + ".buda";
-    JsonNamePair this_json_name_pair = std::make_pair(this_json, this_name);
-    this_json_name_pairs.push_back(this_json_name_pair);
-
-    return this_json_name_pairs;
+    return create_json_for_graph(snapshot_graph(graph, placer_solution, balancer_solution, node_filter));
 }
 
 void dump_graph(
@@ -609,17 +820,20 @@ void dump_constraints(
 
         json constraints_json = graph_solver->get_constraint_info();
         std::string json_path = constraints_report_path + "constraints.json";
-        write_json_to_file(json_path, constraints_json, 0);
+        DumpWriter::get().submit([json_path, constraints_json = std::move(constraints_json)]
+                                 { write_json_to_file(json_path, constraints_json, false); });
 
         int page_idx = 0;
         for (auto const& page : graph_solver->get_constraint_info().pages)
         {
             std::string json_path = constraints_report_path + "constraints.page_" + std::to_string(page_idx) + ".json";
-            write_json_to_file(json_path, page, 0);
+            DumpWriter::get().submit([json_path, page = json(page)] { write_json_to_file(json_path, page, false); });
             ++page_idx;
         }
     }
 }
 
+void flush_dumps() { DumpWriter::get().flush(); }
+
 }  // namespace reportify
 }  // namespace tt
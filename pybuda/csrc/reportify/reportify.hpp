@@ -79,6 +79,9 @@ void dump_constraints(
     const balancer::legalizer::GraphSolver* graph_solver,
     const std::string& report_path = get_constraint_reports_relative_directory());
 
+// Dumps are written on a background thread, blocks until everything dumped so far is on disk
+void flush_dumps();
+
 }  // namespace reportify
 
 } // tt
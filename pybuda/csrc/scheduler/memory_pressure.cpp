@@ -0,0 +1,216 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "scheduler/memory_pressure.hpp"
+
+#include <algorithm>
+#include <tuple>
+
+#include "graph_lib/graph.hpp"
+#include "graph_lib/node.hpp"
+#include "graph_lib/node_types.hpp"
+#include "lower_to_buda/common.hpp"
+#include "utils/logger.hpp"
+
+using tt::LogScheduler;
+using tt::graphlib::Graph;
+using tt::graphlib::Node;
+
+//
+// Greedy list scheduler minimizing live tensor bytes.
+//
+// An op output is live from the moment the op is scheduled until its last user is scheduled; every live output
+// ends up either in L1 of a placed op, or in an epoch-to-epoch queue in DRAM if the epoch breaks in between. Out of
+// the ops that are ready, always schedule the one that grows the live set the least, i.e. its own output bytes minus
+// the bytes of operands it is the last user of.
+//
+// The topological schedule, reordered by optimize_schedule, is used as the reference:
+//   - ops are only picked from the earliest (epoch type, subgraph) phase that has ready ops, so fwd, bwd and opt
+//     stay in order,
+//   - ties are broken by reference index, so the bwd ops follow the reverse fwd order optimize_bwd_schedule picks.
+//
+// Scheduler constraints, data-copy writebacks and control edges are honored as extra dependencies, and sparse
+// matmuls are immediately followed by their paired dense matmul, the same way ModuleInputsBFS does it.
+//
+namespace tt::scheduler
+{
+
+static std::uint64_t get_output_bytes(const Node* node)
+{
+    return (std::uint64_t)node->shape().volume() * data_format_byte_size(node->output_df());
+}
+
+// Schedulable users and operands of each schedulable node, deduplicated and skipping through queues
+struct ScheduleNeighbours
+{
+    std::unordered_map<const Node*, std::vector<const Node*>> predecessors;
+    std::unordered_map<const Node*, std::vector<const Node*>> successors;
+
+    ScheduleNeighbours(const Graph* graph, const std::vector<const Node*>& nodes)
+    {
+        auto dedup = [](std::vector<const Node*> v)
+        {
+            std::vector<const Node*> filtered;
+            for (const Node* node : v)
+                if (can_schedule_node(node) and std::find(filtered.begin(), filtered.end(), node) == filtered.end())
+                    filtered.push_back(node);
+            return filtered;
+        };
+
+        for (const Node* node : nodes)
+        {
+            predecessors[node] = dedup(get_schedule_predecessors(graph, node));
+            successors[node] = dedup(get_schedule_successors(graph, node));
+        }
+    }
+};
+
+std::uint64_t get_peak_live_bytes(const Graph* graph, const Schedule& schedule)
+{
+    std::vector<const Node*> nodes;
+    nodes.reserve(schedule.size());
+    for (const std::string& name : schedule) nodes.push_back(graph->get_node_by_name(name));
+    ScheduleNeighbours neighbours(graph, nodes);
+
+    std::unordered_map<const Node*, std::size_t> remaining_users;
+    std::uint64_t live_bytes = 0;
+    std::uint64_t peak_live_bytes = 0;
+    for (const Node* node : nodes)
+    {
+        std::size_t num_users = neighbours.successors.at(node).size();
+        if (num_users > 0)
+        {
+            remaining_users[node] = num_users;
+            live_bytes += get_output_bytes(node);
+        }
+        peak_live_bytes = std::max(peak_live_bytes, live_bytes);
+
+        for (const Node* operand : neighbours.predecessors.at(node))
+        {
+            auto it = remaining_users.find(operand);
+            if (it != remaining_users.end() and --it->second == 0)
+                live_bytes -= get_output_bytes(operand);
+        }
+    }
+    return peak_live_bytes;
+}
+
+Schedule run_memory_pressure_scheduler(const SchedulerConfig& config, const Graph* graph)
+{
+    Schedule reference = optimize_schedule(graph, run_topological_scheduler(graph));
+
+    std::vector<const Node*> nodes;
+    std::unordered_map<const Node*, int> reference_index;
+    std::unordered_map<const Node*, int> phase;
+    nodes.reserve(reference.size());
+    for (const std::string& name : reference)
+    {
+        const Node* node = graph->get_node_by_name(name);
+        auto node_phase = std::make_pair(node->get_epoch_type(), graph->get_subgraph_id_for_node(node->id()));
+        int phase_index = nodes.empty() ? 0 : phase.at(nodes.back());
+        if (not nodes.empty() and
+            node_phase != std::make_pair(nodes.back()->get_epoch_type(), graph->get_subgraph_id_for_node(nodes.back()->id())))
+            phase_index++;
+
+        reference_index[node] = nodes.size();
+        phase[node] = phase_index;
+        nodes.push_back(node);
+    }
+
+    ScheduleNeighbours neighbours(graph, nodes);
+
+    // Extra ordering constraints count as dependencies, but don't keep anything alive
+    std::unordered_map<const Node*, std::vector<const Node*>> dependents;
+    std::unordered_map<const Node*, std::size_t> remaining_dependencies;
+    for (const Node* node : nodes)
+    {
+        for (const Node* predecessor : neighbours.predecessors.at(node))
+            if (reference_index.count(predecessor) > 0)
+                dependents[predecessor].push_back(node);
+    }
+    for (const auto& [consumer, producer] : get_schedule_dependencies(config, graph))
+    {
+        if (not graph->has_node_with_name(consumer) or not graph->has_node_with_name(producer))
+            continue;
+        const Node* consumer_node = graph->get_node_by_name(consumer);
+        const Node* producer_node = graph->get_node_by_name(producer);
+        if (reference_index.count(consumer_node) > 0 and reference_index.count(producer_node) > 0)
+            dependents[producer_node].push_back(consumer_node);
+    }
+    for (auto& [producer, consumers] : dependents)
+    {
+        std::sort(
+            consumers.begin(),
+            consumers.end(),
+            [&reference_index](const Node* a, const Node* b) { return reference_index.at(a) < reference_index.at(b); });
+        consumers.erase(std::unique(consumers.begin(), consumers.end()), consumers.end());
+        for (const Node* consumer : consumers) remaining_dependencies[consumer]++;
+    }
+
+    std::unordered_map<const Node*, std::size_t> remaining_users;
+    for (const Node* node : nodes) remaining_users[node] = neighbours.successors.at(node).size();
+
+    // Change of live bytes if the node were scheduled now
+    auto live_bytes_delta = [&](const Node* node) -> std::int64_t
+    {
+        std::int64_t delta = remaining_users.at(node) > 0 ? get_output_bytes(node) : 0;
+        for (const Node* operand : neighbours.predecessors.at(node))
+        {
+            auto it = remaining_users.find(operand);
+            if (it != remaining_users.end() and it->second == 1)
+                delta -= get_output_bytes(operand);
+        }
+        return delta;
+    };
+
+    std::vector<const Node*> ready;
+    for (const Node* node : nodes)
+        if (remaining_dependencies[node] == 0)
+            ready.push_back(node);
+
+    Schedule schedule;
+    schedule.reserve(nodes.size());
+
+    auto schedule_node = [&](const Node* node)
+    {
+        ready.erase(std::find(ready.begin(), ready.end(), node));
+        schedule.push_back(node->name());
+
+        for (const Node* operand : neighbours.predecessors.at(node))
+        {
+            auto it = remaining_users.find(operand);
+            if (it != remaining_users.end())
+                it->second--;
+        }
+
+        for (const Node* dependent : dependents[node])
+            if (--remaining_dependencies.at(dependent) == 0)
+                ready.push_back(dependent);
+    };
+
+    while (not ready.empty())
+    {
+        auto key = [&](const Node* node)
+        { return std::make_tuple(phase.at(node), live_bytes_delta(node), reference_index.at(node)); };
+
+        const Node* best = *std::min_element(
+            ready.begin(), ready.end(), [&key](const Node* a, const Node* b) { return key(a) < key(b); });
+        schedule_node(best);
+
+        const Node* paired = get_paired_op_if_exists(graph, best);
+        if (paired != nullptr and std::find(ready.begin(), ready.end(), paired) != ready.end())
+            schedule_node(paired);
+    }
+
+    TT_ASSERT(schedule.size() == nodes.size(), "Memory pressure scheduler: ordering constraints contain a cycle");
+    log_debug(
+        LogScheduler,
+        "Memory pressure scheduler: peak live bytes {}, reference schedule {}",
+        get_peak_live_bytes(graph, schedule),
+        get_peak_live_bytes(graph, reference));
+
+    assert_valid_schedule(graph, schedule);
+    return schedule;
+}
+
+}  // namespace tt::scheduler
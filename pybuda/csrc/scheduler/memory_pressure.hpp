@@ -0,0 +1,21 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstdint>
+
+#include "scheduler/scheduler.hpp"
+#include "scheduler/utils.hpp"
+
+namespace tt::scheduler
+{
+
+// Schedule ops so that the peak number of bytes of op outputs waiting for their users is as low as possible
+Schedule run_memory_pressure_scheduler(const SchedulerConfig& config, const graphlib::Graph* graph);
+
+// Peak bytes of op outputs that have been produced, but not yet consumed by all of their users, over the schedule.
+// Operands are freed only after their last user, so its output and theirs count towards the peak together.
+std::uint64_t get_peak_live_bytes(const graphlib::Graph* graph, const Schedule& schedule);
+
+}  // namespace tt::scheduler
@@ -4,6 +4,7 @@ PYBUDA_CSRC_SCHEDULER_LIB = $(LIBDIR)/libscheduler.a
 PYBUDA_CSRC_SCHEDULER_SRCS = \
 	pybuda/csrc/scheduler/scheduler.cpp \
 	pybuda/csrc/scheduler/longest_path.cpp \
+	pybuda/csrc/scheduler/memory_pressure.cpp \
 	pybuda/csrc/scheduler/utils.cpp \
 	pybuda/csrc/scheduler/interactive_scheduler.cpp \
 	pybuda/csrc/scheduler/python_bindings.cpp
@@ -13,6 +13,8 @@ void SchedulerModule(py::module &m_scheduler) {
     py::enum_<SchedulerPolicy>(m_scheduler, "SchedulerPolicy")
         .value("Topological", SchedulerPolicy::Topological)
         .value("ModuleInputsBFS", SchedulerPolicy::ModuleInputsBFS)
+        .value("LongestPath", SchedulerPolicy::LongestPath)
+        .value("MemoryPressure", SchedulerPolicy::MemoryPressure)
         .export_values();
 
     py::class_<SchedulerConfig>(m_scheduler, "SchedulerConfig")
@@ -15,6 +15,7 @@
 #include "graph_lib/utils.hpp"
 #include "placer/lower_to_placer.hpp"
 #include "scheduler/longest_path.hpp"
+#include "scheduler/memory_pressure.hpp"
 #include "utils/logger.hpp"
 
 using tt::LogScheduler;
@@ -44,24 +45,21 @@ static bool requires_visit(const std::unordered_set<NodeId>& visited, NodeId nod
 
 void assert_schedule_dependencies_met(const graphlib::Graph* graph, const Schedule& schedule)
 {
-    std::unordered_map<std::string, std::uint32_t> node_to_schedule_index;
-    node_to_schedule_index.reserve(schedule.size());
-    for (std::uint32_t i = 0; i < schedule.size(); ++i)
-    {
-        node_to_schedule_index[schedule[i]] = i;
-    }
+    NodeSchedule node_schedule = to_node_schedule(graph, schedule);
+    std::unordered_map<NodeId, int> node_to_schedule_index = get_op_to_schedule_index(node_schedule);
 
-    for (const std::string& op : schedule)
+    for (NodeId node_id : node_schedule)
     {
-        Node* node = graph->get_node_by_name(op);
+        Node* node = graph->node_by_id(node_id);
         for (const Node* predecessor_node : get_schedule_predecessors(graph, node))
         {
-            if (node_to_schedule_index.find(predecessor_node->name()) != node_to_schedule_index.end())
+            auto predecessor = node_to_schedule_index.find(predecessor_node->id());
+            if (predecessor != node_to_schedule_index.end())
             {
                 TT_LOG_ASSERT(
-                    node_to_schedule_index[predecessor_node->name()] < node_to_schedule_index[op],
+                    predecessor->second < node_to_schedule_index.at(node_id),
                     "Scheduler: dependency not met for node: {}",
-                    op);
+                    node->name());
             }
         }
     }
@@ -242,7 +240,7 @@ static std::vector<std::vector<std::string>> get_constraints_from_control_edges(
     return partial_orderings;
 }
 
-static std::unordered_map<std::string, std::string> get_schedule_dependencies(
+std::unordered_map<std::string, std::string> get_schedule_dependencies(
     const SchedulerConfig& config, const graphlib::Graph* graph)
 {
     std::unordered_map<std::string, std::string> schedule_dependencies;
@@ -573,48 +571,48 @@ std::unordered_set<NodeId> get_visited_with_recompute_nodes_marked(
 
 std::vector<std::string> get_valid_schedule(const graphlib::Graph* graph, const vector<string>& schedule)
 {
-    std::unordered_map<std::string, int> node_to_schedule_index = get_op_to_schedule_index(schedule);
-    tt::ordered_map<std::string, std::uint32_t> node_to_indegree;
-    for (const std::string& op : schedule)
+    NodeSchedule node_schedule = to_node_schedule(graph, schedule);
+    std::unordered_map<NodeId, int> node_to_schedule_index = get_op_to_schedule_index(node_schedule);
+    std::unordered_map<NodeId, std::uint32_t> node_to_indegree;
+    node_to_indegree.reserve(node_schedule.size());
+    for (NodeId node_id : node_schedule)
     {
         std::uint32_t indegree = 0;
-        Node* node = graph->get_node_by_name(op);
-        for (const Node* predecessor_node : get_schedule_predecessors(graph, node))
+        for (const Node* predecessor_node : get_schedule_predecessors(graph, graph->node_by_id(node_id)))
         {
-            if (node_to_schedule_index.find(predecessor_node->name()) != node_to_schedule_index.end())
+            if (node_to_schedule_index.find(predecessor_node->id()) != node_to_schedule_index.end())
             {
                 indegree += 1;
             }
         }
-        node_to_indegree[op] = indegree;
+        node_to_indegree[node_id] = indegree;
     }
 
-    std::deque<std::string> ops_to_process;
-    for (const std::string& op : schedule)
+    std::deque<NodeId> ops_to_process;
+    for (NodeId node_id : node_schedule)
     {
-        if (node_to_indegree[op] == 0)
+        if (node_to_indegree[node_id] == 0)
         {
-            ops_to_process.push_back(op);
+            ops_to_process.push_back(node_id);
         }
     }
 
-    std::vector<std::string> valid_schedule;
-    valid_schedule.reserve(schedule.size());
+    NodeSchedule valid_schedule;
+    valid_schedule.reserve(node_schedule.size());
     while (not ops_to_process.empty())
     {
-        std::string op = ops_to_process.front();
+        NodeId node_id = ops_to_process.front();
         ops_to_process.pop_front();
-        valid_schedule.push_back(op);
-        Node* node = graph->get_node_by_name(op);
+        valid_schedule.push_back(node_id);
 
-        for (const Node* successor_node : get_schedule_successors(graph, node))
+        for (const Node* successor_node : get_schedule_successors(graph, graph->node_by_id(node_id)))
         {
-            if (node_to_schedule_index.find(successor_node->name()) != node_to_schedule_index.end())
+            if (node_to_schedule_index.find(successor_node->id()) != node_to_schedule_index.end())
             {
-                node_to_indegree[successor_node->name()] -= 1;
-                if (node_to_indegree[successor_node->name()] == 0)
+                node_to_indegree[successor_node->id()] -= 1;
+                if (node_to_indegree[successor_node->id()] == 0)
                 {
-                    ops_to_process.push_back(successor_node->name());
+                    ops_to_process.push_back(successor_node->id());
                 }
             }
         }
@@ -622,7 +620,7 @@ std::vector<std::string> get_valid_schedule(const graphlib::Graph* graph, const
     TT_LOG_ASSERT(
         valid_schedule.size() == schedule.size(), "Valid schedule size does not match original schedule size");
 
-    return valid_schedule;
+    return to_schedule(graph, valid_schedule);
 }
 
 struct BackwardOpInfo
@@ -780,6 +778,8 @@ SchedulerPolicy policy_from_string(const std::string& policy_str)
         return SchedulerPolicy::ModuleInputsBFS;
     } else if (policy_str == "LongestPath") {
         return SchedulerPolicy::LongestPath;
+    } else if (policy_str == "MemoryPressure") {
+        return SchedulerPolicy::MemoryPressure;
     }
 
     log_error(LogScheduler, "Failed to parse scheduler policy from string: {}", policy_str);
@@ -792,6 +792,7 @@ std::ostream& operator<<(std::ostream& stream, SchedulerPolicy scheduler_policy)
         case SchedulerPolicy::Topological: stream << "SchedulerPolicy::Topological"; break;
         case SchedulerPolicy::ModuleInputsBFS: stream << "SchedulerPolicy::ModuleInputsBFS"; break;
         case SchedulerPolicy::LongestPath: stream << "SchedulerPolicy::LongestPath"; break;
+        case SchedulerPolicy::MemoryPressure: stream << "SchedulerPolicy::MemoryPressure"; break;
         default: stream << "SchedulerPolicy::Unknown"; break;
     }
     return stream;
@@ -826,6 +827,10 @@ Schedule run_scheduler(const SchedulerConfig& config, const graphlib::Graph* gra
     {
         schedule = run_longest_path_scheduler(graph);
     }
+    else if (config.policy == SchedulerPolicy::MemoryPressure)
+    {
+        schedule = run_memory_pressure_scheduler(config, graph);
+    }
     else
     {
         log_fatal("providing unknown scheduler policy.");
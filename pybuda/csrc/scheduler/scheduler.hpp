@@ -32,6 +32,7 @@ enum SchedulerPolicy
     Topological,
     ModuleInputsBFS,
     LongestPath,
+    MemoryPressure,
 };
 
 struct SchedulerConfig
@@ -66,5 +67,12 @@ Schedule run_scheduler(const SchedulerConfig& config, const graphlib::Graph* gra
 Schedule run_topological_scheduler(const graphlib::Graph* graph);
 Schedule run_module_by_module_scheduler(const SchedulerConfig& config, const graphlib::Graph* graph);
 
+// Helpers shared by the scheduler implementations
+std::unordered_map<std::string, std::string> get_schedule_dependencies(
+    const SchedulerConfig& config, const graphlib::Graph* graph);
+const graphlib::Node* get_paired_op_if_exists(const graphlib::Graph* graph, const graphlib::Node* parrent_node);
+std::vector<std::string> optimize_schedule(const graphlib::Graph* graph, const std::vector<std::string>& scheduled_ops);
+void assert_valid_schedule(const graphlib::Graph* graph, const Schedule& schedule);
+
 } // end namespace scheduler
 } // end namespace tt
@@ -85,6 +85,39 @@ const std::vector<const graphlib::Node*> get_schedule_successors(
     return successors;
 }
 
+NodeSchedule to_node_schedule(const graphlib::Graph* graph, const Schedule& schedule)
+{
+    NodeSchedule node_schedule;
+    node_schedule.reserve(schedule.size());
+    for (const std::string& node_name : schedule)
+    {
+        node_schedule.push_back(graph->get_node_by_name(node_name)->id());
+    }
+    return node_schedule;
+}
+
+Schedule to_schedule(const graphlib::Graph* graph, const NodeSchedule& node_schedule)
+{
+    Schedule schedule;
+    schedule.reserve(node_schedule.size());
+    for (graphlib::NodeId node_id : node_schedule)
+    {
+        schedule.push_back(graph->node_by_id(node_id)->name());
+    }
+    return schedule;
+}
+
+std::unordered_map<graphlib::NodeId, int> get_op_to_schedule_index(const NodeSchedule& scheduled_ops)
+{
+    std::unordered_map<graphlib::NodeId, int> op_to_schedule_index;
+    op_to_schedule_index.reserve(scheduled_ops.size());
+    for (int i = 0; i < (int)scheduled_ops.size(); ++i)
+    {
+        op_to_schedule_index[scheduled_ops[i]] = i;
+    }
+    return op_to_schedule_index;
+}
+
 std::unordered_map<std::string, int> get_op_to_schedule_index(const Schedule& scheduled_ops)
 {
     std::unordered_map<std::string, int> op_to_schedule_index;
@@ -121,30 +154,23 @@ Schedule get_filtered_schedule(const graphlib::Graph* graph, const Schedule& sch
 
 bool are_schedule_dependencies_met(const graphlib::Graph* graph, const std::vector<std::string>& schedule)
 {
-    std::unordered_map<std::string, std::uint32_t> node_to_schedule_index;
-    node_to_schedule_index.reserve(schedule.size());
-    for (std::uint32_t i = 0; i < schedule.size(); ++i)
-    {
-        node_to_schedule_index[schedule[i]] = i;
-    }
+    NodeSchedule node_schedule = to_node_schedule(graph, schedule);
+    std::unordered_map<graphlib::NodeId, int> node_to_schedule_index = get_op_to_schedule_index(node_schedule);
 
-    for (const std::string& op : schedule)
+    for (graphlib::NodeId node_id : node_schedule)
     {
-        graphlib::Node* node = graph->get_node_by_name(op);
-        for (const graphlib::Edge& operand_edge : graph->operand_data_edges(node))
+        for (const graphlib::Edge& operand_edge : graph->operand_data_edges(graph->node_by_id(node_id)))
         {
-            graphlib::Node* predecessor_node = graph->node_by_id(operand_edge.producer_node_id);
-            if (node_to_schedule_index.find(predecessor_node->name()) != node_to_schedule_index.end())
+            auto predecessor = node_to_schedule_index.find(operand_edge.producer_node_id);
+            if (predecessor != node_to_schedule_index.end() and
+                predecessor->second > node_to_schedule_index.at(node_id))
             {
-                if (node_to_schedule_index[predecessor_node->name()] > node_to_schedule_index[op])
-                {
-                    log_warning(
-                        LogPlacer,
-                        "Scheduler: dependency not met for node: {}: {} should come before",
-                        op,
-                        predecessor_node->name());
-                    return false;
-                }
+                log_warning(
+                    LogPlacer,
+                    "Scheduler: dependency not met for node: {}: {} should come before",
+                    graph->node_by_id(node_id)->name(),
+                    graph->node_by_id(operand_edge.producer_node_id)->name());
+                return false;
             }
         }
     }
@@ -26,6 +26,13 @@ namespace scheduler
 
 using Schedule = std::vector<std::string>;
 
+// Schedule of interned node ids. Used internally so that hot loops hash integers instead of op names; names are only
+// needed at the python and netlist boundaries.
+using NodeSchedule = std::vector<graphlib::NodeId>;
+
+NodeSchedule to_node_schedule(const graphlib::Graph* graph, const Schedule& schedule);
+Schedule to_schedule(const graphlib::Graph* graph, const NodeSchedule& node_schedule);
+
 void log_schedule(const Schedule& schedule);
 bool can_schedule_node(const graphlib::Node* node);
 const std::vector<const graphlib::Node*> get_schedule_predecessors(
@@ -34,6 +41,7 @@ const std::vector<const graphlib::Node*> get_schedule_successors(
     const graphlib::Graph* graph, const graphlib::Node* node);
 
 std::unordered_map<std::string, int> get_op_to_schedule_index(const Schedule& scheduled_ops);
+std::unordered_map<graphlib::NodeId, int> get_op_to_schedule_index(const NodeSchedule& scheduled_ops);
 Schedule get_filtered_schedule(const graphlib::Graph* graph, const Schedule& schedule, graphlib::NodeEpochType type);
 bool are_schedule_dependencies_met(const graphlib::Graph* graph, const Schedule& schedule);
 
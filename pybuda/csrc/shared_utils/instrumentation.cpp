@@ -0,0 +1,284 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "shared_utils/instrumentation.hpp"
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "fmt/core.h"
+#include "shared_utils/pretty_table.hpp"
+#include "third_party/json/json.hpp"
+#include "utils/assert.hpp"
+
+namespace tt::instrumentation
+{
+
+using Clock = std::chrono::steady_clock;
+using json = nlohmann::json;
+
+namespace
+{
+
+struct Event
+{
+    std::string name;
+    std::string category;
+    int tid = 0;
+    std::int64_t start_us = 0;
+    std::int64_t duration_us = -1;  // -1 while the event is still open
+    std::int64_t rss_start_kb = 0;
+    std::int64_t rss_end_kb = 0;
+
+    // Counter values in registration order, counters registered in the meantime are missing from the start snapshot
+    std::vector<std::int64_t> counters_start;
+    std::vector<std::int64_t> counters_end;
+
+    bool open() const { return duration_us < 0; }
+};
+
+struct Registry
+{
+    std::mutex mutex;
+    std::map<std::string, std::atomic<std::int64_t>> counters;
+    std::vector<std::pair<std::string const *, std::atomic<std::int64_t> *>> counter_order;
+    std::vector<Event> events;
+    std::unordered_map<std::thread::id, int> thread_ids;
+    std::uint32_t generation = 0;
+    Clock::time_point epoch = Clock::now();
+
+    // Callers hold the mutex
+    std::int64_t now_us() const
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - epoch).count();
+    }
+
+    int thread_id()
+    {
+        return thread_ids.try_emplace(std::this_thread::get_id(), int(thread_ids.size())).first->second;
+    }
+
+    std::vector<std::int64_t> snapshot() const
+    {
+        std::vector<std::int64_t> values;
+        values.reserve(counter_order.size());
+        for (auto const &[name, value] : counter_order) values.push_back(value->load(std::memory_order_relaxed));
+        return values;
+    }
+};
+
+Registry &registry()
+{
+    // Never destroyed, counters are referenced from function-local statics that outlive any static destructor order
+    static Registry *instance = new Registry();
+    return *instance;
+}
+
+std::int64_t counter_delta(Event const &event, std::size_t index)
+{
+    std::int64_t start = index < event.counters_start.size() ? event.counters_start[index] : 0;
+    return event.counters_end[index] - start;
+}
+
+}  // namespace
+
+std::atomic<std::int64_t> &counter(std::string const &name)
+{
+    Registry &r = registry();
+    std::scoped_lock lock(r.mutex);
+    auto [it, inserted] = r.counters.try_emplace(name, 0);
+    if (inserted)
+        r.counter_order.emplace_back(&it->first, &it->second);
+    return it->second;
+}
+
+std::int64_t counter_value(std::string const &name)
+{
+    Registry &r = registry();
+    std::scoped_lock lock(r.mutex);
+    auto it = r.counters.find(name);
+    return it == r.counters.end() ? 0 : it->second.load(std::memory_order_relaxed);
+}
+
+std::int64_t rss_kb()
+{
+    std::ifstream statm("/proc/self/statm");
+    std::int64_t size = 0, resident = 0;
+    if (not(statm >> size >> resident))
+        return 0;
+    return resident * sysconf(_SC_PAGESIZE) / 1024;
+}
+
+std::uint64_t begin_event(std::string const &name, std::string const &category)
+{
+    std::int64_t rss = rss_kb();
+
+    Registry &r = registry();
+    std::scoped_lock lock(r.mutex);
+    Event &event = r.events.emplace_back();
+    event.name = name;
+    event.category = category;
+    event.tid = r.thread_id();
+    event.rss_start_kb = rss;
+    event.counters_start = r.snapshot();
+    event.start_us = r.now_us();
+    return (std::uint64_t(r.generation) << 32) | (r.events.size() - 1);
+}
+
+void end_event(std::uint64_t event_id)
+{
+    std::int64_t rss = rss_kb();
+
+    Registry &r = registry();
+    std::scoped_lock lock(r.mutex);
+    std::size_t index = event_id & 0xffffffff;
+    if ((event_id >> 32) != r.generation or index >= r.events.size() or not r.events[index].open())
+        return;
+
+    Event &event = r.events[index];
+    event.duration_us = r.now_us() - event.start_us;
+    event.rss_end_kb = rss;
+    event.counters_end = r.snapshot();
+}
+
+void reset()
+{
+    Registry &r = registry();
+    std::scoped_lock lock(r.mutex);
+    r.events.clear();
+    r.generation++;
+    r.epoch = Clock::now();
+    for (auto &[name, value] : r.counters) value.store(0, std::memory_order_relaxed);
+}
+
+std::string chrome_trace_json()
+{
+    Registry &r = registry();
+    std::scoped_lock lock(r.mutex);
+
+    int pid = getpid();
+    json trace_events = json::array();
+    for (Event const &event : r.events)
+    {
+        json e = {
+            {"name", event.name},
+            {"cat", event.category},
+            {"pid", pid},
+            {"tid", event.tid},
+            {"ts", event.start_us},
+        };
+        if (event.open())
+        {
+            e["ph"] = "B";
+            trace_events.push_back(e);
+            continue;
+        }
+
+        json args = {{"rss_start_kb", event.rss_start_kb}, {"rss_end_kb", event.rss_end_kb}};
+        json counters = json::object();
+        for (std::size_t i = 0; i < event.counters_end.size(); ++i)
+        {
+            std::int64_t delta = counter_delta(event, i);
+            if (delta != 0)
+                args[*r.counter_order[i].first] = delta;
+            counters[*r.counter_order[i].first] = event.counters_end[i];
+        }
+        e["ph"] = "X";
+        e["dur"] = event.duration_us;
+        e["args"] = args;
+        trace_events.push_back(e);
+
+        // Counter tracks, sampled whenever a scope closes
+        std::int64_t end_us = event.start_us + event.duration_us;
+        trace_events.push_back(
+            {{"name", "rss_kb"}, {"ph", "C"}, {"pid", pid}, {"ts", end_us}, {"args", {{"rss_kb", event.rss_end_kb}}}});
+        if (not counters.empty())
+            trace_events.push_back({{"name", "counters"}, {"ph", "C"}, {"pid", pid}, {"ts", end_us}, {"args", counters}});
+    }
+
+    json trace = {{"traceEvents", trace_events}, {"displayTimeUnit", "ms"}};
+    return trace.dump();
+}
+
+void write_chrome_trace(std::string const &path)
+{
+    std::string trace = chrome_trace_json();
+    std::ofstream out(path);
+    TT_LOG_ASSERT(out.is_open(), "Can't open compile trace file for writing: {}", path);
+    out << trace;
+}
+
+std::string summary_table()
+{
+    struct Summary
+    {
+        std::string name;
+        std::string category;
+        int calls = 0;
+        std::int64_t total_us = 0;
+        std::int64_t max_us = 0;
+        std::int64_t max_rss_growth_kb = 0;
+    };
+
+    std::vector<Summary> scopes;
+    std::vector<std::pair<std::string, std::int64_t>> counters;
+    {
+        Registry &r = registry();
+        std::scoped_lock lock(r.mutex);
+
+        // In order of first appearance, which roughly follows the compile flow
+        std::map<std::pair<std::string, std::string>, std::size_t> scope_index;
+        for (Event const &event : r.events)
+        {
+            if (event.open())
+                continue;
+            auto [it, inserted] = scope_index.try_emplace({event.category, event.name}, scopes.size());
+            if (inserted)
+                scopes.push_back(Summary{event.name, event.category});
+
+            Summary &summary = scopes[it->second];
+            summary.calls++;
+            summary.total_us += event.duration_us;
+            summary.max_us = std::max(summary.max_us, event.duration_us);
+            summary.max_rss_growth_kb = std::max(summary.max_rss_growth_kb, event.rss_end_kb - event.rss_start_kb);
+        }
+
+        for (auto const &[name, value] : r.counter_order)
+            counters.emplace_back(*name, value->load(std::memory_order_relaxed));
+    }
+
+    auto ms = [](std::int64_t us) { return fmt::format("{:.1f}", us / 1000.0); };
+
+    tt::utils::PrettyTable scope_table;
+    scope_table.add_row({"Scope", "Category", "Calls", "Total (ms)", "Max (ms)", "Max RSS growth (KB)"});
+    for (Summary const &summary : scopes)
+        scope_table.add_row(
+            {summary.name,
+             summary.category,
+             std::to_string(summary.calls),
+             ms(summary.total_us),
+             ms(summary.max_us),
+             std::to_string(summary.max_rss_growth_kb)});
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    tt::utils::PrettyTable counter_table;
+    counter_table.add_row({"Counter", "Value"});
+    for (auto const &[name, value] : counters) counter_table.add_row({name, std::to_string(value)});
+    counter_table.add_divider();
+    counter_table.add_row({"rss_kb", std::to_string(rss_kb())});
+    counter_table.add_row({"peak_rss_kb", std::to_string(usage.ru_maxrss)});
+
+    return scope_table.generate_table_string() + "\n" + counter_table.generate_table_string();
+}
+
+}  // namespace tt::instrumentation
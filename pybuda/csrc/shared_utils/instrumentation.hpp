@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+//
+// Compile-time instrumentation, always on. Scopes record wall time and RSS around passes and balancer phases,
+// counters track graph size, op models, constraint cache hits etc. Everything recorded since the last reset() can be
+// exported as Chrome trace JSON (chrome://tracing, ui.perfetto.dev) or summarized as a table.
+//
+// Scopes are meant for coarse-grained phases, each one reads /proc/self/statm and snapshots the counters. Counters are
+// relaxed atomics and can be bumped from hot loops, although accumulating locally and adding once is still cheaper.
+//
+namespace tt::instrumentation
+{
+
+// Process-wide counter, created on first use. The reference stays valid for the lifetime of the process.
+std::atomic<std::int64_t> &counter(std::string const &name);
+std::int64_t counter_value(std::string const &name);
+
+// Resident set size of the process
+std::int64_t rss_kb();
+
+// Events can also be opened and closed explicitly, i.e. from python. Ids of events recorded before the last reset()
+// are ignored.
+std::uint64_t begin_event(std::string const &name, std::string const &category);
+void end_event(std::uint64_t event_id);
+
+class ScopedTimer
+{
+   public:
+    ScopedTimer(std::string const &name, std::string const &category = "pass") :
+        event_id_(begin_event(name, category))
+    {
+    }
+    ~ScopedTimer() { end_event(event_id_); }
+
+    ScopedTimer(ScopedTimer const &) = delete;
+    ScopedTimer &operator=(ScopedTimer const &) = delete;
+
+   private:
+    std::uint64_t event_id_;
+};
+
+// Drop all recorded events and zero the counters
+void reset();
+
+std::string chrome_trace_json();
+void write_chrome_trace(std::string const &path);
+
+// Per-scope calls, total/max time and RSS growth, followed by the counter values
+std::string summary_table();
+
+}  // namespace tt::instrumentation
+
+#define INSTRUMENT_CONCAT_INNER(a, b) a##b
+#define INSTRUMENT_CONCAT(a, b) INSTRUMENT_CONCAT_INNER(a, b)
+
+#define INSTRUMENT_SCOPE(...) \
+    ::tt::instrumentation::ScopedTimer INSTRUMENT_CONCAT(tt_instrument_scope_, __COUNTER__)(__VA_ARGS__)
+
+// The counter is looked up once per call site, so name has to be the same every time the site runs
+#define INSTRUMENT_COUNTER_ADD(name, value)                                                                  \
+    do                                                                                                       \
+    {                                                                                                        \
+        static std::atomic<std::int64_t> &tt_instrument_counter = ::tt::instrumentation::counter(name);      \
+        tt_instrument_counter.fetch_add(static_cast<std::int64_t>(value), std::memory_order_relaxed);        \
+    } while (0)
+
+#define INSTRUMENT_COUNTER_SET(name, value)                                                                  \
+    do                                                                                                       \
+    {                                                                                                        \
+        static std::atomic<std::int64_t> &tt_instrument_counter = ::tt::instrumentation::counter(name);      \
+        tt_instrument_counter.store(static_cast<std::int64_t>(value), std::memory_order_relaxed);            \
+    } while (0)
@@ -2,6 +2,7 @@
 
 PYBUDA_CSRC_SHARED_UTILS_LIB = $(LIBDIR)/libsharedutils.a
 PYBUDA_CSRC_SHARED_UTILS_SRCS += \
+	pybuda/csrc/shared_utils/instrumentation.cpp \
 	pybuda/csrc/shared_utils/placement_printer.cpp \
 	pybuda/csrc/shared_utils/pretty_table.cpp \
 	pybuda/csrc/shared_utils/sparse_matmul_utils.cpp
@@ -1,4 +1,4 @@
-from . import autograd as autograd, backend_api as backend_api, balancer as balancer, graph as graph, pattern_matcher as pattern_matcher, scheduler as scheduler, torch_device as torch_device
+from . import autograd as autograd, backend_api as backend_api, balancer as balancer, graph as graph, instrumentation as instrumentation, pattern_matcher as pattern_matcher, scheduler as scheduler, torch_device as torch_device
 from typing import ClassVar, Dict, List, Optional, Tuple, Union
 
 Backward: NodeEpochType
@@ -62,6 +62,7 @@ class Blocks:
 class BudaNetlist:
     def __init__(self) -> None: ...
     def append_comment(self, arg0: str) -> None: ...
+    def dump_to_file(self, filename: str, parallel_graphs: bool = ...) -> None: ...
     def dump_to_yaml(self) -> str: ...
 
 class BudaNetlistConfig:
@@ -202,6 +203,7 @@ def compress_sparse_tensor_and_strip_info(arg0: List[SparseCOO], arg1: int, arg2
 def dump_epoch_id_graphs(graph: graph.Graph, test_name: str, graph_name: str, placer_solution: placer.PlacerSolution, balancer_solution: balancer.BalancerSolution = ...) -> None: ...
 def dump_epoch_type_graphs(graph: graph.Graph, test_name: str, graph_name: str, placer_solution: placer.PlacerSolution = ..., balancer_solution: balancer.BalancerSolution = ...) -> None: ...
 def dump_graph(graph: graph.Graph, test_name: str, graph_name: str, placer_solution: placer.PlacerSolution = ..., balancer_solution: balancer.BalancerSolution = ...) -> None: ...
+def flush_reportify_dumps() -> None: ...
 def is_subset_of_instructions(ins_instructions: Dict[Tuple[str, str, int, int, bool], InsertionInstruction] = ..., previous_instructions: Dict[Tuple[str, str, int, int, bool], InsertionInstruction] = ...) -> Tuple[bool, int, int]: ...
 def link_past_cache_ios(arg0: graph.Graph) -> Dict[str, int]: ...
 def lower_to_buda_netlist(graph: graph.Graph, graph_name: str, placer_solution: placer.PlacerSolution, balancer_solution: balancer.BalancerSolution, chip_ids: List[int], device_config: backend_api.DeviceConfig, enable_forked_dram_inputs: bool = ...) -> BudaNetlist: ...
@@ -216,4 +218,4 @@ def run_post_optimize_decompose_graph_passes(arg0: graph.Graph, arg1: object) ->
 def run_post_placer_buda_passes(arg0: graph.Graph, arg1: str, arg2: backend_api.DeviceConfig, arg3: placer.PlacerSolution, arg4: PostPlacerConfig, arg5: balancer.BalancerSolution, arg6: Dict[Tuple[str, str, int, int, bool], InsertionInstruction], arg7: List[List[Blocks]], arg8: int) -> PostPlacerResults: ...
 def run_pre_lowering_passes(arg0: graph.Graph) -> None: ...
 def run_pre_netlist_generation_buda_passes(arg0: graph.Graph, arg1: str, arg2: backend_api.DeviceConfig, arg3: Dict[str, object], arg4: placer.PlacerSolution, arg5: PostPlacerConfig, arg6: balancer.BalancerSolution, arg7: List[List[Blocks]], arg8: int) -> None: ...
-def run_pre_placer_buda_passes(graph: graph.Graph, scheduler_config: scheduler.SchedulerConfig, device_config: backend_api.DeviceConfig, chip_ids: List[int] = ..., op_names_to_chip_break: List[Union[List[Union[str, graph.query.NodePredicate]], graph.query.NodePredicate]] = ..., op_names_to_epoch_break: List[Union[List[Union[str, graph.query.NodePredicate]], graph.query.NodePredicate]] = ..., op_names_dont_fuse: List[str] = ..., op_names_manual_fuse: List[str] = ..., fracture_chip_id_assignments: Dict[str, int] = ..., default_df_override: Optional[DataFormat] = ..., default_accumulate_df: Optional[DataFormat] = ..., enable_broadcast_splitting: bool = ..., fp32_fallback: DataFormat = ..., default_math_fidelity: MathFidelity = ..., enable_auto_fusing: bool = ..., amp_level: int = ..., enable_recompute: bool = ..., output_queues_on_host: bool = ..., ins_instructions: Dict[Tuple[str, str, int, int, bool], InsertionInstruction] = ..., insert_queues: List[Tuple[str, str, int]] = ..., amp_properties=..., op_intermediates_to_save: List[str] = ..., use_interactive_placer: bool = ..., enable_device_tilize: bool = ...) -> Tuple[graph.Graph, placer.PlacerConfigUpdate]: ...
+def run_pre_placer_buda_passes(graph: graph.Graph, scheduler_config: scheduler.SchedulerConfig, device_config: backend_api.DeviceConfig, chip_ids: List[int] = ..., op_names_to_chip_break: List[Union[List[Union[str, graph.query.NodePredicate]], graph.query.NodePredicate]] = ..., op_names_to_epoch_break: List[Union[List[Union[str, graph.query.NodePredicate]], graph.query.NodePredicate]] = ..., op_names_dont_fuse: List[str] = ..., op_names_manual_fuse: List[str] = ..., fracture_chip_id_assignments: Dict[str, int] = ..., default_df_override: Optional[DataFormat] = ..., default_accumulate_df: Optional[DataFormat] = ..., enable_broadcast_splitting: bool = ..., fp32_fallback: DataFormat = ..., default_math_fidelity: MathFidelity = ..., enable_auto_fusing: bool = ..., amp_level: int = ..., enable_recompute: bool = ..., output_queues_on_host: bool = ..., ins_instructions: Dict[Tuple[str, str, int, int, bool], InsertionInstruction] = ..., insert_queues: List[Tuple[str, str, int]] = ..., amp_properties=..., op_intermediates_to_save: List[str] = ..., use_interactive_placer: bool = ..., enable_device_tilize: bool = ..., chip_placement_policy: balancer.ChipPlacementPolicy = ...) -> Tuple[graph.Graph, placer.PlacerConfigUpdate]: ...
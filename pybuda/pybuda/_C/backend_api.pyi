@@ -1,6 +1,6 @@
 import pybuda._C
 from _typeshed import Incomplete
-from typing import ClassVar, Dict, List, Tuple, overload
+from typing import ClassVar, Dict, List, Optional, Tuple, overload
 
 class BackendApi:
     def __init__(self, arg0: str, arg1: BackendConfig) -> None: ...
@@ -127,6 +127,10 @@ class BackendType:
     @property
     def value(self) -> int: ...
 
+class CommandLoopOutputs:
+    def __init__(self, *args, **kwargs) -> None: ...
+    def get(self, group: int, iteration: int) -> List[PytorchTensorDesc]: ...
+
 class DeviceConfig:
     @overload
     def __init__(self, arg0: str, arg1: str, arg2: str, arg3: str, arg4: str, arg5: bool, arg6: List[int]) -> None: ...
@@ -235,6 +239,28 @@ class IOType:
     @property
     def value(self) -> int: ...
 
+class LoopSchedule:
+    final_steps: List[LoopStep]
+    loop_count: int
+    max_inflight: int
+    steps: List[LoopStep]
+    def __init__(self) -> None: ...
+
+class LoopStep:
+    def __init__(self, *args, **kwargs) -> None: ...
+    @staticmethod
+    def pop_outputs(group: int) -> LoopStep: ...
+    @staticmethod
+    def push_inputs(group: int) -> LoopStep: ...
+    @staticmethod
+    def run_program(program: str, params: Dict[str, str] = ...) -> LoopStep: ...
+    @property
+    def group(self) -> int: ...
+    @property
+    def params(self) -> Dict[str, str]: ...
+    @property
+    def program(self) -> str: ...
+
 class OpModelDesc:
     approx_mode: bool
     arch: str
@@ -269,6 +295,18 @@ class PytorchTensorDesc:
     def __init__(self, arg0: capsule, arg1: int, arg2: pybuda._C.DataFormat, arg3: int, arg4: List[int[4]], arg5: List[int[4]]) -> None: ...
     def print(self) -> None: ...
 
+class ShmRingBuffer:
+    def __init__(self, name: str, capacity: int) -> None: ...
+    def empty(self) -> bool: ...
+    def fits(self, arg0: bytes, arg1: List[Tuple[int, int]]) -> bool: ...
+    def read(self, timeout_ms: int = ...) -> Optional[Tuple[bytes, List[memoryview]]]: ...
+    def release(self) -> None: ...
+    def write(self, header: bytes, buffers: List[Tuple[int, int]], timeout_ms: int = ...) -> bool: ...
+    @property
+    def capacity(self) -> int: ...
+    @property
+    def name(self) -> str: ...
+
 class StrideDescriptor:
     stride: int
     xy_offsets: List[Tuple[int, int]]
@@ -313,5 +351,6 @@ def push_input(arg0: DramIODesc, arg1: PytorchTensorDesc, arg2: bool, arg3: int,
 @overload
 def push_input(arg0: DramIODesc, arg1: TilizedTensorDesc, arg2: int, arg3: int) -> BackendStatusCode: ...
 def release_backend_ptr(arg0: BackendApi) -> None: ...
+def run_command_loop(backend: BackendApi, schedule: LoopSchedule, input_queues: List[List[DramIODesc]], inputs: List[List[List[PytorchTensorDesc]]], output_queues: List[List[DramIODesc]], timeout_secs: int = ...) -> CommandLoopOutputs: ...
 def tilize_tensor(arg0: DramIODesc, arg1: PytorchTensorDesc) -> TilizedTensorDesc: ...
 def translate_addresses(arg0: DramIODesc) -> BackendStatusCode: ...
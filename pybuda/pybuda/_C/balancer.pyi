@@ -10,6 +10,7 @@ CNN: PolicyType
 CZ: TStreamDir
 ConsumerOperandDataEdgesFirst: GraphSolverSelfCutType
 FastCut: GraphSolverSelfCutType
+MIN_TRAFFIC: ChipPlacementPolicy
 MMIO_LAST: ChipPlacementPolicy
 MinimizeGrid: PolicyType
 NLP: PolicyType
@@ -44,6 +45,7 @@ class BalancerConfig:
     skip_l1_usage_validation: bool
     target_cycles_offset: int
     use_interactive_placer: bool
+    user_op_names_to_chip_break: Optional[List[List[str]]]
     def __init__(self, device_config, scheduler_config: pybuda._C.scheduler.SchedulerConfig, policy_type: PolicyType = ..., random_policy_seed: int = ..., chip_ids: List[int] = ..., chip_placement_policy: ChipPlacementPolicy = ..., default_dram_parameters: bool = ..., skip_l1_usage_validation: bool = ..., enable_t_streaming: bool = ..., manual_t_streaming: bool = ..., input_queues_on_host: bool = ..., output_queues_on_host: bool = ..., op_overrides: Dict[str, OpOverride] = ..., op_names_to_epoch_break: List[List[str]] = ..., op_names_to_chip_break: List[List[str]] = ..., op_names_to_chip_id_assignment: Dict[str, int] = ..., op_name_to_placer_overrides: Dict[str, pybuda._C.placer.OpOverride] = ..., enable_auto_transposing_placement: bool = ..., graph_solver_self_cut_type: GraphSolverSelfCutType = ..., use_interactive_placer: bool = ..., enable_enumerate_u_kt: bool = ..., enable_single_buffer_fallback: bool = ...) -> None: ...
 
 class BalancerSolution:
@@ -81,6 +83,7 @@ class BufferModel:
 
 class ChipPlacementPolicy:
     __members__: ClassVar[dict] = ...  # read-only
+    MIN_TRAFFIC: ClassVar[ChipPlacementPolicy] = ...
     MMIO_LAST: ClassVar[ChipPlacementPolicy] = ...
     SNAKE: ClassVar[ChipPlacementPolicy] = ...
     __entries: ClassVar[dict] = ...
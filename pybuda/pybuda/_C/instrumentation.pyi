@@ -0,0 +1,10 @@
+def begin_event(name: str, category: str = ...) -> int: ...
+def chrome_trace_json() -> str: ...
+def counter_add(name: str, value: int = ...) -> None: ...
+def counter_set(arg0: str, arg1: int) -> None: ...
+def counter_value(arg0: str) -> int: ...
+def end_event(arg0: int) -> None: ...
+def reset() -> None: ...
+def rss_kb() -> int: ...
+def summary_table() -> str: ...
+def write_chrome_trace(arg0: str) -> None: ...
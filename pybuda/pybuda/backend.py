@@ -3,6 +3,7 @@
 # SPDX-License-Identifier: Apache-2.0
 # Backend API wrapper
 
+import os
 import threading
 import queue
 import time
@@ -18,7 +19,8 @@ from loguru import logger
 import pybuda
 from .pybudaglobal import TILE_DIM
 from pybuda._C import DataFormat
-from pybuda._C.backend_api import BackendType, BackendDevice, BackendApi, BackendConfig, DramIODesc, PytorchTensorDesc, TilizedTensorDesc, BackendStatusCode, BackendCompileResult, clear_backend_param_cache, release_backend_ptr, push_input, pop_output, get_output, translate_addresses, free_tensor, DeviceMode, debinarize_tensor
+from pybuda._C.backend_api import BackendType, BackendDevice, BackendApi, BackendConfig, DramIODesc, PytorchTensorDesc, TilizedTensorDesc, BackendStatusCode, BackendCompileResult, clear_backend_param_cache, release_backend_ptr, push_input, pop_output, get_output, translate_addresses, free_tensor, DeviceMode, debinarize_tensor, tilize_tensors
+from pybuda._C.backend_api import CommandLoopOutputs, LoopSchedule, LoopStep, run_command_loop
 from pybuda._C.graph import Graph, get_constant_input_value, get_optimizer_param_info, RuntimeTensorTransform, RuntimeTensorTransformType
 from pybuda._C.balancer import OutputHostTM
 from .tensor import Tensor, consteval_input, pytorch_tensor_to_tensor_desc, pad_pytorch_tensor_to_buda, tensor_desc_to_pytorch_tensor, get_device_constant_and_parameters, const_eval_tensor
@@ -247,6 +249,26 @@ class BackendAPI:
         if self.explicit_barrier_between_programs:
             assert self.be_api.wait_for_idle() == BackendStatusCode.Success, "Failed while waiting for idle"
 
+    def run_forward_loop(self, input_queues: List[DramIODesc], inputs: List[List[PytorchTensorDesc]], output_queues: List[DramIODesc]) -> CommandLoopOutputs:
+        """
+        Push inputs, run the forward program and read outputs for each set of inputs, in a single native command loop.
+        Returned outputs are copies, the output queues have already been popped.
+        """
+        assert self.be_api
+        if self.feeder_thread_queue:
+            self.sync() # programs queued up on the feeder thread have to run first
+
+        schedule = LoopSchedule()
+        schedule.steps = [
+            LoopStep.push_inputs(0),
+            LoopStep.run_program("run_fwd_" + f"{self.device.get_active_subgraph()}", {"$p_loop_count": "1"}),
+            LoopStep.pop_outputs(0),
+        ]
+        schedule.loop_count = len(inputs)
+        # Microbatches the device can run ahead of the host reading outputs, bounded by the output queue size
+        schedule.max_inflight = int(os.environ.get("PYBUDA_NATIVE_COMMAND_LOOP_INFLIGHT", "1"))
+        return run_command_loop(self.be_api, schedule, [input_queues], [inputs], [output_queues])
+
     def _step_schedulers(self):
         if hasattr(self.device, "scheduler") and self.device.scheduler is not None:
             self.device.scheduler.step()
@@ -315,11 +337,7 @@ class BackendAPI:
         clone: bool = False,
         has_microbatch_dim: bool = True
     ) -> List[Tensor]:
-        ret = []
-        tensors = []
         out_descs = []
-        if runtime_tensor_transforms is None:
-            runtime_tensor_transforms = [None] * len(queues)
         for i, outq in enumerate(queues):
             logger.debug("Reading output queue {}", outq.name)
             out_desc = PytorchTensorDesc()
@@ -339,9 +357,28 @@ class BackendAPI:
 
             assert resp == BackendStatusCode.Success, "Error while reading output"
             cls._capture_tensor(out_desc, outq)
-            tensors.append(Tensor.create_from_tensor_descriptor(out_desc))
             out_descs.append(out_desc)
 
+        return cls.convert_outputs(out_descs, original_shapes, runtime_tensor_transforms, requires_grad, clone=clone, has_microbatch_dim=has_microbatch_dim)
+
+    @classmethod
+    def convert_outputs(
+        cls,
+        out_descs: List[PytorchTensorDesc],
+        original_shapes: List[Tuple[int, ...]],
+        runtime_tensor_transforms: Optional[List[RuntimeTensorTransform]],
+        requires_grad: List[bool],
+        clone: bool = False,
+        has_microbatch_dim: bool = True
+    ) -> List[Tensor]:
+        """
+        Turn descriptors read from the output queues into tensors of the original output shapes
+        """
+        ret = []
+        tensors = [Tensor.create_from_tensor_descriptor(out_desc) for out_desc in out_descs]
+        if runtime_tensor_transforms is None:
+            runtime_tensor_transforms = [None] * len(out_descs)
+
         concat_transforms = [transform for transform in runtime_tensor_transforms if transform is not None and transform.type == RuntimeTensorTransformType.Concatenate]
         if len(concat_transforms) > 0:
             def get_index(transform):
@@ -417,6 +454,10 @@ class BackendAPI:
     @classmethod
     def push_to_queues(cls, ordered_input_queues: List[DramIODesc], tensors: List[PytorchTensorDesc], single_input: bool):
         assert len(tensors) == len(ordered_input_queues), "Incorrect number of tensors provided on input"
+        if cls._parallel_host_tilize_threads() is not None and len(tensors) > 1:
+            cls._push_tilized_to_queues(ordered_input_queues, tensors, single_input)
+            return
+
         for i, inq in enumerate(ordered_input_queues):
             logger.debug("Pushing to queue {}", inq.name)
             logger.trace(tensors[i].shape)
@@ -424,6 +465,36 @@ class BackendAPI:
             cls._capture_tensor(tensors[i], inq)
             BackendAPI.push_input(inq, tensors[i], single_input, 1, -1) == BackendStatusCode.Success, "Error while pushing inputs"
 
+    @classmethod
+    def _parallel_host_tilize_threads(cls) -> Optional[int]:
+        """
+        Thread count for tilizing a batch of inputs on the host before pushing (0 lets the backend pick one based on the
+        total size), or None if inputs are handed to the backend untilized, one at a time.
+        """
+        if not hasattr(cls, "parallel_host_tilize_threads"):
+            enabled = bool(int(os.environ.get("PYBUDA_PARALLEL_HOST_TILIZE", "0")))
+            cls.parallel_host_tilize_threads = int(os.environ.get("PYBUDA_HOST_TILIZE_THREADS", "0")) if enabled else None
+        return cls.parallel_host_tilize_threads
+
+    @classmethod
+    def _push_tilized_to_queues(cls, ordered_input_queues: List[DramIODesc], tensors: List[PytorchTensorDesc], single_input: bool):
+        for i, inq in enumerate(ordered_input_queues):
+            cls._capture_tensor(tensors[i], inq)
+
+        if single_input:
+            # A tilized push always writes every entry of the tensor, single entries are handed to the backend untilized
+            for inq, tensor in zip(ordered_input_queues, tensors):
+                logger.debug("Pushing to queue {}", inq.name)
+                BackendAPI.push_input(inq, tensor, True, 1, -1)
+            return
+
+        # Tilize and convert all inputs at once, spread over multiple threads, then push them in order
+        tilized_tensors = tilize_tensors(ordered_input_queues, tensors, cls._parallel_host_tilize_threads())
+        for inq, tilized in zip(ordered_input_queues, tilized_tensors):
+            logger.debug("Pushing tilized input to queue {}", inq.name)
+            BackendAPI.push_input(inq, tilized, False, 1, -1)
+            free_tensor(tilized)
+
     def update_device_paramaters(self, parameter_values: Dict[str, torch.Tensor]):
         """
         Push new parameter values to the device
@@ -441,7 +512,22 @@ class BackendAPI:
         # Push constants
         assert self.be_api
 
+        # Start reading upcoming lazily-loaded tensors while earlier ones are being pushed
+        prefetch_depth = int(os.environ.get("PYBUDA_TTI_PREFETCH_DEPTH", "4"))
+        push_order = \
+            [(self.compiled_graph_state.post_const_eval_constants, name) for name in self.compiled_graph_state.ordered_constant_node_names] + \
+            [(self.compiled_graph_state.post_const_eval_parameters, name) for name in self.compiled_graph_state.ordered_parameter_node_names]
+        for name_to_tensor, name in push_order[:prefetch_depth]:
+            self.compiled_graph_state.prefetch_tensor(name_to_tensor, name)
+
+        def prefetch_next(pushed: int):
+            if pushed + prefetch_depth < len(push_order):
+                self.compiled_graph_state.prefetch_tensor(*push_order[pushed + prefetch_depth])
+
+        pushed = 0
         for constant_name in self.compiled_graph_state.ordered_constant_node_names:
+            prefetch_next(pushed)
+            pushed += 1
             inq = self.be_api.get_queue_descriptor(constant_name)
             if translate:
                 assert translate_addresses(inq) == BackendStatusCode.Success, f"Failed to translate addresses: {inq.name}"
@@ -454,6 +540,8 @@ class BackendAPI:
 
         # Push parameters
         for parameter_name in self.compiled_graph_state.ordered_parameter_node_names:
+            prefetch_next(pushed)
+            pushed += 1
             pq = self.be_api.get_queue_descriptor(parameter_name)
             if translate:
                 assert translate_addresses(pq) == BackendStatusCode.Success, f"Failed to translate addresses: {pq.name}"
@@ -106,8 +106,7 @@ def initialize_output_build_directory(backend_output_directory: str):
 
 
 def write_netlist(net, netlist_filename: str) -> str:
-    with open(netlist_filename, "w") as f:
-        f.write(net.dump_to_yaml())
+    net.dump_to_file(netlist_filename)
 
 
 def write_netlist_and_buda_envs_config(
@@ -29,6 +29,7 @@ from pybuda._C import (
     lower_to_buda_netlist,
     merge_netlists,
     dump_graph,
+    flush_reportify_dumps,
     dump_epoch_type_graphs,
     dump_epoch_id_graphs,
     is_subset_of_instructions,
@@ -55,6 +56,7 @@ from .config import (
     _get_global_compiler_config,
 )
 from .pybudaglobal import state_changed, clear_state_changed
+from .instrumentation import instrument_scope, counter_add, reset as reset_instrumentation, write_compile_trace
 from pybuda import PyBudaModule
 from .tensor import Tensor, to_pt_tensors, to_buda_tensors
 from . import ci, utils
@@ -218,6 +220,10 @@ def pybuda_compile_from_context(context: CompileContext) -> CompileResults:
 
     """
 
+    # Recompiles resume from a later stage, and are traced together with the compile they retry
+    if context.stage == CompileDepth.INIT_COMPILE:
+        reset_instrumentation()
+
     # Map stages to functions which execute them.
     stage_to_func = {
         CompileDepth.INIT_COMPILE: init_compile,
@@ -245,7 +251,8 @@ def pybuda_compile_from_context(context: CompileContext) -> CompileResults:
         dev = context.dev
 
         # Execute the current stage.
-        next_stage = stage_to_func[current_stage](context)
+        with instrument_scope(current_stage.name.lower()):
+            next_stage = stage_to_func[current_stage](context)
 
         # Check if we need to stop compilation or perform verifications in the current stage.
         should_early_stop_compilation = check_for_compilation_early_stop(compiler_cfg.compile_depth, current_stage)
@@ -269,10 +276,14 @@ def pybuda_compile_from_context(context: CompileContext) -> CompileResults:
 
         if should_early_stop_compilation:
             logger.info("Early stopping compilation at stage {}", current_stage.name.lower())
+            flush_reportify_dumps()
+            write_compile_trace(context.graph_name)
             return generate_compile_results(context.verify_cfg, context.initial_graph_copy, context.outputs, context.intermediate_tensors, context.lowered_graph, context.netlist_filename, context.perf_model_results, pass_specific_output_kwargs=context.output_kwargs)
 
         context.stage = next_stage
 
+    flush_reportify_dumps()
+    write_compile_trace(context.graph_name)
     return generate_compile_results(context.verify_cfg, context.initial_graph_copy, context.outputs, context.intermediate_tensors, context.lowered_graph, context.netlist_filename, context.perf_model_results, pass_specific_output_kwargs=context.output_kwargs)
 
 def pybuda_compile(
@@ -878,7 +889,8 @@ def run_pre_placer_pass(context: CompileContext) -> CompileDepth:
             compiler_cfg.amp_properties,
             compiler_cfg.op_intermediates_to_save,
             context.use_interactive_placer,
-            compiler_cfg.enable_device_tilize)
+            compiler_cfg.enable_device_tilize,
+            pybalancer.chip_placement_policy_from_string(compiler_cfg.chip_placement_policy))
     dump_graph(context.lowered_graph, graph_name, "pre_placer")
 
     assert(context.lowered_graph is not None)
@@ -941,6 +953,7 @@ def run_balancer_and_placer(context: CompileContext) -> CompileDepth:
         enable_single_buffer_fallback = context.compiler_cfg.enable_single_buffer_fallback,
     )
     balancer_config.target_cycles_offset = context.target_cycles_offset
+    balancer_config.user_op_names_to_chip_break = context.placer_config_update.user_op_names_to_chip_break
 
     try:
         context.balancer_solution, had_balancer_attempts = run_placer_buda_passes(context.lowered_graph, balancer_config, context.fracture_chip_id_assignments, context.compiler_cfg.paddings)
@@ -996,6 +1009,7 @@ def run_balancer_and_placer(context: CompileContext) -> CompileDepth:
 
     if not placer_done:
         context.placer_retry_count += 1
+        counter_add("compile.placer_retries")
         logger.debug(f"Previous  instructions: {len(instructions)}, new instructions: {len(context.post_placer_results.ins_instructions)}")
         logger.info(f"Placer failed, retrying loop count {context.placer_retry_count}")
         assert context.placer_retry_count < 20, " 20 loops of placer failed - aborting compile"
@@ -1169,6 +1183,7 @@ def handle_backend_error(context: CompileContext, ex: Optional[BackendCompileExc
         logger.warning("Compile failed, retrying compilation with different parameters.")
         context.in_recompile = True
         context.recompile_count += 1
+        counter_add("compile.recompiles")
 
         # Offset target cycles for the recompile.
         context.target_cycles_offset += int(os.environ.get("PYBUDA_TARGET_CYCLES_OFFSET", "50000"))
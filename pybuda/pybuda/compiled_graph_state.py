@@ -233,6 +233,12 @@ class CompiledGraphState:
             tensor = value
         return tensor
 
+    def prefetch_tensor(self, name_to_tensor, name):
+        # Lazily loaded tensors can start paging in their data ahead of use
+        value = name_to_tensor.get(name)
+        if callable(value) and hasattr(value, "prefetch"):
+            value.prefetch()
+
     def get_constant_tensor(self, name):
         return self.get_tensor(self.post_const_eval_constants, name)
 
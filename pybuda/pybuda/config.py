@@ -157,7 +157,8 @@ class CompilerConfig:
     manual_t_streaming: bool = False        # only respect overrides, by default no streaming
     enable_consteval: bool = True           # enable promotion of nodes to be constant evaluated where possible
     enable_auto_fusing: bool = True         # enable automatic fusing of ops
-    compile_subgraphs: bool = False         # Compile each disjoint graph separately into its own program
+    compile_subgraphs: bool = False         # Compile each disjoint graph separately into its own program. With a single module, each input
+                                            # group is a shape bucket: the module is traced once per group, and all buckets share its parameters
     graph_solver_self_cut_type: str = "FastCut" # which type of self-cut to use for graphsolver
     use_interactive_placer: bool = True     # use interactive placer if chosen policy supports it
     enable_enumerate_u_kt: bool = True      # Enable searching all possible matmul u_kts
@@ -198,7 +199,7 @@ class CompilerConfig:
     enable_device_tilize: bool = False # If true, enables Tilize op for embedded platform
     enable_forked_dram_inputs = False # If true, enables forked_dram_inputs optimization
 
-    chip_placement_policy: str = "MMIO_LAST"       # how to order the given chip ids for placement
+    chip_placement_policy: str = "MMIO_LAST"       # how to order the given chip ids for placement: MMIO_LAST, SNAKE, or MIN_TRAFFIC to split ops across chips by traffic
     op_names_to_epoch_break: List[Union[query.NodePredicateBuilder, List[Union[str, query.NodePredicateBuilder]]]] = field(default_factory=list, metadata=list_as_json(PlacerBreaksAsJson))   # Each op in the list will be placed on a new epoch
     op_names_to_chip_break: List[Union[query.NodePredicateBuilder, List[Union[str, query.NodePredicateBuilder]]]] = field(default_factory=list, metadata=list_as_json(PlacerBreaksAsJson)) # Each op in the list will be placed on a new chip
     op_names_dont_fuse: List[str] = field(default_factory=lambda: list())           # A list of ops to disable being fused
@@ -242,6 +243,7 @@ class CompilerConfig:
     paddings: Dict[str, bool] = field(default_factory=lambda: dict())
     op_intermediates_to_save: List[str] = field(default_factory=lambda: list()) # list of tagged ops that will spill its output to queue
     tti_dump_format: TTIDumpFormat = field(default=TTIDumpFormat.DEFAULT, metadata=as_json(TTIDumpFormat))
+    tti_binary_artifact: bool = False # store TTI device image state in a single memory-mappable binary file instead of json + per-tensor files
     dram_placement_algorithm: pyplacer.DRAMPlacementAlgorithm = field(default=pyplacer.DRAMPlacementAlgorithm.ROUND_ROBIN, metadata=as_json(pyplacer.DRAMPlacementAlgorithm))
 
     # TODO: add reportify dir
@@ -307,6 +309,9 @@ class CompilerConfig:
         elif "PYBUDA_TTI_BACKEND_TILIZED_FORMAT" in os.environ:
             self.tti_dump_format = TTIDumpFormat.BACKEND_TILIZED
 
+        if "PYBUDA_TTI_BINARY_ARTIFACT" in os.environ:
+            self.tti_binary_artifact = bool(int(os.environ["PYBUDA_TTI_BINARY_ARTIFACT"]))
+
         if "PYBUDA_AMP_LIGHT" in os.environ:
             self.enable_amp_light(level=int(os.environ["PYBUDA_AMP_LIGHT"]))
 
@@ -553,7 +558,8 @@ def set_configuration_options(
         Enable or Disable Tilize Op on the embedded platform
 
     chip_placement_policy: Optional[str]
-        Determine the order of the chip ids used in placement
+        Determine the order of the chip ids used in placement. MIN_TRAFFIC also splits the ops across the chips to
+        minimize the traffic between them
 
     dram_placement_algorithm: Optional[pyplacer.DRAMPlacementAlgorithm]
         Set the algorithm to use for DRAM placement. Valid values are: ROUND_ROBIN, ROUND_ROBIN_FLIP_FLOP, GREATEST_CAPACITY, CLOSEST
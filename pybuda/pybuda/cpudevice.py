@@ -19,7 +19,7 @@ from .tensor import SomeTensor, buda_dataformat_to_pytorch_dtype, Tensor, to_pt_
 from .verify import VerifyConfig
 from .compile import CompilerConfig
 from .pybudaglobal import lazy_trace_data
-from .device_connector import DeviceConnector, TransferType, DirectPusherDeviceConnector
+from .device_connector import DeviceConnector, TransferType, DirectPusherDeviceConnector, shm_ring_transfer_enabled
 from .utils import detach_tensors
 
 from pybuda.tvm_utils import map_tf_dtype_to_pt, map_pt_dtype_to_tf
@@ -1042,7 +1042,8 @@ class CPUDevice(Device):
         logger.debug("Creating forward device connector from {} to {}", self, target_device)
         if isinstance(target_device, CPUDevice):
             # Queues
-            self.forward_dc = DeviceConnector(TransferType.MP_QUEUE, TransferType.MP_QUEUE, self.shutdown_event, side_queue=d2d_fwd_queue)
+            transfer_type = TransferType.SHM_RING if shm_ring_transfer_enabled(sequential) else TransferType.MP_QUEUE
+            self.forward_dc = DeviceConnector(transfer_type, transfer_type, self.shutdown_event, side_queue=d2d_fwd_queue)
         else:
             # Tilize to TTDevice
             self.forward_dc = DirectPusherDeviceConnector(self.shutdown_event, sequential, side_queue=d2d_fwd_queue, microbatch=microbatch)
@@ -1054,7 +1055,8 @@ class CPUDevice(Device):
         logger.debug("Creating backward device connector from {} to {}", self, target_device)
         if isinstance(target_device, CPUDevice):
             # Queues
-            self.backward_dc = DeviceConnector(TransferType.MP_QUEUE, TransferType.MP_QUEUE, self.shutdown_event, side_queue=d2d_bwd_queue)
+            transfer_type = TransferType.SHM_RING if shm_ring_transfer_enabled(sequential) else TransferType.MP_QUEUE
+            self.backward_dc = DeviceConnector(transfer_type, transfer_type, self.shutdown_event, side_queue=d2d_bwd_queue)
         else:
             # TTDevice copies directly to host, no pushing
             self.backward_dc = DirectPusherDeviceConnector(self.shutdown_event, sequential, side_queue=d2d_bwd_queue, microbatch=microbatch)
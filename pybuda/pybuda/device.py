@@ -430,6 +430,11 @@ class Device:
             with self._try_run("Forward"):
                 self.forward(loop_count=cmd.params["loop_count"])
 
+        elif cmd.command_type == CommandType.RUN_FORWARD_LOOP:
+            logger.debug("Received RUN_FORWARD_LOOP command on {} / {}", self, os.getpid())
+            with self._try_run("Forward loop"):
+                self.forward_loop(loop_count=cmd.params["loop_count"])
+
         elif cmd.command_type == CommandType.RUN_BACKWARD:
             logger.debug("Received RUN_BACKWARD command on {} / {}", self, os.getpid())
             with self._try_run("Backward"):
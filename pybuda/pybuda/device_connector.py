@@ -1,9 +1,12 @@
 # SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
 
 # SPDX-License-Identifier: Apache-2.0
+import os
+import pickle
 import threading
+import uuid
 from enum import Enum
-from typing import List, Optional, Union, Tuple
+from typing import Callable, List, Optional, Union, Tuple
 import queue
 
 from multiprocessing.synchronize import Event as EventClass
@@ -15,7 +18,7 @@ from loguru import logger
 from .backend import BackendAPI
 from .tensor import Tensor, pytorch_tensor_to_tensor_desc, is_equivalent_data_format, pad_pytorch_tensor_to_buda
 from .utils import detach_tensors, align_up
-from pybuda._C.backend_api import DramIODesc, PytorchTensorDesc
+from pybuda._C.backend_api import DramIODesc, PytorchTensorDesc, ShmRingBuffer
 from pybuda._C.graph import RuntimeTensorTransform, RuntimeTensorTransformType, Shape
 from pybuda._C import DataFormat
 from .pybudaglobal import TILE_DIM, create_queue
@@ -24,6 +27,20 @@ class TransferType(Enum):
     MP_QUEUE = 1 # read from / write to a queue in shared memory (on host)
     DIRECT = 2   # read/write directly (tilize/untilize)
     NONE = 3     # no explicit transfer (i.e. device will do it on its own), so wrapper does nothing
+    SHM_RING = 4 # read from / write to a lock-free ring buffer in shared memory (on host), no pickling of tensor data
+
+def shm_ring_transfer_enabled(sequential: bool) -> bool:
+    """
+    Host-to-host connectors use the shared memory ring instead of mp queues. Only meaningful when devices
+    run in separate processes.
+    """
+    return (os.environ.get("PYBUDA_SHM_RING_TRANSFER", "0") != "0"
+            and not sequential
+            and "PYBUDA_FORCE_SEQUENTIAL" not in os.environ
+            and os.environ.get("PYBUDA_FORCE_THREADS", "0") == "0")
+
+# Header sent in place of tensor data when a record is too large for the ring; data then follows through the mp queue
+_SHM_RING_OVERFLOW = b"overflow"
 
 class DeviceConnector:
     """
@@ -38,7 +55,8 @@ class DeviceConnector:
             pop_type: TransferType, 
             shutdown_event: Optional[EventClass],
             queue: Optional[Queue] = None,
-            side_queue: Optional[Queue] = None):
+            side_queue: Optional[Queue] = None,
+            zero_copy: bool = False):
 
         self.push_type = push_type
         self.pop_type = pop_type
@@ -46,10 +64,19 @@ class DeviceConnector:
 
         if queue is not None:
             self.queue = queue
-        elif self.pop_type == TransferType.MP_QUEUE:
+        elif self.pop_type in [TransferType.MP_QUEUE, TransferType.SHM_RING]:
+            # Ring transfers still need a queue for records that don't fit into the ring
             mp_context = mp.get_context('spawn')
             self.queue = create_queue(mp_context)
 
+        self.ring = None
+        if self.pop_type == TransferType.SHM_RING:
+            assert self.push_type == TransferType.SHM_RING, "Shared memory ring must be used on both sides of the connector"
+            capacity = align_up(int(os.environ.get("PYBUDA_SHM_RING_CAPACITY", 64 * 1024 * 1024)), 64)
+            self.ring = ShmRingBuffer(f"/pybuda_dc_{os.getpid()}_{uuid.uuid4().hex[:16]}", capacity)
+
+        # With zero_copy, tensors returned by read() are views into the ring and are only valid until pop()
+        self.zero_copy = zero_copy
         self.side_queue = side_queue
 
     def shutdown(self):
@@ -81,35 +108,115 @@ class DeviceConnector:
 
         self.push_to_side_queue(tensors)
         if self.push_type == TransferType.MP_QUEUE:
-            while True:
-                try:
-                    self.queue.put(tensors) # TODO: timeout and break on shutdown_event
-                    return
-                except queue.Full as _:
-                    if self.shutdown_event is not None and self.shutdown_event.is_set():
-                        logger.debug("Aborting queue put due to shutdown event")
-                        return [] # got a signal to shutdown and end the process
-                    continue
+            return self._queue_put(tensors)
 
+        if self.push_type == TransferType.SHM_RING:
+            return self._ring_push(tensors)
         
         raise RuntimeError(f"Can't handle push to this type: {type(self)}")
 
+    def _queue_put(self, tensors: List[Tensor]) -> bool:
+        """
+        Put into the mp queue, returns False if aborted by the shutdown event
+        """
+        while True:
+            try:
+                self.queue.put(tensors, timeout=0.1)
+                return True
+            except queue.Full as _:
+                if self.shutdown_event is not None and self.shutdown_event.is_set():
+                    logger.debug("Aborting queue put due to shutdown event")
+                    return False # got a signal to shutdown and end the process
+                continue
+
+    def _queue_get(self) -> List[Tensor]:
+        """
+        Get from the mp queue, returns an empty list if aborted by the shutdown event
+        """
+        while True:
+            try:
+                return self.queue.get(timeout=0.1)
+            except queue.Empty as _:
+                if self.shutdown_event is not None and self.shutdown_event.is_set():
+                    logger.debug("Aborting queue get due to shutdown event")
+                    return [] # got a signal to shutdown and end the process
+                continue
+
+    def _ring_push(self, tensors: List[Tensor]):
+        values = []
+        meta = []
+        for t in tensors:
+            is_pybuda_tensor = isinstance(t, Tensor)
+            v = t.value() if is_pybuda_tensor else t
+            requires_grad = v.requires_grad
+            v = v.detach().contiguous()
+            values.append(v)
+            meta.append((
+                is_pybuda_tensor,
+                v.dtype,
+                tuple(v.shape),
+                requires_grad,
+                t.data_format if is_pybuda_tensor else None,
+                t.is_constant() if is_pybuda_tensor else False))
+
+        header = pickle.dumps(meta)
+        buffers = [(v.data_ptr(), v.numel() * v.element_size()) for v in values]
+        if not self.ring.fits(header, buffers):
+            if not self._queue_put(tensors):
+                return
+            header, buffers = _SHM_RING_OVERFLOW, []
+
+        while not self.ring.write(header, buffers, timeout_ms=100):
+            if self.shutdown_event is not None and self.shutdown_event.is_set():
+                logger.debug("Aborting ring write due to shutdown event")
+                return
+
+    def _ring_read(self) -> List[Tensor]:
+        self.ring.release() # previous zero-copy record, if pop() wasn't called
+        while True:
+            record = self.ring.read(timeout_ms=100)
+            if record is not None:
+                break
+            if self.shutdown_event is not None and self.shutdown_event.is_set():
+                logger.debug("Aborting ring read due to shutdown event")
+                return [] # got a signal to shutdown and end the process
+
+        header, views = record
+        if header == _SHM_RING_OVERFLOW:
+            self.ring.release()
+            return self._queue_get()
+
+        tensors = []
+        for (is_pybuda_tensor, dtype, shape, requires_grad, data_format, constant), view in zip(pickle.loads(header), views):
+            if len(view) > 0:
+                v = torch.frombuffer(view, dtype=dtype).view(shape)
+                if not self.zero_copy:
+                    v = v.clone()
+            else:
+                v = torch.empty(shape, dtype=dtype)
+            if requires_grad:
+                v.requires_grad_(True)
+            tensors.append(Tensor.create_from_torch(v, data_format, constant) if is_pybuda_tensor else v)
+
+        if not self.zero_copy:
+            self.ring.release()
+        return tensors
+
     def read(self) -> List[Tensor]:
 
+        if self.pop_type == TransferType.SHM_RING:
+            return self._ring_read()
+
         if self.queue is not None:
-            while True:
-                try:
-                    data = self.queue.get(timeout=0.1)
-                    return data
-                except queue.Empty as _:
-                    if self.shutdown_event is not None and self.shutdown_event.is_set():
-                        logger.debug("Aborting queue get due to shutdown event")
-                        return [] # got a signal to shutdown and end the process
-                    continue
+            return self._queue_get()
 
         raise RuntimeError("No queue to read from")
 
     def pop(self):
+        if self.ring is not None:
+            self.ring.release()
+            return
+
         if self.queue is not None:
             return # no-op
 
@@ -125,6 +232,8 @@ class DeviceConnector:
         pass
 
     def empty(self) -> bool:
+        if self.ring is not None:
+            return self.ring.empty()
         if self.queue is None:
             raise RuntimeError("This type of connector can't be polled for emptiness")
         return self.queue.empty()
@@ -225,7 +334,12 @@ class DirectPusherDeviceConnector(DeviceConnector):
         return tensor
 
     def _internal_push(self, tensors: List[Tensor]):
+        BackendAPI.push_to_queues(self.direct_push_queues, self.convert_for_push(tensors), single_input=False)
 
+    def convert_for_push(self, tensors: List[Tensor]) -> List[PytorchTensorDesc]:
+        """
+        Convert a set of inputs to descriptors in the layout of the push queues, without pushing them
+        """
         tensor_dtypes = [None] * len(tensors)
         if not self.direct_push_queues:
             print(f"Direct push queues have not been set for {self}")
@@ -287,8 +401,8 @@ class DirectPusherDeviceConnector(DeviceConnector):
                 return t.to_tensor_desc()
             return pytorch_tensor_to_tensor_desc(t, df=type)
 
-        BackendAPI.push_to_queues(self.direct_push_queues, [to_tensor_desc(t, type) for t, type in zip(tensors, tensor_dtypes)], single_input=False)
         self.save_tensors = tensors
+        return [to_tensor_desc(t, type) for t, type in zip(tensors, tensor_dtypes)]
 
     def push(self, tensors: List[Tensor]):
 
@@ -410,6 +524,13 @@ class OutputQueueDirectPoppperDeviceConnector(DirectPopperDeviceConnector):
     def __init__(self, q: Queue, shutdown_event: Optional[EventClass], side_queue: Optional[queue.Queue] = None):
         super().__init__(shutdown_event, side_queue=side_queue)
         self.queue = q
+        self.output_transform: Optional[Callable[[List[Tensor]], List[Tensor]]] = None # Applied to each set of outputs before it goes to the queue
+
+    def _put(self, data: List[Tensor]):
+        data = [t.clone().detach() for t in data]  # Need to clone, otherwise popping will erase the tensor
+        if self.output_transform is not None:
+            data = self.output_transform(data)
+        self.queue.put(data)
 
     def transfer(self, blocking: bool):
         """
@@ -419,5 +540,13 @@ class OutputQueueDirectPoppperDeviceConnector(DirectPopperDeviceConnector):
             raise NotImplementedError("Non-blocking transfer on output not implemented yet")
 
         data = self.read()
-        self.queue.put([t.clone().detach() for t in data])  # Need to clone, otherwise popping will erase the tensor
+        self._put(data)
         self.pop()
+
+    def transfer_descs(self, out_descs: List[PytorchTensorDesc]):
+        """
+        Transfer a set of outputs that was already read out of the device, i.e. by a native command loop
+        """
+        data = BackendAPI.convert_outputs(out_descs, self.original_shapes, self.runtime_tensor_transforms, self.requires_grad)
+        self.push_to_side_queue(data)
+        self._put(data)
@@ -0,0 +1,43 @@
+# SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+
+# SPDX-License-Identifier: Apache-2.0
+"""
+Compile-time instrumentation. Timers and counters are always recorded, passes and balancer phases are timed on the
+C++ side and compile stages here. Set PYBUDA_COMPILE_TRACE to a file (or an existing directory, for one trace per
+graph) to export a Chrome trace of each compile, viewable in chrome://tracing or ui.perfetto.dev, and log a summary.
+"""
+from contextlib import contextmanager
+import os
+
+from loguru import logger
+
+import pybuda._C.instrumentation as pyinstrumentation
+
+
+@contextmanager
+def instrument_scope(name: str, category: str = "compile"):
+    event_id = pyinstrumentation.begin_event(name, category)
+    try:
+        yield
+    finally:
+        pyinstrumentation.end_event(event_id)
+
+
+def counter_add(name: str, value: int = 1):
+    pyinstrumentation.counter_add(name, value)
+
+
+def reset():
+    """ Drop everything recorded so far, called at the start of each compile """
+    pyinstrumentation.reset()
+
+
+def write_compile_trace(graph_name: str):
+    path = os.environ.get("PYBUDA_COMPILE_TRACE", "")
+    if not path:
+        return
+
+    if os.path.isdir(path):
+        path = os.path.join(path, f"{graph_name}_compile_trace.json")
+    pyinstrumentation.write_chrome_trace(path)
+    logger.info("Compile trace of {} written to {}\n{}", graph_name, path, pyinstrumentation.summary_table())
@@ -22,3 +22,4 @@ from .api import (
     run_generative_inference,
     detect_available_devices,
 )
+from .batching import ContinuousBatchingRuntime, GenerationRequest
@@ -0,0 +1,241 @@
+# SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+
+# SPDX-License-Identifier: Apache-2.0
+"""
+Continuous batching for KV-cache generation.
+
+The compiled microbatch is split into slots, one sequence per slot. Sequences are admitted into free slots and retired
+between iterations, so mixed-length traffic keeps the microbatch full instead of waiting for the longest sequence
+of a batch to finish.
+
+All slots share the past-cache queues linked by link_past_cache_ios, and the device writes the same cache position
+for the whole microbatch on every iteration. Each sequence keeps its own cursor over that shared position: the cache
+index it was admitted at, and the number of tokens it has written since. Positions before a sequence's start are
+masked out by the attention mask, so whatever previous occupants of the slot left in the cache is never read.
+
+The cache is used as a ring buffer. Cache indices only grow, the write position wraps around the cache length, and a
+sequence is admitted as soon as the positions it needs fit between the write position and the start of the oldest
+active sequence.
+"""
+from collections import deque
+from dataclasses import dataclass, field
+from typing import Callable, Deque, Dict, List, Optional
+import queue
+
+import torch
+from loguru import logger
+
+from ..config import _get_global_compiler_config
+from ..pybudaglobal import get_devices
+from .impl import _run_generate, _error_raised
+
+
+@dataclass
+class GenerationRequest:
+    request_id: str
+    prompt_tokens: List[int]
+    max_new_tokens: int
+    eos_token_id: Optional[int] = None
+
+
+@dataclass
+class SequenceState:
+    request: GenerationRequest
+    slot: int
+    start_index: int                # cache position of the sequence's first token
+    num_tokens: int = 0             # tokens fed to the device so far, prompt included
+    generated_tokens: List[int] = field(default_factory=list)
+
+    @property
+    def prefilling(self) -> bool:
+        return self.num_tokens < len(self.request.prompt_tokens)
+
+    @property
+    def next_token(self) -> int:
+        if self.prefilling:
+            return self.request.prompt_tokens[self.num_tokens]
+        return self.generated_tokens[-1]
+
+    @property
+    def position(self) -> int:
+        """ Position of the next token within the sequence """
+        return self.num_tokens
+
+    @property
+    def finished(self) -> bool:
+        if self.prefilling or len(self.generated_tokens) == 0:
+            return False
+        if len(self.generated_tokens) >= self.request.max_new_tokens:
+            return True
+        return self.request.eos_token_id is not None and self.generated_tokens[-1] == self.request.eos_token_id
+
+    def cache_tokens_needed(self) -> int:
+        # The last generated token is never fed back
+        return len(self.request.prompt_tokens) + self.request.max_new_tokens - 1
+
+
+def _default_next_tokens(outputs: List) -> torch.Tensor:
+    logits = outputs[0].value() if hasattr(outputs[0], "value") else outputs[0]
+    return logits.reshape(logits.shape[0], -1, logits.shape[-1])[:, -1, :].argmax(dim=-1)
+
+
+class ContinuousBatchingRuntime:
+    """
+    Generation runtime keeping the compiled microbatch packed with concurrent sequences.
+
+    Parameters
+    ----------
+    microbatch_size: int
+        Microbatch the module was compiled for, i.e. number of sequences that run concurrently
+
+    cache_length: int
+        Number of positions in the past-cache queues
+
+    input_builder: Callable[[ContinuousBatchingRuntime], List[torch.Tensor]]
+        Builds the module inputs for the next iteration from `tokens()`, `positions()` and `attention_mask()`
+
+    output_queue: queue.Queue
+        Output queue given to `initialize_pipeline`
+
+    next_tokens: Callable[[List], torch.Tensor], optional
+        Picks the next token of each slot from the module outputs, greedy over the logits of the first output by default
+
+    pad_token_id: int
+        Token fed to empty slots
+    """
+
+    def __init__(
+            self,
+            microbatch_size: int,
+            cache_length: int,
+            input_builder: Callable[["ContinuousBatchingRuntime"], List[torch.Tensor]],
+            output_queue: queue.Queue,
+            next_tokens: Callable[[List], torch.Tensor] = _default_next_tokens,
+            pad_token_id: int = 0):
+
+        self.microbatch_size = microbatch_size
+        self.cache_length = cache_length
+        self.input_builder = input_builder
+        self.output_queue = output_queue
+        self.next_tokens = next_tokens
+        self.pad_token_id = pad_token_id
+
+        self.slots: List[Optional[SequenceState]] = [None] * microbatch_size
+        self.pending: Deque[GenerationRequest] = deque()
+        self.completed: Dict[str, List[int]] = {}
+        self.cache_index = 0           # next cache index written into the shared past cache, wraps in write_index
+        self.num_iterations = 0
+        self.num_active_slot_iterations = 0
+
+        if not _get_global_compiler_config().enable_link_past_cache_ios:
+            logger.warning("Continuous batching expects past-cache queues linked with enable_link_past_cache_ios")
+
+    def submit(self, request: GenerationRequest):
+        needed = len(request.prompt_tokens) + request.max_new_tokens - 1
+        assert len(request.prompt_tokens) > 0, f"Request {request.request_id} has an empty prompt"
+        assert request.max_new_tokens > 0, f"Request {request.request_id} doesn't generate any tokens"
+        assert needed <= self.cache_length, f"Request {request.request_id} needs {needed} cache positions, cache has {self.cache_length}"
+        self.pending.append(request)
+
+    def active_sequences(self) -> List[SequenceState]:
+        return [s for s in self.slots if s is not None]
+
+    def idle(self) -> bool:
+        return len(self.pending) == 0 and len(self.active_sequences()) == 0
+
+    def utilization(self) -> float:
+        """ Fraction of slot-iterations that ran a sequence """
+        if self.num_iterations == 0:
+            return 0.0
+        return self.num_active_slot_iterations / (self.num_iterations * self.microbatch_size)
+
+    #
+    # Per-slot views for the input builder, empty slots are padding
+    #
+    def tokens(self) -> torch.Tensor:
+        return torch.tensor([[s.next_token if s is not None else self.pad_token_id] for s in self.slots], dtype=torch.int)
+
+    def positions(self) -> torch.Tensor:
+        return torch.tensor([[s.position if s is not None else 0] for s in self.slots], dtype=torch.int)
+
+    @property
+    def write_index(self) -> int:
+        """ Cache position written by the next iteration """
+        return self.cache_index % self.cache_length
+
+    def attention_mask(self) -> torch.Tensor:
+        """ [microbatch, cache_length] mask of the cache positions each slot attends to, including the one being written """
+        mask = torch.zeros((self.microbatch_size, self.cache_length))
+        for s in self.active_sequences():
+            mask[s.slot, torch.arange(s.start_index, self.cache_index + 1) % self.cache_length] = 1.0
+        return mask
+
+    def _retire(self):
+        for slot, s in enumerate(self.slots):
+            if s is not None and s.finished:
+                logger.debug("Retiring {} from slot {} after {} tokens", s.request.request_id, slot, s.num_tokens)
+                self.completed[s.request.request_id] = s.generated_tokens
+                self.slots[slot] = None
+
+    def _admit(self):
+        for slot in range(self.microbatch_size):
+            if self.slots[slot] is not None or len(self.pending) == 0:
+                continue
+
+            # Positions from the oldest active sequence's start up to the write position are still read, a request
+            # that doesn't fit in the rest of the ring waits for older sequences to retire
+            active = self.active_sequences()
+            oldest_active_start = min(s.start_index for s in active) if len(active) > 0 else self.cache_index
+            request = self.pending[0]
+            state = SequenceState(request=request, slot=slot, start_index=self.cache_index)
+            if self.cache_length - (self.cache_index - oldest_active_start) < state.cache_tokens_needed():
+                break
+
+            logger.debug("Admitting {} into slot {} at cache index {}", request.request_id, slot, self.cache_index)
+            self.pending.popleft()
+            self.slots[slot] = state
+
+    def _run_iteration(self, inputs: List[torch.Tensor]) -> List:
+        devices = get_devices()
+        devices[0].push_to_inputs(inputs)
+        _run_generate(input_count=1, write_index=-1, tokens_per_iter=1, token_id=self.write_index, sequential=True)
+        if _error_raised():
+            raise RuntimeError("Generate loop error")
+        return self.output_queue.get()
+
+    def step(self) -> bool:
+        """
+        Retire finished sequences, admit pending ones and run one iteration. Returns False once there's nothing left to run.
+        """
+        self._retire()
+        self._admit()
+
+        active = self.active_sequences()
+        if len(active) == 0:
+            assert len(self.pending) == 0, "Pending requests can't be admitted into an empty batch"
+            return False
+
+        outputs = self._run_iteration(self.input_builder(self))
+        next_tokens = self.next_tokens(outputs)
+
+        for s in active:
+            s.num_tokens += 1
+            # Prompt tokens are fed one per iteration, only the output after the last one is generated
+            if not s.prefilling:
+                s.generated_tokens.append(int(next_tokens[s.slot]))
+
+        self.cache_index += 1
+        self.num_iterations += 1
+        self.num_active_slot_iterations += len(active)
+        return True
+
+    def run(self, requests: Optional[List[GenerationRequest]] = None) -> Dict[str, List[int]]:
+        """
+        Run until all submitted requests complete, returns generated tokens by request id
+        """
+        for request in requests or []:
+            self.submit(request)
+        while self.step():
+            pass
+        logger.info("Continuous batching: {} iterations, {:.1f}% slot utilization", self.num_iterations, 100.0 * self.utilization())
+        return self.completed
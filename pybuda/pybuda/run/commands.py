@@ -25,6 +25,7 @@ class CommandType(Enum):
     CPUEVAL_LOSS = 16
     SYNC = 17
     RUN_GENERATE = 18
+    RUN_FORWARD_LOOP = 19
 
 class Command:
     """
@@ -45,6 +46,10 @@ class Command:
     def run_forward(cls, loop_count: int) -> "Command":
         return Command(CommandType.RUN_FORWARD, {"loop_count": loop_count})
 
+    @classmethod
+    def run_forward_loop(cls, loop_count: int) -> "Command":
+        return Command(CommandType.RUN_FORWARD_LOOP, {"loop_count": loop_count})
+
     @classmethod
     def run_backward(cls, loop_count: int, zero_grad: bool) -> "Command":
         return Command(CommandType.RUN_BACKWARD, {"loop_count": loop_count, "zero_grad": zero_grad})
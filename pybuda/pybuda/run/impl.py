@@ -139,6 +139,13 @@ def _translate_framework_modules_on_devices(
                             inputs = _wrap_inputs(module.forward(*to_buda_tensors(inputs)))
                             module.subgraph_idx = 0 # Multiple modules on 1 device, merge into 1 graph
             
+            # One module compiled once per input group, into one subgraph per input shape bucket
+            elif compiler_cfg.compile_subgraphs:
+                assert isinstance(device.modules[0], PyBudaModule), "Shape buckets need a PyBudaModule, framework modules are translated for a single input shape"
+                assert device.loss_module is None, "Shape buckets currently do not support a loss module"
+                assert len(devices) == 1, "Shape buckets currently do not support multiple devices"
+                device.modules[0].subgraph_idx = 0
+
             else:
                 assert compiler_cfg.compile_subgraphs == False, "Found only 1 module on a TTDevice, but compiler_cfg.compile_subgraphs is set to True"
                 module_index = 0
@@ -571,6 +578,21 @@ def _run_forward_with_fw_looping(ctx: RunContext, microbatch_looping: bool, devi
         logger.error("Forward loop error: {}", e)
         _error_shutdown()
 
+def _native_command_loop(ctx: RunContext, devices: List[Device], input_count: int) -> bool:
+    """
+    Inference on a single TT device can hand the whole loop to the backend command loop, see TTDevice.forward_loop.
+    Enabled with PYBUDA_NATIVE_COMMAND_LOOP.
+    """
+    if not bool(int(os.environ.get("PYBUDA_NATIVE_COMMAND_LOOP", "0"))):
+        return False
+
+    # Run-forever mode (input_count == 0) keeps the python loop, the native one needs to know the loop count
+    return (not ctx.training
+            and input_count > 0
+            and len(devices) == 1
+            and isinstance(devices[0], TTDevice)
+            and ctx.intermediates_queue is None)
+
 def _run_forward(input_count: int = 1, sequential: bool = False):
     """
     Run forward passes on the pre-compiled and initialized pipeline of devices. This API should be 
@@ -603,7 +625,11 @@ def _run_forward(input_count: int = 1, sequential: bool = False):
         return
 
     try:
-        if microbatch_looping:
+        if _native_command_loop(ctx, devices, input_count):
+            logger.debug("Running {} native forward loop: {}", 'sequential' if sequential else 'concurrent', devices[0])
+            _run_command(devices[0], sequential, Command.run_forward_loop(loop_count=input_count))
+
+        elif microbatch_looping:
             for d in devices:
                 logger.debug("Running {} device forward: {}", 'sequential' if sequential else 'concurrent', d)
                 _run_command(d, sequential, Command.run_forward(loop_count=input_count))
@@ -1188,8 +1214,8 @@ def _get_device_zero_inputs(sample_inputs, peek=False):
     if compiler_cfg.compile_subgraphs:
         num_input_groups = len(sample_inputs)
         num_modules = len(devices[0].modules)
-        assert num_input_groups == num_modules, \
-                "Number of input groups ({}) must match number of modules ({})".format(num_input_groups, num_modules)
+        assert num_input_groups == num_modules or num_modules == 1, \
+                "Number of input groups ({}) must match number of modules ({}), or be the shape buckets of a single module".format(num_input_groups, num_modules)
         microbatch_size = sample_inputs[0][0].shape[0]
 
         batch_removed_inputs = []
@@ -4,6 +4,7 @@
 from typing import Optional, List, Tuple, Union, Dict, Set
 from collections import deque
 import os
+import math
 import queue
 import inspect
 import copy
@@ -156,6 +157,9 @@ class TTDevice(Device):
         self.allocated_blocks = []
         self.current_host_address = 0
         self._active_subgraph = 0
+        self._shape_buckets: Optional[List[Tuple[Tuple[int, ...], ...]]] = None
+        self._bucket_output_shapes: List[List[Tuple[int, ...]]] = [] # traced output shapes of each shape bucket
+        self._bucket_output_crops: deque = deque() # output shapes to crop to, one entry per push waiting for its outputs
         reset_unique_node_id()
 
         if module is not None:
@@ -364,6 +368,109 @@ class TTDevice(Device):
         Gets the currently active subgraph.
         """
         return self._active_subgraph
+
+    def get_shape_bucket(self, tensors: Tuple[Union[torch.Tensor, Tensor], ...]) -> int:
+        """
+        Pick the shape bucket for the given inputs: the bucket with matching shapes, or the smallest one they fit into.
+        """
+        assert self._shape_buckets is not None, "Device wasn't compiled with shape buckets"
+        shapes = [tuple(t.shape[1:]) for t in tensors]
+        fitting = []
+        for index, bucket in enumerate(self._shape_buckets):
+            if len(bucket) != len(shapes) or any(len(s) != len(b) for s, b in zip(shapes, bucket)):
+                continue
+            if all(tuple(s) == tuple(b) for s, b in zip(shapes, bucket)):
+                return index
+            if all(x <= y for s, b in zip(shapes, bucket) for x, y in zip(s, b)):
+                volume = sum(math.prod(b) for b in bucket)
+                fitting.append((volume, index))
+
+        if len(fitting) == 0:
+            raise RuntimeError(f"Input shapes {shapes} don't fit into any of the compiled shape buckets {self._shape_buckets}")
+        return min(fitting)[1]
+
+    def push_to_inputs(self, *tensors: Union[Tuple[Union[torch.Tensor, Tensor], ...], Dict[str, Union[torch.Tensor, Tensor]]]):
+        """
+        Push tensor(s) to module inputs. On a device compiled with shape buckets, the bucket is picked from the
+        input shapes, and inputs smaller than the bucket are zero-padded at the end of each dimension.
+
+        Padded positions hold zeros and go through the model like any other data, so the model has to mask them
+        wherever they change the result (softmax, reductions or norms over the padded dim).
+
+        Outputs are cropped back using the output shapes traced for each bucket: an output dim that follows the same
+        input dim in every bucket is cut to that input's original size. Other output dims come back bucket-sized.
+        """
+        if self._shape_buckets is None or len(self._shape_buckets) == 1:
+            return Device.push_to_inputs(self, *tensors)
+
+        if len(tensors) == 1 and isinstance(tensors[0], (tuple, list)):
+            tensors = tensors[0]
+        assert not isinstance(tensors, dict), "Shape buckets need inputs in order"
+
+        bucket = self.get_shape_bucket(tensors)
+        if bucket != self._active_subgraph:
+            # Queues of the other bucket's program are picked up on the next transfer
+            assert self._input_buffer.empty(), "Switching shape buckets with inputs of the previous bucket still pending"
+            logger.debug("Switching to shape bucket {} on {}", bucket, self)
+            self.set_active_subgraph(bucket)
+
+        padded = []
+        input_shapes = []
+        for t, bucket_shape in zip(to_pt_tensors(tensors), self._shape_buckets[bucket]):
+            pad = []
+            for dim, size in reversed(list(zip(t.shape[1:], bucket_shape))):
+                pad += [0, size - dim]
+            padded.append(torch.nn.functional.pad(t, pad) if any(pad) else t)
+            input_shapes.append(tuple(t.shape[1:]))
+
+        self._bucket_output_crops.append(self._get_bucket_output_crop(bucket, input_shapes))
+        return Device.push_to_inputs(self, padded)
+
+    def _get_bucket_output_crop(self, bucket: int, input_shapes: List[Tuple[int, ...]]) -> Optional[List[Tuple[int, ...]]]:
+        """
+        Output shapes of a push with the given input shapes, padded to the given bucket. An output dim follows an input
+        dim when it has that input dim's size in every traced bucket, and the size differs between buckets (so a
+        [.., 64, 64] output with a fixed hidden dim of 64 keeps its last dim). None if nothing needs cropping.
+        """
+        if tuple(input_shapes) == tuple(self._shape_buckets[bucket]) or len(self._bucket_output_shapes) != len(self._shape_buckets):
+            return None
+
+        input_dims = [(i, j) for i, shape in enumerate(input_shapes) for j in range(len(shape))]
+        crop = []
+        for output_index, bucket_output_shape in enumerate(self._bucket_output_shapes[bucket]):
+            output_shape = []
+            for dim, size in enumerate(bucket_output_shape):
+                original_sizes = set()
+                for i, j in input_dims:
+                    traced_sizes = [(outputs[output_index][dim], shapes[i][j]) for outputs, shapes in zip(self._bucket_output_shapes, self._shape_buckets)]
+                    if all(o == s for o, s in traced_sizes) and len(set(s for _, s in traced_sizes)) > 1:
+                        original_sizes.add(input_shapes[i][j])
+
+                # An output dim following two inputs padded from different sizes can't be told apart, keep it whole
+                output_shape.append(original_sizes.pop() if len(original_sizes) == 1 else size)
+            crop.append(tuple(output_shape))
+        return crop
+
+    def _crop_bucket_outputs(self, outputs: List[Tensor]) -> List[Tensor]:
+        """
+        Crop the outputs of a push padded to its shape bucket back to the original sizes
+        """
+        if not self._bucket_output_crops:
+            return outputs
+
+        crop = self._bucket_output_crops.popleft()
+        if crop is None:
+            return outputs
+
+        assert len(crop) == len(outputs), f"Traced {len(crop)} outputs for the shape bucket, got {len(outputs)}"
+        cropped = []
+        for t, output_shape in zip(outputs, crop):
+            value = t.value()
+            for dim, size in enumerate(output_shape, start=1):
+                if value.shape[dim] != size:
+                    value = value.narrow(dim, 0, size)
+            cropped.append(Tensor.create_from_torch(value.contiguous()))
+        return cropped
         
 
     def generate_graph(self, 
@@ -413,10 +520,13 @@ class TTDevice(Device):
 
         reset_unique_node_id()
 
-        # Trace through the modules
+        # Trace through the modules, a single module compiled as subgraphs is traced once per input shape bucket
+        shape_buckets = compiler_cfg.compile_subgraphs and len(self.modules) == 1
+        traced_modules = self.modules * len(inputs) if shape_buckets else self.modules
         all_subgraph_outputs = []
+        bucket_output_shapes = []
         outputs = inputs
-        for idx, module in enumerate(self.modules):
+        for idx, module in enumerate(traced_modules):
             if compiler_cfg.compile_subgraphs:
                 outputs = inputs[idx]
 
@@ -457,12 +567,15 @@ class TTDevice(Device):
             if isinstance(outputs, Tensor):
                 outputs = (outputs,) # Force a tuple
 
+            if shape_buckets:
+                bucket_output_shapes.append([tuple(output.shape.get_pytorch_shape()[1:]) for output in outputs])
+
             for output in outputs:
-                output_to_module_name_prefix[output] = module.get_name()
+                output_to_module_name_prefix[output] = module.get_name() + (f"_bucket{idx}" if shape_buckets and idx > 0 else "")
                 if compiler_cfg.compile_subgraphs:
                     assert output not in output_to_subgraph_index, "Output tensor {} is produced by multiple modules".format(output)
 
-                output_to_subgraph_index[output] = module.subgraph_idx
+                output_to_subgraph_index[output] = idx if shape_buckets else module.subgraph_idx
 
             if compiler_cfg.compile_subgraphs == False and idx == len(self.modules) - 1:
                 all_subgraph_outputs += outputs
@@ -470,6 +583,9 @@ class TTDevice(Device):
                 all_subgraph_outputs += outputs
 
 
+        if shape_buckets:
+            self._bucket_output_shapes = bucket_output_shapes
+
         if trace_only:
             return graph, all_subgraph_outputs, {}, inputs, target_tensors
 
@@ -486,9 +602,9 @@ class TTDevice(Device):
         input_names_known = True
         if isinstance(inputs[0], Tensor):
             inputs = (inputs,)
-        for index, (module, submodule_input) in enumerate(zip(self.modules, inputs)):
+        for index, (module, submodule_input) in enumerate(zip(traced_modules, inputs)):
             submodule_input_node_names = list(inspect.signature(super(PyBudaModule, module).__getattribute__("forward")).parameters.keys())
-            if len(self.modules) > 1:
+            if len(traced_modules) > 1:
                 submodule_input_node_names = [f"{input_name}_{index}" for input_name in submodule_input_node_names]
             input_node_names += submodule_input_node_names
             if len(submodule_input_node_names) != len(submodule_input):
@@ -668,7 +784,9 @@ class TTDevice(Device):
             tags = {}
             if tensor.src_layer is not None:
                 tags["layer"] = tensor.src_layer
-            op = create_op_node(graph, tensor.src_op.name, tensor.src_op.cpp_op_type, tensor.shape.get_pytorch_shape(), tensor.data_format, subgraph_idx, tags)
+            # Every shape bucket traces the same ops, names of the first bucket are kept for overrides
+            op_name = f"{tensor.src_op.name}_bucket{subgraph_idx}" if shape_buckets and subgraph_idx > 0 else tensor.src_op.name
+            op = create_op_node(graph, op_name, tensor.src_op.cpp_op_type, tensor.shape.get_pytorch_shape(), tensor.data_format, subgraph_idx, tags)
 
             visited_tensors[tensor] = op
             if return_intermediate and tensor.has_value():
@@ -786,6 +904,8 @@ class TTDevice(Device):
             logger.debug("Compiling for Inference mode on {}", self)
 
         self.input_shapes = input_shapes # record for checking later
+        if compiler_cfg.compile_subgraphs and len(self.modules) == 1:
+            self._shape_buckets = [tuple(s[1:] for s in group) for group in input_shapes]
 
         if verify_cfg is None:
             verify_cfg = VerifyConfig.disabled() # no verification config provided, disable by default
@@ -909,6 +1029,39 @@ class TTDevice(Device):
 
         self.backend_api.schedule_run_forward(loop_count)
 
+    def forward_loop(self, loop_count: int):
+        """
+        Run forward on loop_count sets of inputs from the input buffer, and send the outputs to the output queue.
+        Pushes, programs and output reads of a whole chunk of microbatches run in the backend command loop, on
+        dedicated threads, instead of as python commands per microbatch.
+
+        Parameters
+        ----------
+        loop_count: int
+            Number of micro-batches to run
+        """
+        logger.debug("Starting native forward loop on {}", self)
+        assert self._compiled, f"Module not compiled yet on {self}"
+        assert self.backend_api is not None
+        assert isinstance(self.forward_input_dc, InputQueueDirectPusherDeviceConnector) and isinstance(self.forward_dc, OutputQueueDirectPoppperDeviceConnector), \
+                "Native forward loop runs only on a device that is both first and last in the pipeline"
+
+        # Inputs are converted on the host ahead of each chunk, chunk size bounds the memory they take up
+        chunk_size = int(os.environ.get("PYBUDA_NATIVE_COMMAND_LOOP_CHUNK", "64"))
+        done = 0
+        while done < loop_count:
+            inputs = []
+            for _ in range(min(chunk_size, loop_count - done)):
+                tensors = self.forward_input_dc.read()
+                if len(tensors) == 0:
+                    return # shutdown
+                inputs.append(self.forward_input_dc.convert_for_push(tensors))
+
+            outputs = self.backend_api.run_forward_loop(self.forward_input_dc.direct_push_queues, inputs, self.forward_dc.direct_pop_queues)
+            for i in range(len(inputs)):
+                self.forward_dc.transfer_descs(outputs.get(0, i))
+            done += len(inputs)
+
     def generate(self, loop_count: int, write_index: int, tokens_per_iter: int, token_id: int):
         """
         Run forward pass on each module on this device, in order
@@ -1394,6 +1547,7 @@ class TTDevice(Device):
     def _create_forward_output_queue_device_connector(self, q: queue.Queue):
         logger.debug("Creating forward output queue connector on {}", self)
         self.forward_dc = OutputQueueDirectPoppperDeviceConnector(q, self.shutdown_event)
+        self.forward_dc.output_transform = self._crop_bucket_outputs # no-op unless inputs were padded to a shape bucket
 
     # Create device connector for the first device, pushing backward
     def _create_backward_output_queue_device_connector(self, q: queue.Queue):
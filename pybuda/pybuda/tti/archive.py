@@ -6,12 +6,12 @@ import shutil
 import importlib
 import subprocess
 import inspect
+import mmap
 import packaging
 import struct
 import sys
 import tempfile
 import time
-import functools
 from loguru import logger
 import pathlib
 
@@ -20,6 +20,11 @@ from pybuda.config import _set_global_compiler_config, TTIDumpFormat
 from pybuda.module import PyBudaModule
 from pybuda.tensor import pytorch_tensor_to_tensor_desc, tensor_desc_to_pytorch_tensor
 from pybuda.utils import generate_hash, get_current_pytest, write_buda_envs_configs
+from pybuda.tti.binary_artifact import (
+    TTIBinaryArtifact,
+    load_device_image_dict,
+    save_device_image_dict,
+)
 from pybuda.tti.utils import (
     compute_file_checksum,
     write_checksum_to_file,
@@ -37,8 +42,10 @@ from pybuda._C.backend_api import (
     PytorchTensorDesc,
     TilizedTensorDesc,
     binarize_tensor,
+    binarize_tensors,
     debinarize_tensor,
     tilize_tensor,
+    tilize_tensors,
 )
 from pybuda._C import DataFormat
 
@@ -63,6 +70,62 @@ def load_tensor_from_disk(filepath, value):
     return desc
 
 
+class LazyTensorFromDisk:
+    """
+    Deferred load of a binarized tensor from a TTI. Each tensor is its own file, so blobs are page-aligned and the
+    descriptor can point straight into a private memory mapping of the file instead of a freshly allocated and
+    filled host buffer. prefetch() maps the file and asks the kernel to start reading it in the background, so
+    upcoming tensors can be paged in while earlier ones are pushed to device.
+    """
+    def __init__(self, filepath: str, value: Dict):
+        self.filepath = filepath
+        self.value = value
+        self.mm = None
+
+    def _expected_size(self) -> int:
+        if self.filepath.endswith(TTIDumpFormat.BACKEND_TILIZED.extension()):
+            return self.value["num_buffers"] * self.value["buf_size_bytes"]
+        return self.value["shape"][0] * self.value["strides"][0]
+
+    def _map(self) -> bool:
+        if self.mm is not None:
+            return True
+        if "PYBUDA_TTI_DISABLE_MMAP" in os.environ:
+            return False
+
+        with open(self.filepath, "rb") as f:
+            size = os.fstat(f.fileno()).st_size
+            if size == 0 or size != self._expected_size():
+                # Not a raw blob, let the backend decode it
+                return False
+            self.mm = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_COPY)
+        return True
+
+    def prefetch(self):
+        if self._map():
+            self.mm.madvise(mmap.MADV_WILLNEED)
+
+    def __call__(self) -> Union[PytorchTensorDesc, TilizedTensorDesc]:
+        if not self._map():
+            return load_tensor_from_disk(self.filepath, self.value)
+
+        buffer = memoryview(self.mm)
+        if self.filepath.endswith(TTIDumpFormat.BACKEND_TILIZED.extension()):
+            return TilizedTensorDesc.from_buffer(
+                buffer,
+                self.value["num_buffers"],
+                self.value["buf_size_bytes"],
+                DataFormat.from_json(self.value["format"]))
+
+        return PytorchTensorDesc.from_buffer(
+            buffer,
+            self.value["itemsize"],
+            DataFormat.from_json(self.value["format"]),
+            self.value["dim"],
+            self.value["shape"],
+            self.value["strides"])
+
+
 class TTDeviceImageJsonEncoder(json.JSONEncoder):
     DTYPE_TO_BIN_FORMAT = {
         torch.half: "f",
@@ -143,9 +206,29 @@ class TTDeviceImageJsonEncoder(json.JSONEncoder):
                     bin_file.write(struct.pack(fmt, val))
             d[key] = TTDeviceImageJsonEncoder.encode_descriptor(filename_encoding, desc, tilized_tensor_desc)
 
+    @staticmethod
+    def rehash_tensors_as_tilized_bin_objects(d, keys, base_directory, backend_api: BackendAPI):
+        """Batched BACKEND_TILIZED version of rehash_tensor_as_bin_object; tilizes and writes tensors in parallel."""
+        filename_encodings = [
+            os.path.join("tensors", f"torch.Tensor.{key}.{TTIDumpFormat.BACKEND_TILIZED.extension()}".replace("/", "_"))
+            for key in keys
+        ]
+        tensors = [d[key].contiguous() for key in keys]  # keeps the row-major copies alive until tilized
+        tensor_descs = [pytorch_tensor_to_tensor_desc(tensor) for tensor in tensors]
+        qdescs = [backend_api.be_api.get_queue_descriptor(key) for key in keys]
+
+        tilized_tensor_descs = tilize_tensors(qdescs, tensor_descs)
+        binarize_tensors(tilized_tensor_descs, [os.path.join(base_directory, filename) for filename in filename_encodings])
+        for key, filename, tensor_desc, tilized_tensor_desc in zip(keys, filename_encodings, tensor_descs, tilized_tensor_descs):
+            d[key] = TTDeviceImageJsonEncoder.encode_descriptor(filename, tensor_desc, tilized_tensor_desc)
+
     @staticmethod
     def preprocess_keys(d, base_directory: str, tti_dump_format: Optional[TTIDumpFormat] = None, backend_api: Optional[BackendAPI] = None):
         """Convert a dict's keys to strings if they are not."""
+        from .tti import TTDeviceImage
+
+        batch_tilize = tti_dump_format == TTIDumpFormat.BACKEND_TILIZED and is_version_at_least(TTDeviceImage.TTI_VERSION, min_version="1.1.0")
+        tilize_keys = []
         kvs = list(d.items())
         for key, value in kvs:
             if not isinstance(key, str) and isinstance(key, torch.dtype):
@@ -156,7 +239,9 @@ class TTDeviceImageJsonEncoder(json.JSONEncoder):
                 and any(isinstance(sub_value, torch.Tensor) for sub_value in value)
             ):
                 use_backend_format = tti_dump_format in (TTIDumpFormat.BACKEND, TTIDumpFormat.BACKEND_TILIZED)
-                if use_backend_format and key != "cpueval_outputs":
+                if batch_tilize and key != "cpueval_outputs" and isinstance(value, torch.Tensor):
+                    tilize_keys.append(key)
+                elif use_backend_format and key != "cpueval_outputs":
                     TTDeviceImageJsonEncoder.rehash_tensor_as_bin_object(
                         d, key, value, base_directory, tti_dump_format=tti_dump_format, backend_api=backend_api
                     )
@@ -174,6 +259,8 @@ class TTDeviceImageJsonEncoder(json.JSONEncoder):
                     value, base_directory, tti_dump_format, backend_api
                 )
 
+        if tilize_keys:
+            TTDeviceImageJsonEncoder.rehash_tensors_as_tilized_bin_objects(d, tilize_keys, base_directory, backend_api)
         return d
 
     def default(self, obj):
@@ -213,8 +300,7 @@ class TTDeviceImageJsonDecoder(json.JSONDecoder):
 
         if is_version_at_least(TTDeviceImage.TTI_VERSION, min_version="1.1.0"):
             filepath= value["bin"]
-            lazy_load_callable  = functools.partial(load_tensor_from_disk, os.path.join(directory, filepath), value)
-            return lazy_load_callable
+            return LazyTensorFromDisk(os.path.join(directory, filepath), value)
         else:
             dtype = TTDeviceImageJsonDecoder.DATA_FORMAT_TO_DTYPE[
                 DataFormat.from_json(value["format"])
@@ -365,35 +451,38 @@ class TTIArchive:
     def construct_device_image(unzipped_tti_directory: str) -> "TTDeviceImage":
         from .tti import TTDeviceImage
 
-        device_image = None
-        with open(
-            os.path.join(unzipped_tti_directory, "device.json"), "r"
-        ) as json_file:
-            device_image_dict = json.load(json_file, cls=TTDeviceImageJsonDecoder)
-            TTDeviceImageJsonDecoder.postprocess_keys(
-                device_image_dict, unzipped_tti_directory
-            )
-
-            try:
-                device_image = TTDeviceImage.from_dict(device_image_dict)
-            except KeyError as e:
-                raise ValueError(
-                    f"TTI failed to deserialize. TTDeviceImage not contain key: {e}. TTI recompilation required."
+        binary_artifact_path = os.path.join(unzipped_tti_directory, TTIBinaryArtifact.FILENAME)
+        if os.path.exists(binary_artifact_path):
+            device_image_dict = load_device_image_dict(binary_artifact_path)
+        else:
+            with open(
+                os.path.join(unzipped_tti_directory, "device.json"), "r"
+            ) as json_file:
+                device_image_dict = json.load(json_file, cls=TTDeviceImageJsonDecoder)
+                TTDeviceImageJsonDecoder.postprocess_keys(
+                    device_image_dict, unzipped_tti_directory
                 )
 
-            sys.path.append(
-                "."
-            )  # We need this line because the tvm->python code path does and pickle requires a match
-            device_image.modules = TTIArchive.get_instantiate_modules(
-                device_image.module_name_to_metadata, unzipped_tti_directory
-            )
-            netlist_file_basename = os.path.basename(
-                device_image.compiled_graph_state.netlist_filename
-            )
-            device_image.compiled_graph_state.netlist_filename = os.path.join(
-                unzipped_tti_directory, netlist_file_basename
+        try:
+            device_image = TTDeviceImage.from_dict(device_image_dict)
+        except KeyError as e:
+            raise ValueError(
+                f"TTI failed to deserialize. TTDeviceImage not contain key: {e}. TTI recompilation required."
             )
 
+        sys.path.append(
+            "."
+        )  # We need this line because the tvm->python code path does and pickle requires a match
+        device_image.modules = TTIArchive.get_instantiate_modules(
+            device_image.module_name_to_metadata, unzipped_tti_directory
+        )
+        netlist_file_basename = os.path.basename(
+            device_image.compiled_graph_state.netlist_filename
+        )
+        device_image.compiled_graph_state.netlist_filename = os.path.join(
+            unzipped_tti_directory, netlist_file_basename
+        )
+
         return device_image
 
     @staticmethod
@@ -524,22 +613,36 @@ class TTIArchive:
             tensors_directory = os.path.join(src_tti_directory_to_zip, "tensors")
             os.makedirs(tensors_directory, exist_ok=True)
 
-            with open(os.path.join(src_tti_directory_to_zip, "device.json"), "w") as f:
+            if device_image.compiler_cfg.tti_binary_artifact:
+                # Tensors are stored as raw, page-aligned sections regardless of tti_dump_format
                 device_image_state_dict = TTDeviceImage.to_dict(device_image)
                 del device_image_state_dict["modules"]
-                TTDeviceImageJsonEncoder.preprocess_keys(
-                    device_image_state_dict,
-                    src_tti_directory_to_zip,
-                    device_image.compiler_cfg.tti_dump_format,
-                    backend_api=backend_api,
-                )
-                device_image_state_json = json.dumps(
+                save_device_image_dict(
                     device_image_state_dict,
-                    cls=TTDeviceImageJsonEncoder,
-                    indent=4,
-                    skipkeys=True,
+                    os.path.join(src_tti_directory_to_zip, TTIBinaryArtifact.FILENAME),
+                    TTDeviceImageJsonEncoder,
                 )
-                f.write(device_image_state_json)
+                # Loaders predating the binary artifact only look for device.json, leave them one that fails to
+                # deserialize with a clean recompilation error
+                with open(os.path.join(src_tti_directory_to_zip, "device.json"), "w") as f:
+                    json.dump({"version": device_image.version}, f)
+            else:
+                with open(os.path.join(src_tti_directory_to_zip, "device.json"), "w") as f:
+                    device_image_state_dict = TTDeviceImage.to_dict(device_image)
+                    del device_image_state_dict["modules"]
+                    TTDeviceImageJsonEncoder.preprocess_keys(
+                        device_image_state_dict,
+                        src_tti_directory_to_zip,
+                        device_image.compiler_cfg.tti_dump_format,
+                        backend_api=backend_api,
+                    )
+                    device_image_state_json = json.dumps(
+                        device_image_state_dict,
+                        cls=TTDeviceImageJsonEncoder,
+                        indent=4,
+                        skipkeys=True,
+                    )
+                    f.write(device_image_state_json)
 
             module_files_directory = os.path.join(
                 src_tti_directory_to_zip, "module_files"
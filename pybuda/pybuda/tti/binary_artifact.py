@@ -0,0 +1,200 @@
+# SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+
+# SPDX-License-Identifier: Apache-2.0
+"""
+Versioned single-file binary container for the device image state of a TTI.
+
+Layout:
+    [header, padded to one page]
+    [section 0, page-aligned]
+    [section 1, page-aligned]
+    ...
+    [index: utf-8 json describing every section]
+
+The header records the location of the index, so a loader only has to read the header and the index, memory-map the
+file, and decode sections as they're needed. Tensor sections hold raw, contiguous tensor bytes and are loaded as
+zero-copy views of the mapping.
+"""
+import functools
+import json
+import mmap
+import pickle
+import struct
+from collections.abc import Iterable
+from typing import Any, Dict, List, Optional
+
+import torch
+from loguru import logger
+
+from pybuda.optimizers import Optimizer
+
+
+class TTIBinaryArtifact:
+    """
+    Versioned by its own header, independently of TTDeviceImage.TTI_VERSION, so json images keep loading across
+    changes to the artifact layout.
+    """
+    FILENAME = "device.ttib"
+    MAGIC = b"PBTTIBIN"
+    VERSION_MAJOR = 1 # bumped on incompatible layout changes
+    VERSION_MINOR = 0 # bumped on backwards-compatible additions (i.e. new section kinds)
+    ALIGNMENT = mmap.PAGESIZE
+    HEADER = struct.Struct("<8sHHIQQ") # magic, major, minor, flags, index offset, index size
+
+    # Placeholder left in the metadata json for values that were moved out to their own section
+    SECTION_KEY = "__tti_section__"
+
+    KIND_JSON = "json"
+    KIND_PICKLE = "pickle"
+    KIND_TENSOR = "tensor"
+
+
+class TTIBinaryArtifactWriter:
+    def __init__(self, path: str):
+        self.file = open(path, "wb")
+        self.file.write(bytes(TTIBinaryArtifact.ALIGNMENT)) # reserve space for the header
+        self.sections: List[Dict[str, Any]] = []
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        if exc_type is None:
+            self.close()
+        else:
+            self.file.close()
+
+    def _append(self, name: str, kind: str, data, **meta) -> str:
+        offset = self.file.tell()
+        pad = -offset % TTIBinaryArtifact.ALIGNMENT
+        if pad:
+            self.file.write(bytes(pad))
+            offset += pad
+        size = self.file.write(data)
+        self.sections.append({"name": name, "kind": kind, "offset": offset, "size": size, **meta})
+        return name
+
+    def add_json(self, name: str, obj: Any, cls: Optional[type] = None) -> str:
+        return self._append(name, TTIBinaryArtifact.KIND_JSON, json.dumps(obj, cls=cls, skipkeys=True).encode("utf-8"))
+
+    def add_pickle(self, name: str, obj: Any) -> str:
+        return self._append(name, TTIBinaryArtifact.KIND_PICKLE, pickle.dumps(obj, pickle.HIGHEST_PROTOCOL))
+
+    def add_tensor(self, name: str, tensor: torch.Tensor) -> str:
+        tensor = tensor.detach().cpu().contiguous()
+        data = tensor.reshape(-1).view(torch.uint8).numpy()
+        return self._append(name, TTIBinaryArtifact.KIND_TENSOR, data, dtype=str(tensor.dtype), shape=list(tensor.shape))
+
+    def close(self):
+        index = json.dumps({"sections": self.sections}).encode("utf-8")
+        index_offset = self.file.tell()
+        self.file.write(index)
+        self.file.seek(0)
+        self.file.write(TTIBinaryArtifact.HEADER.pack(
+            TTIBinaryArtifact.MAGIC,
+            TTIBinaryArtifact.VERSION_MAJOR,
+            TTIBinaryArtifact.VERSION_MINOR,
+            0,
+            index_offset,
+            len(index)))
+        self.file.close()
+
+
+class TTIBinaryArtifactReader:
+    def __init__(self, path: str):
+        self.path = path
+        with open(path, "rb") as f:
+            # Private mapping: pages are shared with the page cache until written to, and tensors built on top of
+            # it are writable without touching the file
+            self.mm = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_COPY)
+
+        magic, major, minor, _, index_offset, index_size = TTIBinaryArtifact.HEADER.unpack_from(self.mm, 0)
+        if magic != TTIBinaryArtifact.MAGIC:
+            raise ValueError(f"{path} is not a TTI binary artifact")
+        if major != TTIBinaryArtifact.VERSION_MAJOR:
+            raise ValueError(
+                f"TTI binary artifact {path} has version {major}.{minor}, expected {TTIBinaryArtifact.VERSION_MAJOR}.x. TTI recompilation required.")
+
+        index = json.loads(bytes(self.mm[index_offset:index_offset + index_size]).decode("utf-8"))
+        self.sections = {section["name"]: section for section in index["sections"]}
+
+    def has(self, name: str) -> bool:
+        return name in self.sections
+
+    def view(self, name: str) -> memoryview:
+        section = self.sections[name]
+        return memoryview(self.mm)[section["offset"]:section["offset"] + section["size"]]
+
+    def load_json(self, name: str, cls: Optional[type] = None) -> Any:
+        assert self.sections[name]["kind"] == TTIBinaryArtifact.KIND_JSON
+        return json.loads(bytes(self.view(name)).decode("utf-8"), cls=cls)
+
+    def load_pickle(self, name: str) -> Any:
+        assert self.sections[name]["kind"] == TTIBinaryArtifact.KIND_PICKLE
+        return pickle.loads(self.view(name))
+
+    def load_tensor(self, name: str) -> torch.Tensor:
+        section = self.sections[name]
+        assert section["kind"] == TTIBinaryArtifact.KIND_TENSOR
+        dtype = getattr(torch, section["dtype"][len("torch."):])
+        if section["size"] == 0:
+            return torch.empty(section["shape"], dtype=dtype)
+        return torch.frombuffer(self.mm, dtype=dtype, count=section["size"] // dtype.itemsize, offset=section["offset"]).view(section["shape"])
+
+
+def pack_device_image_dict(d: Dict, writer: TTIBinaryArtifactWriter, prefix: str = "") -> Dict:
+    """
+    Move tensors and pickled objects out of the device image dict into their own sections, leaving placeholders.
+    Mirrors TTDeviceImageJsonEncoder.preprocess_keys.
+    """
+    for key, value in list(d.items()):
+        if not isinstance(key, str) and isinstance(key, torch.dtype):
+            d[str(key)] = value
+            del d[key]
+            continue
+
+        section_name = f"{prefix}{key}"
+        if isinstance(value, torch.Tensor):
+            d[key] = {TTIBinaryArtifact.SECTION_KEY: writer.add_tensor(section_name, value)}
+        elif isinstance(value, Optimizer) or (
+            isinstance(value, Iterable) and not isinstance(value, (str, dict))
+            and any(isinstance(sub_value, torch.Tensor) for sub_value in value)
+        ):
+            d[key] = {TTIBinaryArtifact.SECTION_KEY: writer.add_pickle(section_name, value)}
+        elif isinstance(value, dict):
+            d[key] = pack_device_image_dict(value, writer, prefix=f"{section_name}/")
+
+    return d
+
+
+def unpack_device_image_dict(d: Dict, reader: TTIBinaryArtifactReader) -> Dict:
+    """
+    Resolve section placeholders. Tensors are returned as callables and only mapped in when first used
+    (see CompiledGraphState.get_tensor); pickled objects are small and loaded right away.
+    """
+    for key, value in list(d.items()):
+        if isinstance(value, dict) and TTIBinaryArtifact.SECTION_KEY in value:
+            name = value[TTIBinaryArtifact.SECTION_KEY]
+            if reader.sections[name]["kind"] == TTIBinaryArtifact.KIND_TENSOR:
+                d[key] = functools.partial(reader.load_tensor, name)
+            else:
+                d[key] = reader.load_pickle(name)
+        elif isinstance(value, dict):
+            unpack_device_image_dict(value, reader)
+
+        if isinstance(key, str) and key.startswith("torch."):
+            d[getattr(torch, key[len("torch."):])] = d.pop(key)
+
+    return d
+
+
+def save_device_image_dict(device_image_dict: Dict, path: str, json_encoder: type):
+    with TTIBinaryArtifactWriter(path) as writer:
+        pack_device_image_dict(device_image_dict, writer)
+        writer.add_json("device", device_image_dict, cls=json_encoder)
+    logger.debug("TTI: wrote binary artifact {} with {} sections", path, len(writer.sections))
+
+
+def load_device_image_dict(path: str) -> Dict:
+    reader = TTIBinaryArtifactReader(path)
+    return unpack_device_image_dict(reader.load_json("device"), reader)
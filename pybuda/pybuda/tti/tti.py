@@ -34,7 +34,7 @@ class TTDeviceImage:
     """
     A TTDeviceImage defines all required state sourced from TTDevice to produce a TTI-archive.
     """
-    TTI_VERSION: ClassVar[str] = "1.1.0" 
+    TTI_VERSION: ClassVar[str] = "1.1.0"
 
     # Static device state
     version: str
@@ -0,0 +1,63 @@
+# SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+
+# SPDX-License-Identifier: Apache-2.0
+#
+# Host-side tilize benchmark: serial tilize_tensor vs. batched, multi-threaded tilize_tensors
+#
+import pytest
+import pybuda
+import torch
+from loguru import logger
+
+import time
+from pybuda._C.backend_api import tilize_tensor, tilize_tensors, free_tensor, host_conversion_threads, binarize_tensor
+from pybuda.tensor import pytorch_tensor_to_tensor_desc
+
+class WideParameters(pybuda.PyBudaModule):
+    def __init__(self, name, num_weights, weight_shape):
+        super().__init__(name)
+        self.num_weights = num_weights
+        for i in range(num_weights):
+            setattr(self, f"weights{i}", pybuda.Parameter(torch.rand(*weight_shape)))
+
+    def forward(self, act):
+        out = act
+        for i in range(self.num_weights):
+            out = pybuda.op.Matmul(f"matmul{i}", out, getattr(self, f"weights{i}"))
+        return out
+
+@pytest.mark.parametrize("num_threads", [0, 2, 4])
+def test_tilize_tensors(num_threads, tmp_path):
+    num_weights, weight_shape = 8, (1024, 1024)
+    tt0 = pybuda.TTDevice("tt0", module=WideParameters("host_tilize", num_weights, weight_shape))
+    tt0.push_to_inputs(torch.rand(1, 128, 1024))
+    pybuda.run_inference(_verify_cfg=pybuda.VerifyConfig.disabled()).get()
+
+    be_api = tt0.backend_api.be_api
+    names = tt0.backend_api.compiled_graph_state.ordered_parameter_node_names
+    queues = [be_api.get_queue_descriptor(name) for name in names]
+    tensors = [tt0.backend_api.compiled_graph_state.get_parameter_tensor(name).contiguous() for name in names]
+    descs = [pytorch_tensor_to_tensor_desc(t) for t in tensors]
+
+    start = time.time()
+    serial = [tilize_tensor(q, d) for q, d in zip(queues, descs)]
+    serial_time = time.time() - start
+
+    start = time.time()
+    parallel = tilize_tensors(queues, descs, num_threads)
+    parallel_time = time.time() - start
+
+    total_bytes = sum(t.numel() * t.element_size() for t in tensors)
+    logger.info("Tilized {} MB: serial {:.3f}s, {} threads {:.3f}s", total_bytes >> 20, serial_time,
+            host_conversion_threads(total_bytes, len(tensors), num_threads), parallel_time)
+
+    for i, (s, p) in enumerate(zip(serial, parallel)):
+        assert (s.num_buffers, s.buf_size_bytes, s.format) == (p.num_buffers, p.buf_size_bytes, p.format)
+
+        # Tilized data is only reachable through the backend, compare the binarized tensors byte for byte
+        binarize_tensor(s, str(tmp_path / f"serial_{i}.bin"))
+        binarize_tensor(p, str(tmp_path / f"parallel_{i}.bin"))
+        assert (tmp_path / f"serial_{i}.bin").read_bytes() == (tmp_path / f"parallel_{i}.bin").read_bytes(), f"Tilized {names[i]} differs"
+
+        free_tensor(s)
+        free_tensor(p)
@@ -0,0 +1,68 @@
+# SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+
+# SPDX-License-Identifier: Apache-2.0
+#
+# Slot management of the continuous batching runtime, with the device replaced by a fake model
+#
+import queue
+
+import torch
+
+from pybuda.run.batching import ContinuousBatchingRuntime, GenerationRequest
+
+VOCAB = 64
+
+class FakeModelRuntime(ContinuousBatchingRuntime):
+    """ Device stand-in, the next token is always the fed token + 1 """
+    def __init__(self, *args, **kwargs):
+        super().__init__(*args, **kwargs)
+        self.fed = []
+
+    def _run_iteration(self, inputs):
+        tokens, mask = inputs
+        self.fed.append((tokens.flatten().tolist(), mask.clone(), self.write_index))
+        logits = torch.nn.functional.one_hot((tokens.flatten().long() + 1) % VOCAB, VOCAB).float()
+        return [logits.reshape(self.microbatch_size, 1, VOCAB)]
+
+
+def build_inputs(runtime):
+    return [runtime.tokens(), runtime.attention_mask()]
+
+
+def test_continuous_batching_admit_and_retire():
+    runtime = FakeModelRuntime(microbatch_size=2, cache_length=5, input_builder=build_inputs, output_queue=queue.Queue())
+    results = runtime.run([
+        GenerationRequest("a", prompt_tokens=[1, 2], max_new_tokens=3),
+        GenerationRequest("b", prompt_tokens=[10], max_new_tokens=1),
+        GenerationRequest("c", prompt_tokens=[20], max_new_tokens=2),
+        GenerationRequest("d", prompt_tokens=[30, 31], max_new_tokens=3),
+        GenerationRequest("e", prompt_tokens=[40], max_new_tokens=1),
+    ])
+
+    assert results == {"a": [3, 4, 5], "b": [11], "c": [21, 22], "d": [32, 33, 34], "e": [41]}
+
+    # b retires after one token, and c fits in the ring next to a, so it takes the slot right away
+    tokens, mask, write_index = runtime.fed[1]
+    assert tokens == [2, 20]
+    assert mask.tolist() == [[1, 1, 0, 0, 0], [0, 1, 0, 0, 0]]
+
+    # d needs 4 positions, only 2 are left before a's start, so it waits for a to finish
+    tokens, mask, write_index = runtime.fed[3]
+    assert tokens == [4, 0]
+    assert mask[1].tolist() == [0, 0, 0, 0, 0]
+
+    # Once a finishes, d and e are admitted together at the end of the cache
+    tokens, mask, write_index = runtime.fed[4]
+    assert tokens == [30, 40]
+    assert write_index == 4
+    assert mask.tolist() == [[0, 0, 0, 0, 1], [0, 0, 0, 0, 1]]
+
+    # The write position wraps around, and d's mask wraps with it
+    tokens, mask, write_index = runtime.fed[6]
+    assert tokens == [32, 0]
+    assert write_index == 1
+    assert mask.tolist() == [[1, 1, 0, 0, 1], [0, 0, 0, 0, 0]]
+
+    assert [write_index for _, _, write_index in runtime.fed] == [0, 1, 2, 3, 4, 0, 1, 2]
+    assert runtime.num_iterations == 8
+    assert runtime.utilization() == 12 / 16
@@ -0,0 +1,67 @@
+# SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+
+# SPDX-License-Identifier: Apache-2.0
+#
+# Push/pop through host device connectors, without running any devices
+#
+import pytest
+import torch
+
+from pybuda import DataFormat
+from pybuda.device_connector import DeviceConnector, TransferType
+from pybuda.tensor import Tensor
+
+def _records():
+    small = [
+        Tensor.create_from_torch(torch.rand(2, 32, 32, requires_grad=True), DataFormat.Float16_b),
+        torch.arange(100, dtype=torch.int32),
+        torch.empty(0, 4),
+    ]
+    # Larger than half of the ring, goes through the mp queue
+    large = [torch.rand(128, 128)]
+    return [small, large, [t * 2 for t in small[1:]]]
+
+def _check(read, pushed):
+    assert len(read) == len(pushed)
+    for r, p in zip(read, pushed):
+        assert isinstance(r, Tensor) == isinstance(p, Tensor)
+        if isinstance(p, Tensor):
+            assert r.data_format == p.data_format
+            r, p = r.value(), p.value()
+        assert r.dtype == p.dtype and r.shape == p.shape
+        assert r.requires_grad == p.requires_grad
+        assert torch.equal(r.detach(), p.detach())
+
+@pytest.mark.parametrize("zero_copy", [False, True], ids=["copy", "zero_copy"])
+def test_shm_ring_round_trip(zero_copy, monkeypatch):
+    monkeypatch.setenv("PYBUDA_SHM_RING_CAPACITY", str(64 * 1024))
+    connector = DeviceConnector(TransferType.SHM_RING, TransferType.SHM_RING, shutdown_event=None, zero_copy=zero_copy)
+    assert connector.empty()
+
+    records = _records()
+    kept = []
+    for _ in range(4): # more than the ring holds, so records wrap around
+        for record in records:
+            connector.push(record)
+            read = connector.read()
+            _check(read, record)
+
+            # Zero-copy tensors are views into the ring, space is only returned on pop
+            in_ring = record is not records[1]
+            assert connector.empty() == (not zero_copy or not in_ring)
+            connector.pop()
+            assert connector.empty()
+            if not zero_copy:
+                kept.append((read, record))
+
+    # Copies outlive the records they were read from
+    for read, record in kept:
+        _check(read, record)
+
+    # Records, and the ones overflowing into the queue, are read in push order
+    for record in records:
+        connector.push(record)
+    for record in records:
+        _check(connector.read(), record)
+        connector.pop()
+    assert connector.empty()
@@ -5,10 +5,12 @@ from typing import List
 
 import pytest
 import torch
+import yaml
 
 import pybuda
 from pybuda.verify import verify_module, VerifyConfig
 from pybuda import DataFormat, PyBudaModule
+from pybuda._C.backend_api import BackendType
 
 shape = (128, 768)
 
@@ -471,6 +473,47 @@ def test_nested_forks(test_kind, test_device):
     verify_module(NestedForks("netsted_forks"), [(microbatch_count, seq_len, hidden_dim)],
             VerifyConfig(test_kind=test_kind, devtype=test_device.devtype, arch=test_device.arch, pcc=pcc, relative_atol=relative_atol), params_centered_on_zero=True)
 
+# Same graph as test_nested_forks, buffered by solving all fork-joins together instead of one at a time
+def test_nested_forks_global_buffering(test_kind, test_device, monkeypatch):
+    monkeypatch.setenv("PYBUDA_FORK_JOIN_GLOBAL_BUFFERING", "1")
+
+    relative_atol, pcc = get_relaxed_atol_pcc(test_kind, test_device)
+    verify_module(NestedForks("nested_forks_global_buffering"), [(1, 128, 768)],
+            VerifyConfig(test_kind=test_kind, devtype=test_device.devtype, arch=test_device.arch, pcc=pcc, relative_atol=relative_atol), params_centered_on_zero=True)
+
+def _nested_forks_buffering_cost(name):
+    """ Cores taken by buffering nops, and L1 tiles of overridden input buffers, in the compiled netlist """
+    tt0 = pybuda.TTDevice("tt0", devtype=BackendType.Golden)
+    tt0.place_module(NestedForks(name))
+    ret = pybuda.pybuda_compile(tt0, name, pybuda.Tensor.create_from_torch(torch.rand(1, 128, 768)),
+            compiler_cfg=pybuda.CompilerConfig(enable_training=False), verify_cfg=VerifyConfig.disabled())
+
+    with open(ret.netlist_filename) as fd:
+        netlist = yaml.safe_load(fd)
+
+    nop_cores, input_buffer_tiles = 0, 0
+    for graph in netlist["graphs"].values():
+        for op_name, op in graph.items():
+            if not isinstance(op, dict) or "grid_size" not in op:
+                continue
+            cores = op["grid_size"][0] * op["grid_size"][1]
+            if op["type"] == "nop" and "buffer_" in op_name:
+                nop_cores += cores
+            input_buffer_tiles += cores * sum(op.get("input_buf_min_size_tiles", []))
+    return nop_cores, input_buffer_tiles
+
+# Global buffering grows shared buffers only by the outstanding deficit, so it never takes more than the greedy path
+def test_nested_forks_global_buffering_cost(monkeypatch):
+    monkeypatch.delenv("PYBUDA_FORK_JOIN_GLOBAL_BUFFERING", raising=False)
+    greedy_nop_cores, greedy_tiles = _nested_forks_buffering_cost("nested_forks_greedy_cost")
+
+    monkeypatch.setenv("PYBUDA_FORK_JOIN_GLOBAL_BUFFERING", "1")
+    global_nop_cores, global_tiles = _nested_forks_buffering_cost("nested_forks_global_cost")
+
+    assert greedy_nop_cores + greedy_tiles > 0, "Nested forks are expected to need buffering"
+    assert global_nop_cores <= greedy_nop_cores
+    assert global_tiles <= greedy_tiles
+
 class YoloV3ForkJoin(PyBudaModule):
     def __init__(self, name):
         super().__init__(name)
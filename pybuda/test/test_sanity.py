@@ -695,7 +695,7 @@ def test_simple_clip(test_device):
     simple_clip(act)
 
 
-@pytest.mark.parametrize("scheduler_policy", ["ModuleInputsBFS", "LongestPath"])
+@pytest.mark.parametrize("scheduler_policy", ["ModuleInputsBFS", "LongestPath", "MemoryPressure"])
 def test_deterministic_netlist(scheduler_policy):
     hidden_dim, num_heads, seq_len = (128, 4, 128)
     microbatch_size = 1
@@ -2045,3 +2045,62 @@ def test_emulate_harvested(test_device):
         )
     )
 
+
+def test_shape_buckets():
+    class BucketModule(PyBudaModule):
+        def __init__(self, name):
+            super().__init__(name)
+            self.weights = pybuda.Parameter(1, 1, 32, 32, requires_grad=False)
+
+        def forward(self, act):
+            return pybuda.op.Matmul("matmul", act, self.weights)
+
+    tt0 = TTDevice("tt0", devtype=BackendType.Golden)
+    _get_global_compiler_config().compile_subgraphs = True
+    tt0.place_module(BucketModule("shape_buckets"))
+
+    # One module with two input groups compiles a shape bucket per group, sharing the weights
+    output_q = pybuda.initialize_pipeline(
+        training=False,
+        sample_inputs=((torch.rand(1, 1, 32, 32),), (torch.rand(1, 1, 64, 32),)))
+    assert tt0.get_shape_bucket((torch.rand(1, 1, 32, 32),)) == 0
+    assert tt0.get_shape_bucket((torch.rand(1, 1, 48, 32),)) == 1
+    with pytest.raises(RuntimeError):
+        tt0.get_shape_bucket((torch.rand(1, 1, 96, 32),))
+
+    tt0.push_to_inputs((torch.rand(1, 1, 32, 32),))
+    pybuda.run_forward()
+    assert output_q.get()[0].value().shape[-2] == 32
+
+    # Padded up to the larger bucket, the output rows are cropped back to the input
+    tt0.push_to_inputs((torch.rand(1, 1, 48, 32),))
+    pybuda.run_forward()
+    assert tt0.get_active_subgraph() == 1
+    assert output_q.get()[0].value().shape[-2] == 48
+
+
+def test_shape_buckets_crop_by_traced_shapes():
+    class BucketModule(PyBudaModule):
+        def __init__(self, name):
+            super().__init__(name)
+            self.weights = pybuda.Parameter(1, 1, 64, 64, requires_grad=False)
+
+        def forward(self, act):
+            hidden = pybuda.op.Matmul("matmul", act, self.weights)
+            scores = pybuda.op.Matmul("scores", hidden, pybuda.op.Transpose("transpose", act, 2, 3))
+            return hidden, scores
+
+    tt0 = TTDevice("tt0", devtype=BackendType.Golden)
+    _get_global_compiler_config().compile_subgraphs = True
+    tt0.place_module(BucketModule("shape_buckets_crop"))
+
+    output_q = pybuda.initialize_pipeline(
+        training=False,
+        sample_inputs=((torch.rand(1, 1, 32, 64),), (torch.rand(1, 1, 64, 64),)))
+
+    # The hidden dim is 64 in both buckets, only the dims that follow the padded rows are cropped
+    tt0.push_to_inputs((torch.rand(1, 1, 48, 64),))
+    pybuda.run_forward()
+    hidden, scores = output_q.get()
+    assert hidden.value().shape[-2:] == (48, 64)
+    assert scores.value().shape[-2:] == (48, 48)
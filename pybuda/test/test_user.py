@@ -10,6 +10,7 @@
 # All of these tests will run on silicon, in concurrent mode, by default. However, setting 
 # PYBUDA_DEVMODE=1 env variable will drop them into Golden+sequential mode.
 
+import json
 import queue
 import torch
 import pybuda
@@ -295,6 +296,48 @@ def test_setup_forward_calls():
         print(_safe_read(output_q))
 
 
+#
+# Run inference with pushes, programs and output reads of the whole loop in the backend command loop
+#
+def test_native_command_loop(monkeypatch):
+    tt0 = pybuda.TTDevice("tt0")
+    tt0.place_module(PyBudaTestModule("native_loop"))
+
+    output_q = pybuda.initialize_pipeline(training=False, sample_inputs=(torch.rand(4, 32, 32), torch.rand(4, 32, 32)))
+    inputs = [(torch.rand(4, 32, 32), torch.rand(4, 32, 32)) for _ in range(3)]
+
+    def run(native: bool):
+        monkeypatch.setenv("PYBUDA_NATIVE_COMMAND_LOOP", "1" if native else "0")
+        for tensors in inputs:
+            tt0.push_to_inputs(tensors)
+        pybuda.run_forward(input_count=len(inputs))
+        return [_safe_read(output_q) for _ in inputs]
+
+    # Same inputs through the native and the python loop, on the same compiled device
+    native_outputs = run(native=True)
+    python_outputs = run(native=False)
+    for native, python in zip(native_outputs, python_outputs):
+        assert len(native) == len(python) == 2
+        for n, p in zip(native, python):
+            assert torch.equal(n.value(), p.value())
+
+
+def test_compile_trace(monkeypatch, tmp_path):
+    monkeypatch.setenv("PYBUDA_COMPILE_TRACE", str(tmp_path))
+    tt0 = pybuda.TTDevice("tt0")
+    tt0.place_module(PyBudaTestModule("compile_trace"))
+    pybuda.initialize_pipeline(training=False, sample_inputs=(torch.rand(4, 32, 32), torch.rand(4, 32, 32)))
+
+    traces = list(tmp_path.glob("*_compile_trace.json"))
+    assert len(traces) == 1
+    with open(traces[0]) as f:
+        events = json.load(f)["traceEvents"]
+
+    scopes = {e["name"]: e for e in events if e["ph"] == "X"}
+    for scope in ["init_compile", "balancer_pass", "run_pre_placer_buda_passes", "get_legal_op_models", "graph_solver_resolve"]:
+        assert scope in scopes, f"Missing {scope} in compile trace"
+    assert scopes["get_legal_op_models"]["args"]["balancer.op_models_legalized"] > 0
+
 #
 # Run inference in concurrent mode, then push more inputs afterwards (won't work on Golden)
 #
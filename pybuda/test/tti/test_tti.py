@@ -9,18 +9,23 @@ import pytest
 
 import queue
 import random
+from types import SimpleNamespace
 import torch
 import os
 
 import pybuda
 import pybuda.op
-from pybuda import PyTorchModule, TTDeviceImage, VerifyConfig
-from pybuda._C.backend_api import BackendDevice, BackendType, DeviceMode, detect_available_silicon_devices
+from pybuda import DataFormat, PyTorchModule, TTDeviceImage, VerifyConfig
+from pybuda._C.backend_api import BackendDevice, BackendType, DeviceMode, binarize_tensor, detect_available_silicon_devices
 from transformers import BertModel, BertConfig
 from ..common import ModuleBuilder, TestDevice, run, ModuleBuilder, device
 from test.bert.modules import PyBudaFeedForward 
 from pybuda.ttdevice import get_device_config
 from pybuda.config import _get_global_compiler_config
+from pybuda.backend import BackendAPI
+from pybuda.compiled_graph_state import CompiledGraphState
+from pybuda.tensor import pytorch_tensor_to_tensor_desc, tensor_desc_to_pytorch_tensor
+from pybuda.tti.archive import LazyTensorFromDisk, TTDeviceImageJsonEncoder
 from test.utils import download_model
 
 class PyBudaTestModule(pybuda.PyBudaModule):
@@ -415,6 +420,22 @@ def test_const_eval_save_and_load(test_device, pybuda_module):
     pybuda_module._load_device_image("tt9", BackendType.Golden)
 
 
+def test_binary_artifact_save_and_load(test_device, pybuda_module):
+    compiler_cfg = _get_global_compiler_config()
+    compiler_cfg.tti_binary_artifact = True
+    pybuda_module._save_device_image(
+        device_name = "tt_binary_artifact",
+        arch = test_device.arch,
+        backend_type = BackendType.Golden,
+        device_mode = DeviceMode.CompileOnly,
+        module = PyTorchModule("pt_linear", MyLinear()),
+        input_shapes = [
+            (1, 128, 64),
+        ],
+    )
+    pybuda_module._load_device_image("tt_binary_artifact", BackendType.Golden)
+
+
 def test_pt_encoder_silicon_save_and_inspect(test_device, pybuda_module):
     device_img = pybuda_module._save_device_image(
         device_name = "tt10",
@@ -496,6 +517,69 @@ def test_tti_bert_encoder(test_device):
         ),
     )
 
+@pytest.mark.parametrize("use_mmap", [True, False], ids=["mmap", "debinarize"])
+def test_lazy_tensor_from_disk_round_trip(tmp_path, monkeypatch, use_mmap):
+    if not use_mmap:
+        monkeypatch.setenv("PYBUDA_TTI_DISABLE_MMAP", "1")
+
+    tensor = torch.rand(1, 1, 64, 96)
+    desc = pytorch_tensor_to_tensor_desc(tensor)
+    filepath = str(tmp_path / "torch.Tensor.weights.bin")
+    binarize_tensor(desc, filepath)
+
+    lazy = LazyTensorFromDisk(filepath, TTDeviceImageJsonEncoder.encode_descriptor(filepath, desc))
+    lazy.prefetch()
+    assert (lazy.mm is not None) == use_mmap
+
+    loaded = tensor_desc_to_pytorch_tensor(lazy())
+    assert torch.equal(loaded, tensor)
+
+def test_push_constants_and_parameters_prefetch_order(monkeypatch):
+    events = []
+
+    class RecordingLazyTensor:
+        def __init__(self, name):
+            self.name = name
+
+        def prefetch(self):
+            events.append(("prefetch", self.name))
+
+        def __call__(self):
+            events.append(("load", self.name))
+            return torch.zeros(1)
+
+    class GraphState:
+        get_tensor = CompiledGraphState.get_tensor
+        prefetch_tensor = CompiledGraphState.prefetch_tensor
+        get_constant_tensor = CompiledGraphState.get_constant_tensor
+        get_parameter_tensor = CompiledGraphState.get_parameter_tensor
+
+        ordered_constant_node_names = ["c0", "c1"]
+        ordered_parameter_node_names = ["p0", "p1", "p2"]
+        post_const_eval_constants = {name: RecordingLazyTensor(name) for name in ordered_constant_node_names}
+        post_const_eval_parameters = {name: RecordingLazyTensor(name) for name in ordered_parameter_node_names}
+
+    backend = BackendAPI.__new__(BackendAPI)
+    backend.compiled_graph_state = GraphState()
+    backend.be_api = SimpleNamespace(
+        get_queue_descriptor=lambda name: SimpleNamespace(name=name, data_format=DataFormat.Float16_b))
+    monkeypatch.setattr("pybuda.backend.pytorch_tensor_to_tensor_desc", lambda value, df=None: value)
+    monkeypatch.setattr(
+        BackendAPI, "push_input", classmethod(lambda cls, queue_desc, *args: events.append(("push", queue_desc.name))))
+    monkeypatch.setenv("PYBUDA_TTI_PREFETCH_DEPTH", "2")
+
+    backend.push_constants_and_parameters()
+
+    # Each tensor is prefetched once, two pushes ahead of being loaded and pushed
+    assert events == [
+        ("prefetch", "c0"), ("prefetch", "c1"),
+        ("prefetch", "p0"), ("load", "c0"), ("push", "c0"),
+        ("prefetch", "p1"), ("load", "c1"), ("push", "c1"),
+        ("prefetch", "p2"), ("load", "p0"), ("push", "p0"),
+        ("load", "p1"), ("push", "p1"),
+        ("load", "p2"), ("push", "p2"),
+    ]
+
 if __name__ == "__main__":
     import os
 
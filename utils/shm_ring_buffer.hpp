@@ -0,0 +1,304 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace tt
+{
+
+//
+// Single-producer / single-consumer ring buffer living in a POSIX shared memory segment.
+//
+// Each record is a list of raw byte buffers (typically tensor payloads), copied once by the producer
+// into the ring. The consumer gets pointers straight into the shared mapping, so reading is zero-copy
+// until the record is released. Head and tail are free-running byte counters; the only synchronization
+// is acquire/release on those counters. Blocked sides sleep on a futex word in the shared header, so a
+// wakeup costs a syscall only when the other side is actually waiting.
+//
+// The segment is created (and eventually unlinked) by the owner, and opened by name in other processes.
+//
+class ShmRingBuffer
+{
+   public:
+    using Buffer = std::pair<const void *, std::size_t>;
+
+    static constexpr std::uint32_t kMagic = 0x52425454;  // "TTBR"
+    static constexpr std::uint32_t kVersion = 1;
+    static constexpr std::size_t kAlignment = 64;
+
+    // Create a new segment of the given data capacity
+    ShmRingBuffer(std::string const &name, std::size_t capacity) : name_(name), owner_(true)
+    {
+        TT_ASSERT(capacity > 0 and capacity % kAlignment == 0, "Ring capacity must be a multiple of", kAlignment);
+        int fd = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        TT_ASSERT(fd >= 0, "Failed to create shared memory segment", name_, std::strerror(errno));
+        mapping_size_ = sizeof(Header) + capacity;
+        if (ftruncate(fd, mapping_size_) != 0)
+        {
+            close(fd);
+            shm_unlink(name_.c_str());
+            TT_THROW("Failed to size shared memory segment", name_, std::strerror(errno));
+        }
+        map(fd);
+
+        header_ = new (base_) Header();
+        header_->capacity = capacity;
+        header_->version = kVersion;
+        std::atomic_thread_fence(std::memory_order_release);
+        header_->magic = kMagic;
+    }
+
+    // Open an existing segment created by another process
+    explicit ShmRingBuffer(std::string const &name) : name_(name), owner_(false)
+    {
+        int fd = shm_open(name_.c_str(), O_RDWR, 0600);
+        TT_ASSERT(fd >= 0, "Failed to open shared memory segment", name_, std::strerror(errno));
+        struct stat st;
+        TT_ASSERT(fstat(fd, &st) == 0, "Failed to stat shared memory segment", name_);
+        mapping_size_ = static_cast<std::size_t>(st.st_size);
+        map(fd);
+
+        header_ = reinterpret_cast<Header *>(base_);
+        TT_ASSERT(header_->magic == kMagic, "Not a ring buffer segment:", name_);
+        TT_ASSERT(header_->version == kVersion, "Ring buffer version mismatch:", name_);
+    }
+
+    ShmRingBuffer(ShmRingBuffer const &) = delete;
+    ShmRingBuffer &operator=(ShmRingBuffer const &) = delete;
+
+    ~ShmRingBuffer()
+    {
+        munmap(base_, mapping_size_);
+        if (owner_)
+            shm_unlink(name_.c_str());
+    }
+
+    std::string const &name() const { return name_; }
+    std::size_t capacity() const { return header_->capacity; }
+
+    // Largest record (all buffers plus bookkeeping) that can ever fit
+    std::size_t max_record_size() const { return header_->capacity / 2; }
+
+    static std::size_t record_size(std::vector<Buffer> const &buffers)
+    {
+        std::size_t size = align(sizeof(RecordHeader) + buffers.size() * sizeof(std::uint64_t));
+        for (auto const &[ptr, len] : buffers) size += align(len);
+        return size;
+    }
+
+    bool fits(std::vector<Buffer> const &buffers) const { return record_size(buffers) <= max_record_size(); }
+
+    bool empty() const
+    {
+        return header_->tail.load(std::memory_order_acquire) == header_->head.load(std::memory_order_acquire);
+    }
+
+    // Copy buffers into the ring as one record. Returns false if no space became available within timeout_ms
+    // (negative timeout waits forever).
+    bool write(std::vector<Buffer> const &buffers, int timeout_ms)
+    {
+        std::size_t size = record_size(buffers);
+        TT_ASSERT(size <= max_record_size(), "Record does not fit into ring buffer", name_);
+
+        std::uint64_t head = header_->head.load(std::memory_order_relaxed);
+        std::size_t offset = head % capacity();
+        std::size_t needed = size;
+        bool wrap = offset + size > capacity();
+        if (wrap)
+            needed += capacity() - offset;
+
+        auto deadline = deadline_from(timeout_ms);
+        while (true)
+        {
+            std::uint32_t seq = header_->space_seq.load(std::memory_order_acquire);
+            std::uint64_t tail = header_->tail.load(std::memory_order_acquire);
+            if (capacity() - (head - tail) >= needed)
+                break;
+            if (not wait(header_->space_seq, header_->producer_waiting, seq, deadline))
+                return false;
+        }
+
+        if (wrap)
+        {
+            // Mark the remainder of the ring as padding and start the record at the beginning
+            if (capacity() - offset >= sizeof(RecordHeader))
+                record_at(offset)->size = kPaddingRecord;
+            head += capacity() - offset;
+            offset = 0;
+        }
+
+        RecordHeader *record = record_at(offset);
+        record->size = size;
+        record->num_buffers = buffers.size();
+        std::uint64_t *sizes = reinterpret_cast<std::uint64_t *>(record + 1);
+        std::uint8_t *data = data_at(offset) + align(sizeof(RecordHeader) + buffers.size() * sizeof(std::uint64_t));
+        for (std::size_t i = 0; i < buffers.size(); i++)
+        {
+            sizes[i] = buffers[i].second;
+            if (buffers[i].second > 0)
+                std::memcpy(data, buffers[i].first, buffers[i].second);
+            data += align(buffers[i].second);
+        }
+
+        header_->head.store(head + size, std::memory_order_release);
+        notify(header_->data_seq, header_->consumer_waiting);
+        return true;
+    }
+
+    // Get views of the buffers of the oldest record. Views remain valid until release() is called. Returns
+    // false if nothing arrived within timeout_ms (negative timeout waits forever).
+    bool read(std::vector<Buffer> &buffers, int timeout_ms)
+    {
+        TT_ASSERT(pending_release_ == 0, "Previous record must be released before reading the next one");
+        auto deadline = deadline_from(timeout_ms);
+        while (true)
+        {
+            std::uint32_t seq = header_->data_seq.load(std::memory_order_acquire);
+            if (header_->head.load(std::memory_order_acquire) != header_->tail.load(std::memory_order_relaxed))
+                break;
+            if (not wait(header_->data_seq, header_->consumer_waiting, seq, deadline))
+                return false;
+        }
+
+        std::uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+        std::size_t offset = tail % capacity();
+        std::size_t skipped = 0;
+        if (capacity() - offset < sizeof(RecordHeader) or record_at(offset)->size == kPaddingRecord)
+        {
+            skipped = capacity() - offset;
+            offset = 0;
+        }
+
+        RecordHeader const *record = record_at(offset);
+        std::uint64_t const *sizes = reinterpret_cast<std::uint64_t const *>(record + 1);
+        std::uint8_t const *data =
+            data_at(offset) + align(sizeof(RecordHeader) + record->num_buffers * sizeof(std::uint64_t));
+        buffers.clear();
+        buffers.reserve(record->num_buffers);
+        for (std::size_t i = 0; i < record->num_buffers; i++)
+        {
+            buffers.emplace_back(data, sizes[i]);
+            data += align(sizes[i]);
+        }
+
+        pending_release_ = skipped + record->size;
+        return true;
+    }
+
+    // Return the space of the last record handed out by read() to the producer
+    void release()
+    {
+        if (pending_release_ == 0)
+            return;
+        std::uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+        header_->tail.store(tail + pending_release_, std::memory_order_release);
+        pending_release_ = 0;
+        notify(header_->space_seq, header_->producer_waiting);
+    }
+
+   private:
+    static constexpr std::uint64_t kPaddingRecord = ~std::uint64_t(0);
+
+    struct Header
+    {
+        std::uint32_t magic = 0;
+        std::uint32_t version = 0;
+        std::uint64_t capacity = 0;
+        alignas(kAlignment) std::atomic<std::uint64_t> head{0};
+        alignas(kAlignment) std::atomic<std::uint64_t> tail{0};
+        alignas(kAlignment) std::atomic<std::uint32_t> data_seq{0};
+        std::atomic<std::uint32_t> consumer_waiting{0};
+        alignas(kAlignment) std::atomic<std::uint32_t> space_seq{0};
+        std::atomic<std::uint32_t> producer_waiting{0};
+    };
+
+    struct RecordHeader
+    {
+        std::uint64_t size;  // total bytes taken by the record, including this header
+        std::uint64_t num_buffers;
+    };
+
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "futex words must be lock-free");
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t), "futex words must be 32-bit");
+
+    std::string name_;
+    bool owner_;
+    void *base_ = nullptr;
+    std::size_t mapping_size_ = 0;
+    Header *header_ = nullptr;
+    std::size_t pending_release_ = 0;
+
+    static std::size_t align(std::size_t size) { return (size + kAlignment - 1) & ~(kAlignment - 1); }
+
+    void map(int fd)
+    {
+        base_ = mmap(nullptr, mapping_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        TT_ASSERT(base_ != MAP_FAILED, "Failed to map shared memory segment", name_, std::strerror(errno));
+    }
+
+    std::uint8_t *data_at(std::size_t offset) const
+    {
+        return reinterpret_cast<std::uint8_t *>(base_) + sizeof(Header) + offset;
+    }
+    RecordHeader *record_at(std::size_t offset) const { return reinterpret_cast<RecordHeader *>(data_at(offset)); }
+
+    using Clock = std::chrono::steady_clock;
+
+    static Clock::time_point deadline_from(int timeout_ms)
+    {
+        return timeout_ms < 0 ? Clock::time_point::max() : Clock::now() + std::chrono::milliseconds(timeout_ms);
+    }
+
+    // Sleep until the futex word moves away from seq, or the deadline passes. Returns false on timeout.
+    static bool wait(
+        std::atomic<std::uint32_t> &word, std::atomic<std::uint32_t> &waiting, std::uint32_t seq, Clock::time_point deadline)
+    {
+        struct timespec ts;
+        struct timespec *timeout = nullptr;
+        if (deadline != Clock::time_point::max())
+        {
+            auto remaining = deadline - Clock::now();
+            if (remaining <= Clock::duration::zero())
+                return false;
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count();
+            ts.tv_sec = ns / 1000000000;
+            ts.tv_nsec = ns % 1000000000;
+            timeout = &ts;
+        }
+
+        waiting.store(1, std::memory_order_seq_cst);
+        if (word.load(std::memory_order_seq_cst) == seq)
+            syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAIT, seq, timeout, nullptr, 0);
+        waiting.store(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    static void notify(std::atomic<std::uint32_t> &word, std::atomic<std::uint32_t> &waiting)
+    {
+        word.fetch_add(1, std::memory_order_seq_cst);
+        if (waiting.load(std::memory_order_seq_cst))
+            syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+    }
+};
+
+}  // namespace tt